@@ -49,6 +49,7 @@
 
 #include "../inc/Ogr.h"
 #include "../inc/Inf.h"
+#include "../inc/Job.h"
 
 #include <string>
 
@@ -78,24 +79,6 @@ class App : public QMainWindow
 		// ogr2ogr parameters
 		QString parameters;
 
-		// file formats
-		const static int formatsCount = 13;
-		QString **formats;
-		
-		// output formats
-		const static int formatsOutput = 9;
-
-		// database formats
-		const static int databasesCount = 5;
-		QString **databases;
-
-		// output databases
-		const static int databasesOutput = 3;
-
-		// target projections
-		const static int projectionsCount = 3578;
-		QString **projections;
-
 		// qt
 		QMenuBar *theMenu;
 		QMenu *fileMenu;
@@ -122,6 +105,18 @@ class App : public QMainWindow
 
 		QStringList fileList;
 
+		// folder jobs, progress is -1 for jobs without feature count
+		QVector<int> jobsProgress;
+		QVector<int> jobsCount;
+		int jobsDone;
+		QTime jobsClock;
+
+		// jobs not finished yet, to be canceled
+		QList<Job *> jobsActive;
+
+		// jobs writing into a single target file
+		QThreadPool *serialPool;
+
 		QWidget *thePanel;
 				QVBoxLayout *theLayout;
 					QGroupBox *grpSource;
@@ -146,6 +141,22 @@ class App : public QMainWindow
 							QLabel *lblSourceQuery;
 							QLineEdit *txtSourceQuery;
 
+							QLabel *lblSourceCount;
+							QComboBox *cmbSourceCount;
+
+							QLabel *lblSourceFields;
+							QHBoxLayout *lytSourceFields;
+								QComboBox *cmbSourceFields;
+								QLineEdit *txtSourceFields;
+
+							QLabel *lblSourceExtent;
+							QHBoxLayout *lytSourceExtent;
+								QLineEdit *txtSourceExtent;
+								QCheckBox *chkSourceExtent;
+
+							QLabel *lblSourceLayers;
+							QListWidget *lstSourceLayers;
+
 
 					QGroupBox *grpTarget;
 						QGridLayout *lytTarget;
@@ -167,6 +178,8 @@ class App : public QMainWindow
 							QLabel *lblTargetProj;
 							QHBoxLayout *lytTargetProj;
 								QLineEdit *txtTargetProj;
+								QCompleter *cmpTargetProj;
+								QStringListModel *mdlTargetProj;
 								QComboBox *cmbTargetProj;
 
 							QHBoxLayout *lytTargetOptions;
@@ -179,10 +192,18 @@ class App : public QMainWindow
                             QHBoxLayout *lytTargetDims;
                                 QComboBox *cmbTargetDims;
 
+							QLabel *lblTargetGroup;
+							QHBoxLayout *lytTargetGroup;
+								QSpinBox *spnTargetGroup;
+								QCheckBox *chkTargetResume;
+
 					QTextEdit *txtOutput;
 
+				QTreeWidget *lstJobs;
+
 					QHBoxLayout *lytExecute;
 						QPushButton *btnExecute;
+						QPushButton *btnCancel;
 						QPushButton *btnQuit;
 
 
@@ -198,6 +219,18 @@ class App : public QMainWindow
          */
         void InitDims( void );
 
+		/*!
+		 *	\fn void InitCounts( void );
+		 *	\brief Inits feature count strategies
+		 */
+		void InitCounts( void );
+
+		/*!
+		 *	\fn void InitFields( void );
+		 *	\brief Inits field selection modes
+		 */
+		void InitFields( void );
+
 		/*!
 		 *	\fn void void InitProjections( void );
 		 *	\brief Inits projections
@@ -240,6 +273,51 @@ class App : public QMainWindow
 		 */
 		void UpdateParameters( void );
 
+		/*!
+		 *	\fn void ExecuteFolder( void );
+		 *	\brief Converts folder files concurrently
+		 */
+		void ExecuteFolder( void );
+
+		/*!
+		 *	\fn void ExecuteLayers( void );
+		 *	\brief Converts selected source layers concurrently
+		 */
+		void ExecuteLayers( void );
+
+		/*!
+		 *	\fn QStringList CheckedLayers( void );
+		 *	\brief Selected source layers
+		 *	\returns layer names
+		 */
+		QStringList CheckedLayers( void );
+
+		/*!
+		 *	\fn void ResetJobs( int count );
+		 *	\brief Clears job list and progress before a batch
+		 *	\param count : number of jobs
+		 */
+		void ResetJobs( int count );
+
+		/*!
+		 *	\fn Job *CreateJob( int index, QString label, QString source, QString target );
+		 *	\brief Creates a configured job and its list entry
+		 *	\param index : job number
+		 *	\param label : job list label
+		 *	\param source : source name
+		 *	\param target : target name
+		 *	\returns job, to be started
+		 */
+		Job *CreateJob( int index, QString label, QString source, QString target );
+
+		/*!
+		 *	\fn bool Configure( Ogr *engine );
+		 *	\brief Applies conversion options to an engine
+		 *	\param engine : Ogr instance
+		 *	\returns false if an option is invalid
+		 */
+		bool Configure( Ogr *engine );
+
 
 	private slots :
 
@@ -266,6 +344,14 @@ class App : public QMainWindow
 
 		void evtTxtSourceQuery( void );
 
+		void evtCmbSourceFields( void );
+
+		void evtTxtSourceFields( void );
+
+		void evtTxtSourceExtent( void );
+
+		void evtLstSourceLayers( void );
+
 
 		void evtRadTargetFile( void );
 
@@ -282,6 +368,8 @@ class App : public QMainWindow
 
 		void evtTxtTargetProj( void );
 
+		void evtCmpTargetProj( QString );
+
 		void evtCmbTargetProj( void );
 
 
@@ -291,11 +379,29 @@ class App : public QMainWindow
 
 		void evtRadTargetUpdate( void );
 
+		void evtSpnTargetGroup( void );
+
 
 		void evtBtnExecute( void );
 
+		void evtBtnCancel( void );
+
 		void evtBtnQuit( void );
 
+
+		void evtJobProgress( int, int, int );
+
+		void evtJobFinished( int, bool, QString );
+
+	protected:
+
+		/*!
+		 *	\fn void closeEvent( QCloseEvent *event );
+		 *	\brief Cancels running jobs and waits for them, whatever closes the window
+		 *	\param event : close event
+		 */
+		void closeEvent( QCloseEvent *event );
+
 		
 	public:
 
@@ -0,0 +1,201 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Bch.h
+ *	\brief Conversion benchmark
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef BCH
+#define BCH
+
+#include "../inc/Ogr.h"
+
+#include <QtCore>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+ *	\class Bch
+ *	\brief Conversion benchmark
+ *	\author Olivier Pilotte
+ *
+ *	Generates synthetic layers (points, lines, polygons, a wide schema and
+ *	mixed geometry types) in every writable format of the formats table,
+ *	then converts each of them into every writable format, with and without
+ *	reprojection. Each conversion is run once to warm caches, then timed
+ *	several times and the median is kept. Generated data only depends on
+ *	the feature count, so runs of two versions can be compared.
+ *
+ *	Results are written on standard output and in results.tsv, and compared
+ *	with baseline.tsv when the benchmark folder has one.
+ */
+class Bch : public QObject
+{
+	Q_OBJECT
+
+	private:
+
+		/*!
+		 *	\enum Kind
+		 *	\brief Synthetic layer kinds
+		 */
+		enum Kind
+		{
+			KIND_POINTS,
+			KIND_LINES,
+			KIND_POLYGONS,
+			KIND_WIDE,
+			KIND_MIXED,
+			KIND_COUNT
+		};
+
+		QString folder;
+
+		int features;
+		int repeats;
+		int threads;
+
+		// writable formats : name and extension
+		QStringList names;
+		QStringList extensions;
+
+		unsigned int seed;
+
+		/*!
+		 *	\fn double Random( double min, double max );
+		 *	\brief Deterministic pseudo random number
+		 *	\param min : lower bound
+		 *	\param max : upper bound
+		 *	\returns number
+		 */
+		double Random( double min, double max );
+
+		/*!
+		 *	\fn OGRGeometryH Geometry( int kind, int index );
+		 *	\brief Creates a synthetic geometry in longitude, latitude
+		 *	\param kind : Kind value
+		 *	\param index : feature number
+		 *	\returns geometry
+		 */
+		OGRGeometryH Geometry( int kind, int index );
+
+		/*!
+		 *	\fn bool Generate( QString filename, QString driver, int kind, QString prefix = "f" );
+		 *	\brief Writes a synthetic layer
+		 *	\param filename : layer file
+		 *	\param driver : format name
+		 *	\param kind : Kind value
+		 *	\param prefix : field names, followed by the field number
+		 *	\returns false if the format can't hold the layer
+		 */
+		bool Generate( QString filename, QString driver, int kind, QString prefix = "f" );
+
+		/*!
+		 *	\fn bool Convert( QString source, QString target, QString driver, int projection, Ogr::Stats &stats );
+		 *	\brief Converts a layer once
+		 *	\param source : source file
+		 *	\param target : target file
+		 *	\param driver : target format name
+		 *	\param projection : target epsg code, 0 for none
+		 *	\param stats : conversion instrumentation
+		 *	\returns false if the conversion failed
+		 */
+		bool Convert( QString source, QString target, QString driver, int projection, Ogr::Stats &stats );
+
+		/*!
+		 *	\fn int CompareTransforms( void );
+		 *	\brief Compares per geometry OGR_G_TransformTo with a shared transformation
+		 *	\returns number of geometries transformed differently
+		 */
+		int CompareTransforms( void );
+
+		/*!
+		 *	\fn int CompareProjections( void );
+		 *	\brief Checks closed form projections against PROJ for accuracy and speed
+		 *	\returns number of systems off by more than a millimetre
+		 */
+		int CompareProjections( void );
+
+		/*!
+		 *	\fn void CompareLookups( void );
+		 *	\brief Compares a linear scan of the projection table with its EPSG index
+		 */
+		void CompareLookups( void );
+
+		/*!
+		 *	\fn int ComparePlans( void );
+		 *	\brief Checks the column values written by queries run as attribute filters
+		 *	\returns number of cases where a value landed in the wrong field
+		 */
+		int ComparePlans( void );
+
+		/*!
+		 *	\fn int ComparePlan( QString driver, QString extension, QString prefix );
+		 *	\brief Converts a planned query of a generated layer into a shapefile and checks its columns
+		 *	\param driver : source format name
+		 *	\param extension : source file extension
+		 *	\param prefix : source field names
+		 *	\returns 1 if a value landed in the wrong field, 0 otherwise
+		 */
+		int ComparePlan( QString driver, QString extension, QString prefix );
+
+		/*!
+		 *	\fn QMap<QString, double> Baseline( void );
+		 *	\brief Reads the baseline results
+		 *	\returns features per second, by case
+		 */
+		QMap<QString, double> Baseline( void );
+
+		/*!
+		 *	\fn void Print( QString text );
+		 *	\brief Writes a line on standard output
+		 *	\param text : line
+		 */
+		void Print( QString text );
+
+
+	public:
+
+		/*!
+		 *	\fn Bch( QString folder, int features, int repeats, int threads );
+		 *	\brief Constructor
+		 *	\param folder : working folder
+		 *	\param features : features per synthetic layer
+		 *	\param repeats : timed runs per case
+		 *	\param threads : transform workers, as Ogr::SetThreads
+		 */
+		Bch( QString folder, int features = 100000, int repeats = 5, int threads = 1 );
+
+		/*!
+		 *	\fn int Run( void );
+		 *	\brief Runs every case
+		 *	\returns exit code, 0 if the benchmark ran
+		 */
+		int Run( void );
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -0,0 +1,181 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Cli.h
+ *	\brief Command line batch mode
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef CLI
+#define CLI
+
+#include "../inc/Job.h"
+
+#include <QtCore>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+ *	\class Cli
+ *	\brief Command line batch mode
+ *	\author Olivier Pilotte
+ *
+ *	Runs a job file without the interface. Each line holds one ogr2ogr
+ *	command, as shown in the output panel of the interface, and becomes a
+ *	Job on the thread pool. A .ini manifest may be given instead : its
+ *	[general] section sets concurrency, retries and the report file, and
+ *	every other section is one job (source, target, format, srs, query,
+ *	layer, mode, select, attributes, dim, extent, extent_target, group,
+ *	count, checkpoint, resume, json, retries). A job given -json, or a
+ *	json key, writes its stage timings and counters to that file. Failed jobs having checkpoints
+ *	are retried from their last checkpoint. Progress and results are written on standard output
+ *	as tab separated lines :
+ *
+ *	job <index> <command or section>
+ *	progress <index> <percent> <features>
+ *	done <index> <ok|failed> <seconds> <message>
+ *	retry <index> <attempt>
+ *	summary <jobs> <ok> <failed> <seconds>
+ */
+class Cli : public QObject
+{
+	Q_OBJECT
+
+	private:
+
+		QList<Job *> jobs;
+
+		QStringList labels;
+		QStringList messages;
+		QStringList reports;
+
+		QVector<bool> results;
+		QVector<bool> appends;
+		QVector<int> checkpoints;
+		QVector<int> attempts;
+		QVector<int> remaining;
+
+		int succeeded;
+		int failed;
+
+		int concurrency;
+		int retries;
+
+		QString report;
+
+		QMutex mutex;
+
+		/*!
+		 *	\fn static QStringList Split( QString line, bool &ok );
+		 *	\brief Splits a command line on blanks, keeping quoted tokens
+		 *	\param line : command line
+		 *	\param ok : false if a quote is not closed
+		 *	\returns tokens
+		 */
+		static QStringList Split( QString line, bool &ok );
+
+		/*!
+		 *	\fn Job *Parse( QString line, QString &error );
+		 *	\brief Creates a configured job from a command line
+		 *	\param line : command line
+		 *	\param error : error message
+		 *	\returns job, or NULL if the line is invalid
+		 */
+		Job *Parse( QString line, QString &error );
+
+		/*!
+		 *	\fn Job *Create( QStringList tokens, QString &error );
+		 *	\brief Creates a configured job from ogr2ogr arguments
+		 *	\param tokens : arguments
+		 *	\param error : error message
+		 *	\returns job, or NULL if the arguments are invalid
+		 */
+		Job *Create( QStringList tokens, QString &error );
+
+		/*!
+		 *	\fn bool Read( QString filename );
+		 *	\brief Creates the jobs of a command file
+		 *	\param filename : command file
+		 *	\returns false if a line is invalid
+		 */
+		bool Read( QString filename );
+
+		/*!
+		 *	\fn bool Load( QString filename );
+		 *	\brief Creates the jobs of an ini manifest
+		 *	\param filename : manifest
+		 *	\returns false if a section is invalid
+		 */
+		bool Load( QString filename );
+
+		/*!
+		 *	\fn bool Report( QString filename, double seconds );
+		 *	\brief Writes the summary report
+		 *	\param filename : report file
+		 *	\param seconds : batch wall time
+		 *	\returns false if the file can't be written
+		 */
+		bool Report( QString filename, double seconds );
+
+		/*!
+		 *	\fn void Print( QString text );
+		 *	\brief Writes a line on standard output
+		 *	\param text : line
+		 */
+		void Print( QString text );
+
+
+	private slots :
+
+		void evtJobProgress( int, int, int );
+
+		void evtJobFinished( int, bool, QString );
+
+
+	public:
+
+		/*!
+		 *	\fn Cli( void );
+		 *	\brief Constructor
+		 */
+		Cli( void );
+
+		/*!
+		 *	\fn ~Cli( void );
+		 *	\brief Destructor
+		 */
+		~Cli( void );
+
+		/*!
+		 *	\fn int Run( QString filename );
+		 *	\brief Runs every job of a job file or manifest
+		 *	\param filename : job file, or manifest if it ends with .ini
+		 *	\returns exit code, 0 if every job succeeded
+		 */
+		int Run( QString filename );
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -0,0 +1,143 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Drv.h
+ *	\brief Driver registry
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef DRV
+#define DRV
+
+#include "ogr_api.h"
+#include "cpl_multiproc.h"
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+/*!
+ *	\class Drv
+ *	\brief Driver registry
+ *	\author Olivier Pilotte
+ *
+ *	Registers OGR drivers on first use instead of all of them at startup.
+ *	Formats of the interface tables are registered one by one, by name,
+ *	file extension or connection prefix. Anything else falls back to
+ *	OGRRegisterAll, once.
+ */
+class Drv
+{
+	private :
+
+		/*!
+		 *	\struct Entry
+		 *	\brief Driver known to the registry
+		 */
+		struct Entry
+		{
+			const char *name;
+			const char *extensions;
+			const char *prefix;
+
+			void ( *registration )( void );
+		};
+
+		static const Entry entries[];
+
+		static CPLMutex *mutex;
+
+		static vector<bool> registered;
+
+		static bool all;
+
+		/*!
+		 *	\fn static int Find( string name );
+		 *	\brief Table entry of a format name
+		 *	\param name : OGR driver name
+		 *	\returns entry index, -1 if unknown
+		 */
+		static int Find( string name );
+
+		/*!
+		 *	\fn static int Guess( string filename );
+		 *	\brief Table entry of a data source name
+		 *	\param filename : file name or connection string
+		 *	\returns entry index, -1 if unknown
+		 */
+		static int Guess( string filename );
+
+		/*!
+		 *	\fn static double Register( int index );
+		 *	\brief Registers a table entry unless done already
+		 *	\param index : entry index
+		 *	\returns seconds spent
+		 */
+		static double Register( int index );
+
+	public :
+
+		/*!
+		 *	\fn static OGRSFDriverH Driver( string name );
+		 *	\brief Driver of a format, registered on first use
+		 *	\param name : OGR driver name
+		 *	\returns driver, NULL if not available
+		 */
+		static OGRSFDriverH Driver( string name );
+
+		/*!
+		 *	\fn static OGRDataSourceH Open( string filename, int update );
+		 *	\brief Opens a data source, registers its driver first
+		 *	\param filename : file name or connection string
+		 *	\param update : opens for writing
+		 *	\returns data source, NULL on failure
+		 */
+		static OGRDataSourceH Open( string filename, int update );
+
+		/*!
+		 *	\fn static double RegisterAll( void );
+		 *	\brief Registers every driver linked in
+		 *	\returns seconds spent
+		 */
+		static double RegisterAll( void );
+
+		/*!
+		 *	\fn static vector<string> Names( void );
+		 *	\brief Formats registered one by one
+		 *	\returns driver names
+		 */
+		static vector<string> Names( void );
+
+		/*!
+		 *	\fn static double Time( string name );
+		 *	\brief Registers a format and measures it
+		 *	\param name : OGR driver name
+		 *	\returns seconds spent, 0 if registered already
+		 */
+		static double Time( string name );
+};
+
+#endif
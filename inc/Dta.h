@@ -11,7 +11,7 @@
  *	(at your option) any later version.
  *
  *	This program is distributed in the hope that it will be useful,
- *	but WITHOUT ANY WARRANTY; without even the implied warranty of																						
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
  *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
  *	GNU General Public License for more details.
  *
@@ -27,3601 +27,111 @@
  *	\date 27/10/09
  */
 
-formats[  0 ][ 0 ] = "ESRI Shapefile";		formats[  0 ][ 1 ] = "shp";
-formats[  1 ][ 0 ] = "MapInfo File";		formats[  1 ][ 1 ] = "tab";
-formats[  2 ][ 0 ] = "BNA";					formats[  2 ][ 1 ] = "bna";
-formats[  3 ][ 0 ] = "CSV";					formats[  3 ][ 1 ] = "csv";
-formats[  4 ][ 0 ] = "GML";					formats[  4 ][ 1 ] = "gml";
-formats[  5 ][ 0 ] = "KML";					formats[  5 ][ 1 ] = "kml";
-formats[  6 ][ 0 ] = "GMT";					formats[  6 ][ 1 ] = "gmt";
-formats[  7 ][ 0 ] = "GPX";					formats[  7 ][ 1 ] = "gpx";
-formats[  8 ][ 0 ] = "Geoconcept";			formats[  8 ][ 1 ] = "gxt";
-formats[  9 ][ 0 ] = "FMEObjects Gateway";	formats[  9 ][ 1 ] = "fdd";
-formats[ 10 ][ 0 ] = "GeoJSON";				formats[ 10 ][ 1 ] = "txt";
-formats[ 11 ][ 0 ] = "UK. NTF";				formats[ 11 ][ 1 ] = "ntf";
-formats[ 12 ][ 0 ] = "XPlane";				formats[ 12 ][ 1 ] = "dat";
+#ifndef DTA
+#define DTA
 
-databases[ 0 ][ 0 ] = "PostgreSQL";			databases[ 0 ][ 1 ] = "QPSQL";
-databases[ 1 ][ 0 ] = "SQLite";				databases[ 1 ][ 1 ] = "QSQLITE";
-databases[ 2 ][ 0 ] = "OCI";				databases[ 2 ][ 1 ] = "QOCI";
-databases[ 3 ][ 0 ] = "MySQL";				databases[ 3 ][ 1 ] = "QMYSQL";
-databases[ 4 ][ 0 ] = "ODBC";				databases[ 4 ][ 1 ] = "QODBC";
+/*!
+ *	\class Dta
+ *	\brief Formats & Projections
+ *	\author Olivier Pilotte
+ *
+ *	Read only tables of string literals, nothing is allocated to use them.
+ *	Output formats and databases come first in their tables.
+ */
+class Dta
+{
+	public :
+
+		/*!
+		 *	\fn static int Formats( void );
+		 *	\brief Number of file formats
+		 *	\returns count
+		 */
+		static int Formats( void );
+
+		/*!
+		 *	\fn static int FormatsOutput( void );
+		 *	\brief Number of file formats that can be written, first in table
+		 *	\returns count
+		 */
+		static int FormatsOutput( void );
+
+		/*!
+		 *	\fn static const char *FormatName( int index );
+		 *	\brief OGR driver name of a file format
+		 *	\param index : format index
+		 *	\returns name
+		 */
+		static const char *FormatName( int index );
+
+		/*!
+		 *	\fn static const char *FormatExtension( int index );
+		 *	\brief File extension of a file format
+		 *	\param index : format index
+		 *	\returns extension, without dot
+		 */
+		static const char *FormatExtension( int index );
+
+		/*!
+		 *	\fn static int Databases( void );
+		 *	\brief Number of database formats
+		 *	\returns count
+		 */
+		static int Databases( void );
+
+		/*!
+		 *	\fn static int DatabasesOutput( void );
+		 *	\brief Number of database formats that can be written, first in table
+		 *	\returns count
+		 */
+		static int DatabasesOutput( void );
+
+		/*!
+		 *	\fn static const char *DatabaseName( int index );
+		 *	\brief OGR driver name of a database format
+		 *	\param index : database index
+		 *	\returns name
+		 */
+		static const char *DatabaseName( int index );
+
+		/*!
+		 *	\fn static const char *DatabaseDriver( int index );
+		 *	\brief Qt sql driver of a database format
+		 *	\param index : database index
+		 *	\returns driver name
+		 */
+		static const char *DatabaseDriver( int index );
+
+		/*!
+		 *	\fn static int Projections( void );
+		 *	\brief Number of projections, the first one is empty
+		 *	\returns count
+		 */
+		static int Projections( void );
+
+		/*!
+		 *	\fn static int ProjectionCode( int index );
+		 *	\brief EPSG code of a projection
+		 *	\param index : projection index
+		 *	\returns code, 0 for the empty projection
+		 */
+		static int ProjectionCode( int index );
+
+		/*!
+		 *	\fn static const char *ProjectionName( int index );
+		 *	\brief Name of a projection
+		 *	\param index : projection index
+		 *	\returns name
+		 */
+		static const char *ProjectionName( int index );
+
+		/*!
+		 *	\fn static int ProjectionRow( int code );
+		 *	\brief Projection of an EPSG code, in constant time
+		 *	\param code : EPSG code
+		 *	\returns projection index, -1 if not in table
+		 */
+		static int ProjectionRow( int code );
+};
 
-projections[    0 ][ 0 ] =  "";			projections[    0 ][ 1 ] =  "";
-projections[    1 ][ 0 ] =  "2000";		projections[    1 ][ 1 ] =  "Anguilla 1957 / British West Indies Grid";
-projections[    2 ][ 0 ] =  "2001";		projections[    2 ][ 1 ] =  "Antigua 1943 / British West Indies Grid";
-projections[    3 ][ 0 ] =  "2002";		projections[    3 ][ 1 ] =  "Dominica 1945 / British West Indies Grid";
-projections[    4 ][ 0 ] =  "2003";		projections[    4 ][ 1 ] =  "Grenada 1953 / British West Indies Grid";
-projections[    5 ][ 0 ] =  "2004";		projections[    5 ][ 1 ] =  "Montserrat 1958 / British West Indies Grid";
-projections[    6 ][ 0 ] =  "2005";		projections[    6 ][ 1 ] =  "St. Kitts 1955 / British West Indies Grid";
-projections[    7 ][ 0 ] =  "2006";		projections[    7 ][ 1 ] =  "St. Lucia 1955 / British West Indies Grid";
-projections[    8 ][ 0 ] =  "2007";		projections[    8 ][ 1 ] =  "St. Vincent 45 / British West Indies Grid";
-projections[    9 ][ 0 ] =  "2008";		projections[    9 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 2";
-projections[   10 ][ 0 ] =  "2009";		projections[   10 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 3";
-projections[   11 ][ 0 ] =  "2010";		projections[   11 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 4";
-projections[   12 ][ 0 ] =  "2011";		projections[   12 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 5";
-projections[   13 ][ 0 ] =  "2012";		projections[   13 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 6";
-projections[   14 ][ 0 ] =  "2013";		projections[   14 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 7";
-projections[   15 ][ 0 ] =  "2014";		projections[   15 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 8";
-projections[   16 ][ 0 ] =  "2015";		projections[   16 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 9";
-projections[   17 ][ 0 ] =  "2016";		projections[   17 ][ 1 ] =  "NAD27(CGQ77) / SCoPQ zone 10";
-projections[   18 ][ 0 ] =  "2017";		projections[   18 ][ 1 ] =  "NAD27(76) / MTM zone 8";
-projections[   19 ][ 0 ] =  "2018";		projections[   19 ][ 1 ] =  "NAD27(76) / MTM zone 9";
-projections[   20 ][ 0 ] =  "2019";		projections[   20 ][ 1 ] =  "NAD27(76) / MTM zone 10";
-projections[   21 ][ 0 ] =  "2020";		projections[   21 ][ 1 ] =  "NAD27(76) / MTM zone 11";
-projections[   22 ][ 0 ] =  "2021";		projections[   22 ][ 1 ] =  "NAD27(76) / MTM zone 12";
-projections[   23 ][ 0 ] =  "2022";		projections[   23 ][ 1 ] =  "NAD27(76) / MTM zone 13";
-projections[   24 ][ 0 ] =  "2023";		projections[   24 ][ 1 ] =  "NAD27(76) / MTM zone 14";
-projections[   25 ][ 0 ] =  "2024";		projections[   25 ][ 1 ] =  "NAD27(76) / MTM zone 15";
-projections[   26 ][ 0 ] =  "2025";		projections[   26 ][ 1 ] =  "NAD27(76) / MTM zone 16";
-projections[   27 ][ 0 ] =  "2026";		projections[   27 ][ 1 ] =  "NAD27(76) / MTM zone 17";
-projections[   28 ][ 0 ] =  "2027";		projections[   28 ][ 1 ] =  "NAD27(76) / UTM zone 15N";
-projections[   29 ][ 0 ] =  "2028";		projections[   29 ][ 1 ] =  "NAD27(76) / UTM zone 16N";
-projections[   30 ][ 0 ] =  "2029";		projections[   30 ][ 1 ] =  "NAD27(76) / UTM zone 17N";
-projections[   31 ][ 0 ] =  "2030";		projections[   31 ][ 1 ] =  "NAD27(76) / UTM zone 18N";
-projections[   32 ][ 0 ] =  "2031";		projections[   32 ][ 1 ] =  "NAD27(CGQ77) / UTM zone 17N";
-projections[   33 ][ 0 ] =  "2032";		projections[   33 ][ 1 ] =  "NAD27(CGQ77) / UTM zone 18N";
-projections[   34 ][ 0 ] =  "2033";		projections[   34 ][ 1 ] =  "NAD27(CGQ77) / UTM zone 19N";
-projections[   35 ][ 0 ] =  "2034";		projections[   35 ][ 1 ] =  "NAD27(CGQ77) / UTM zone 20N";
-projections[   36 ][ 0 ] =  "2035";		projections[   36 ][ 1 ] =  "NAD27(CGQ77) / UTM zone 21N";
-projections[   37 ][ 0 ] =  "2036";		projections[   37 ][ 1 ] =  "NAD83(CSRS98) / New Brunswick Stereo";
-projections[   38 ][ 0 ] =  "2037";		projections[   38 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 19N";
-projections[   39 ][ 0 ] =  "2038";		projections[   39 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 20N";
-projections[   40 ][ 0 ] =  "2039";		projections[   40 ][ 1 ] =  "Israel / Israeli TM Grid";
-projections[   41 ][ 0 ] =  "2040";		projections[   41 ][ 1 ] =  "Locodjo 1965 / UTM zone 30N";
-projections[   42 ][ 0 ] =  "2041";		projections[   42 ][ 1 ] =  "Abidjan 1987 / UTM zone 30N";
-projections[   43 ][ 0 ] =  "2042";		projections[   43 ][ 1 ] =  "Locodjo 1965 / UTM zone 29N";
-projections[   44 ][ 0 ] =  "2043";		projections[   44 ][ 1 ] =  "Abidjan 1987 / UTM zone 29N";
-projections[   45 ][ 0 ] =  "2044";		projections[   45 ][ 1 ] =  "Hanoi 1972 / Gauss-Kruger zone 18";
-projections[   46 ][ 0 ] =  "2045";		projections[   46 ][ 1 ] =  "Hanoi 1972 / Gauss-Kruger zone 19";
-projections[   47 ][ 0 ] =  "2046";		projections[   47 ][ 1 ] =  "Hartebeesthoek94 / Lo15";
-projections[   48 ][ 0 ] =  "2047";		projections[   48 ][ 1 ] =  "Hartebeesthoek94 / Lo17";
-projections[   49 ][ 0 ] =  "2048";		projections[   49 ][ 1 ] =  "Hartebeesthoek94 / Lo19";
-projections[   50 ][ 0 ] =  "2049";		projections[   50 ][ 1 ] =  "Hartebeesthoek94 / Lo21";
-projections[   51 ][ 0 ] =  "2050";		projections[   51 ][ 1 ] =  "Hartebeesthoek94 / Lo23";
-projections[   52 ][ 0 ] =  "2051";		projections[   52 ][ 1 ] =  "Hartebeesthoek94 / Lo25";
-projections[   53 ][ 0 ] =  "2052";		projections[   53 ][ 1 ] =  "Hartebeesthoek94 / Lo27";
-projections[   54 ][ 0 ] =  "2053";		projections[   54 ][ 1 ] =  "Hartebeesthoek94 / Lo29";
-projections[   55 ][ 0 ] =  "2054";		projections[   55 ][ 1 ] =  "Hartebeesthoek94 / Lo31";
-projections[   56 ][ 0 ] =  "2055";		projections[   56 ][ 1 ] =  "Hartebeesthoek94 / Lo33";
-projections[   57 ][ 0 ] =  "2056";		projections[   57 ][ 1 ] =  "CH1903+ / LV95";
-projections[   58 ][ 0 ] =  "2057";		projections[   58 ][ 1 ] =  "Rassadiran / Nakhl e Taqi";
-projections[   59 ][ 0 ] =  "2058";		projections[   59 ][ 1 ] =  "ED50(ED77) / UTM zone 38N";
-projections[   60 ][ 0 ] =  "2059";		projections[   60 ][ 1 ] =  "ED50(ED77) / UTM zone 39N";
-projections[   61 ][ 0 ] =  "2060";		projections[   61 ][ 1 ] =  "ED50(ED77) / UTM zone 40N";
-projections[   62 ][ 0 ] =  "2061";		projections[   62 ][ 1 ] =  "ED50(ED77) / UTM zone 41N";
-projections[   63 ][ 0 ] =  "2062";		projections[   63 ][ 1 ] =  "Madrid 1870 (Madrid) / Spain";
-projections[   64 ][ 0 ] =  "2063";		projections[   64 ][ 1 ] =  "Dabola 1981 / UTM zone 28N";
-projections[   65 ][ 0 ] =  "2064";		projections[   65 ][ 1 ] =  "Dabola 1981 / UTM zone 29N";
-projections[   66 ][ 0 ] =  "2065";		projections[   66 ][ 1 ] =  "S-JTSK (Ferro) / Krovak";
-projections[   67 ][ 0 ] =  "2066";		projections[   67 ][ 1 ] =  "Mount Dillon / Tobago Grid";
-projections[   68 ][ 0 ] =  "2067";		projections[   68 ][ 1 ] =  "Naparima 1955 / UTM zone 20N";
-projections[   69 ][ 0 ] =  "2068";		projections[   69 ][ 1 ] =  "ELD79 / Libya zone 5";
-projections[   70 ][ 0 ] =  "2069";		projections[   70 ][ 1 ] =  "ELD79 / Libya zone 6";
-projections[   71 ][ 0 ] =  "2070";		projections[   71 ][ 1 ] =  "ELD79 / Libya zone 7";
-projections[   72 ][ 0 ] =  "2071";		projections[   72 ][ 1 ] =  "ELD79 / Libya zone 8";
-projections[   73 ][ 0 ] =  "2072";		projections[   73 ][ 1 ] =  "ELD79 / Libya zone 9";
-projections[   74 ][ 0 ] =  "2073";		projections[   74 ][ 1 ] =  "ELD79 / Libya zone 10";
-projections[   75 ][ 0 ] =  "2074";		projections[   75 ][ 1 ] =  "ELD79 / Libya zone 11";
-projections[   76 ][ 0 ] =  "2075";		projections[   76 ][ 1 ] =  "ELD79 / Libya zone 12";
-projections[   77 ][ 0 ] =  "2076";		projections[   77 ][ 1 ] =  "ELD79 / Libya zone 13";
-projections[   78 ][ 0 ] =  "2077";		projections[   78 ][ 1 ] =  "ELD79 / UTM zone 32N";
-projections[   79 ][ 0 ] =  "2078";		projections[   79 ][ 1 ] =  "ELD79 / UTM zone 33N";
-projections[   80 ][ 0 ] =  "2079";		projections[   80 ][ 1 ] =  "ELD79 / UTM zone 34N";
-projections[   81 ][ 0 ] =  "2080";		projections[   81 ][ 1 ] =  "ELD79 / UTM zone 35N";
-projections[   82 ][ 0 ] =  "2081";		projections[   82 ][ 1 ] =  "Chos Malal 1914 / Argentina zone 2";
-projections[   83 ][ 0 ] =  "2082";		projections[   83 ][ 1 ] =  "Pampa del Castillo / Argentina zone 2";
-projections[   84 ][ 0 ] =  "2083";		projections[   84 ][ 1 ] =  "Hito XVIII 1963 / Argentina zone 2";
-projections[   85 ][ 0 ] =  "2084";		projections[   85 ][ 1 ] =  "Hito XVIII 1963 / UTM zone 19S";
-projections[   86 ][ 0 ] =  "2085";		projections[   86 ][ 1 ] =  "NAD27 / Cuba Norte";
-projections[   87 ][ 0 ] =  "2086";		projections[   87 ][ 1 ] =  "NAD27 / Cuba Sur";
-projections[   88 ][ 0 ] =  "2087";		projections[   88 ][ 1 ] =  "ELD79 / TM 12 NE";
-projections[   89 ][ 0 ] =  "2088";		projections[   89 ][ 1 ] =  "Carthage / TM 11 NE";
-projections[   90 ][ 0 ] =  "2089";		projections[   90 ][ 1 ] =  "Yemen NGN96 / UTM zone 38N";
-projections[   91 ][ 0 ] =  "2090";		projections[   91 ][ 1 ] =  "Yemen NGN96 / UTM zone 39N";
-projections[   92 ][ 0 ] =  "2091";		projections[   92 ][ 1 ] =  "South Yemen / Gauss Kruger zone 8";
-projections[   93 ][ 0 ] =  "2092";		projections[   93 ][ 1 ] =  "South Yemen / Gauss Kruger zone 9";
-projections[   94 ][ 0 ] =  "2093";		projections[   94 ][ 1 ] =  "Hanoi 1972 / GK 106 NE";
-projections[   95 ][ 0 ] =  "2094";		projections[   95 ][ 1 ] =  "WGS 72BE / TM 106 NE";
-projections[   96 ][ 0 ] =  "2095";		projections[   96 ][ 1 ] =  "Bissau / UTM zone 28N";
-projections[   97 ][ 0 ] =  "2096";		projections[   97 ][ 1 ] =  "Korean 1985 / Korea East Belt";
-projections[   98 ][ 0 ] =  "2097";		projections[   98 ][ 1 ] =  "Korean 1985 / Korea Central Belt";
-projections[   99 ][ 0 ] =  "2098";		projections[   99 ][ 1 ] =  "Korean 1985 / Korea West Belt";
-projections[  100 ][ 0 ] =  "2099";		projections[  100 ][ 1 ] =  "Qatar 1948 / Qatar Grid";
-projections[  101 ][ 0 ] =  "2100";		projections[  101 ][ 1 ] =  "GGRS87 / Greek Grid";
-projections[  102 ][ 0 ] =  "2101";		projections[  102 ][ 1 ] =  "Lake / Maracaibo Grid M1";
-projections[  103 ][ 0 ] =  "2102";		projections[  103 ][ 1 ] =  "Lake / Maracaibo Grid";
-projections[  104 ][ 0 ] =  "2103";		projections[  104 ][ 1 ] =  "Lake / Maracaibo Grid M3";
-projections[  105 ][ 0 ] =  "2104";		projections[  105 ][ 1 ] =  "Lake / Maracaibo La Rosa Grid";
-projections[  106 ][ 0 ] =  "2105";		projections[  106 ][ 1 ] =  "NZGD2000 / Mount Eden Circuit 2000";
-projections[  107 ][ 0 ] =  "2106";		projections[  107 ][ 1 ] =  "NZGD2000 / Bay of Plenty Circuit 2000";
-projections[  108 ][ 0 ] =  "2107";		projections[  108 ][ 1 ] =  "NZGD2000 / Poverty Bay Circuit 2000";
-projections[  109 ][ 0 ] =  "2108";		projections[  109 ][ 1 ] =  "NZGD2000 / Hawkes Bay Circuit 2000";
-projections[  110 ][ 0 ] =  "2109";		projections[  110 ][ 1 ] =  "NZGD2000 / Taranaki Circuit 2000";
-projections[  111 ][ 0 ] =  "2110";		projections[  111 ][ 1 ] =  "NZGD2000 / Tuhirangi Circuit 2000";
-projections[  112 ][ 0 ] =  "2111";		projections[  112 ][ 1 ] =  "NZGD2000 / Wanganui Circuit 2000";
-projections[  113 ][ 0 ] =  "2112";		projections[  113 ][ 1 ] =  "NZGD2000 / Wairarapa Circuit 2000";
-projections[  114 ][ 0 ] =  "2113";		projections[  114 ][ 1 ] =  "NZGD2000 / Wellington Circuit 2000";
-projections[  115 ][ 0 ] =  "2114";		projections[  115 ][ 1 ] =  "NZGD2000 / Collingwood Circuit 2000";
-projections[  116 ][ 0 ] =  "2115";		projections[  116 ][ 1 ] =  "NZGD2000 / Nelson Circuit 2000";
-projections[  117 ][ 0 ] =  "2116";		projections[  117 ][ 1 ] =  "NZGD2000 / Karamea Circuit 2000";
-projections[  118 ][ 0 ] =  "2117";		projections[  118 ][ 1 ] =  "NZGD2000 / Buller Circuit 2000";
-projections[  119 ][ 0 ] =  "2118";		projections[  119 ][ 1 ] =  "NZGD2000 / Grey Circuit 2000";
-projections[  120 ][ 0 ] =  "2119";		projections[  120 ][ 1 ] =  "NZGD2000 / Amuri Circuit 2000";
-projections[  121 ][ 0 ] =  "2120";		projections[  121 ][ 1 ] =  "NZGD2000 / Marlborough Circuit 2000";
-projections[  122 ][ 0 ] =  "2121";		projections[  122 ][ 1 ] =  "NZGD2000 / Hokitika Circuit 2000";
-projections[  123 ][ 0 ] =  "2122";		projections[  123 ][ 1 ] =  "NZGD2000 / Okarito Circuit 2000";
-projections[  124 ][ 0 ] =  "2123";		projections[  124 ][ 1 ] =  "NZGD2000 / Jacksons Bay Circuit 2000";
-projections[  125 ][ 0 ] =  "2124";		projections[  125 ][ 1 ] =  "NZGD2000 / Mount Pleasant Circuit 2000";
-projections[  126 ][ 0 ] =  "2125";		projections[  126 ][ 1 ] =  "NZGD2000 / Gawler Circuit 2000";
-projections[  127 ][ 0 ] =  "2126";		projections[  127 ][ 1 ] =  "NZGD2000 / Timaru Circuit 2000";
-projections[  128 ][ 0 ] =  "2127";		projections[  128 ][ 1 ] =  "NZGD2000 / Lindis Peak Circuit 2000";
-projections[  129 ][ 0 ] =  "2128";		projections[  129 ][ 1 ] =  "NZGD2000 / Mount Nicholas Circuit 2000";
-projections[  130 ][ 0 ] =  "2129";		projections[  130 ][ 1 ] =  "NZGD2000 / Mount York Circuit 2000";
-projections[  131 ][ 0 ] =  "2130";		projections[  131 ][ 1 ] =  "NZGD2000 / Observation Point Circuit 2000";
-projections[  132 ][ 0 ] =  "2131";		projections[  132 ][ 1 ] =  "NZGD2000 / North Taieri Circuit 2000";
-projections[  133 ][ 0 ] =  "2132";		projections[  133 ][ 1 ] =  "NZGD2000 / Bluff Circuit 2000";
-projections[  134 ][ 0 ] =  "2133";		projections[  134 ][ 1 ] =  "NZGD2000 / UTM zone 58S";
-projections[  135 ][ 0 ] =  "2134";		projections[  135 ][ 1 ] =  "NZGD2000 / UTM zone 59S";
-projections[  136 ][ 0 ] =  "2135";		projections[  136 ][ 1 ] =  "NZGD2000 / UTM zone 60S";
-projections[  137 ][ 0 ] =  "2136";		projections[  137 ][ 1 ] =  "Accra / Ghana National Grid";
-projections[  138 ][ 0 ] =  "2137";		projections[  138 ][ 1 ] =  "Accra / TM 1 NW";
-projections[  139 ][ 0 ] =  "2138";		projections[  139 ][ 1 ] =  "NAD27(CGQ77) / Quebec Lambert";
-projections[  140 ][ 0 ] =  "2139";		projections[  140 ][ 1 ] =  "NAD83(CSRS98) / SCoPQ zone 2";
-projections[  141 ][ 0 ] =  "2140";		projections[  141 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 3";
-projections[  142 ][ 0 ] =  "2141";		projections[  142 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 4";
-projections[  143 ][ 0 ] =  "2142";		projections[  143 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 5";
-projections[  144 ][ 0 ] =  "2143";		projections[  144 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 6";
-projections[  145 ][ 0 ] =  "2144";		projections[  145 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 7";
-projections[  146 ][ 0 ] =  "2145";		projections[  146 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 8";
-projections[  147 ][ 0 ] =  "2146";		projections[  147 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 9";
-projections[  148 ][ 0 ] =  "2147";		projections[  148 ][ 1 ] =  "NAD83(CSRS98) / MTM zone 10";
-projections[  149 ][ 0 ] =  "2148";		projections[  149 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 21N";
-projections[  150 ][ 0 ] =  "2149";		projections[  150 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 18N";
-projections[  151 ][ 0 ] =  "2150";		projections[  151 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 17N";
-projections[  152 ][ 0 ] =  "2151";		projections[  152 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 13N";
-projections[  153 ][ 0 ] =  "2152";		projections[  153 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 12N";
-projections[  154 ][ 0 ] =  "2153";		projections[  154 ][ 1 ] =  "NAD83(CSRS98) / UTM zone 11N";
-projections[  155 ][ 0 ] =  "2154";		projections[  155 ][ 1 ] =  "RGF93 / Lambert-93";
-projections[  156 ][ 0 ] =  "2155";		projections[  156 ][ 1 ] =  "American Samoa 1962 / American Samoa Lambert";
-projections[  157 ][ 0 ] =  "2156";		projections[  157 ][ 1 ] =  "NAD83(HARN) / UTM zone 59S";
-projections[  158 ][ 0 ] =  "2157";		projections[  158 ][ 1 ] =  "IRENET95 / Irish Transverse Mercator";
-projections[  159 ][ 0 ] =  "2158";		projections[  159 ][ 1 ] =  "IRENET95 / UTM zone 29N";
-projections[  160 ][ 0 ] =  "2159";		projections[  160 ][ 1 ] =  "Sierra Leone 1924 / New Colony Grid";
-projections[  161 ][ 0 ] =  "2160";		projections[  161 ][ 1 ] =  "Sierra Leone 1924 / New War Office Grid";
-projections[  162 ][ 0 ] =  "2161";		projections[  162 ][ 1 ] =  "Sierra Leone 1968 / UTM zone 28N";
-projections[  163 ][ 0 ] =  "2162";		projections[  163 ][ 1 ] =  "Sierra Leone 1968 / UTM zone 29N";
-projections[  164 ][ 0 ] =  "2163";		projections[  164 ][ 1 ] =  "US National Atlas Equal Area";
-projections[  165 ][ 0 ] =  "2164";		projections[  165 ][ 1 ] =  "Locodjo 1965 / TM 5 NW";
-projections[  166 ][ 0 ] =  "2165";		projections[  166 ][ 1 ] =  "Abidjan 1987 / TM 5 NW";
-projections[  167 ][ 0 ] =  "2166";		projections[  167 ][ 1 ] =  "Pulkovo 1942(83) / Gauss Kruger zone 3";
-projections[  168 ][ 0 ] =  "2167";		projections[  168 ][ 1 ] =  "Pulkovo 1942(83) / Gauss Kruger zone 4";
-projections[  169 ][ 0 ] =  "2168";		projections[  169 ][ 1 ] =  "Pulkovo 1942(83) / Gauss Kruger zone 5";
-projections[  170 ][ 0 ] =  "2169";		projections[  170 ][ 1 ] =  "Luxembourg 1930 / Gauss";
-projections[  171 ][ 0 ] =  "2170";		projections[  171 ][ 1 ] =  "MGI / Slovenia Grid";
-projections[  172 ][ 0 ] =  "2171";		projections[  172 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone I";
-projections[  173 ][ 0 ] =  "2172";		projections[  173 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone II";
-projections[  174 ][ 0 ] =  "2173";		projections[  174 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone III";
-projections[  175 ][ 0 ] =  "2174";		projections[  175 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone IV";
-projections[  176 ][ 0 ] =  "2175";		projections[  176 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone V";
-projections[  177 ][ 0 ] =  "2176";		projections[  177 ][ 1 ] =  "ETRS89 / Poland CS2000 zone 5";
-projections[  178 ][ 0 ] =  "2177";		projections[  178 ][ 1 ] =  "ETRS89 / Poland CS2000 zone 6";
-projections[  179 ][ 0 ] =  "2178";		projections[  179 ][ 1 ] =  "ETRS89 / Poland CS2000 zone 7";
-projections[  180 ][ 0 ] =  "2179";		projections[  180 ][ 1 ] =  "ETRS89 / Poland CS2000 zone 8";
-projections[  181 ][ 0 ] =  "2180";		projections[  181 ][ 1 ] =  "ETRS89 / Poland CS92";
-projections[  182 ][ 0 ] =  "2188";		projections[  182 ][ 1 ] =  "Azores Occidental 1939 / UTM zone 25N";
-projections[  183 ][ 0 ] =  "2189";		projections[  183 ][ 1 ] =  "Azores Central 1948 / UTM zone 26N";
-projections[  184 ][ 0 ] =  "2190";		projections[  184 ][ 1 ] =  "Azores Oriental 1940 / UTM zone 26N";
-projections[  185 ][ 0 ] =  "2191";		projections[  185 ][ 1 ] =  "Madeira 1936 / UTM zone 28N";
-projections[  186 ][ 0 ] =  "2192";		projections[  186 ][ 1 ] =  "ED50 / France EuroLambert";
-projections[  187 ][ 0 ] =  "2193";		projections[  187 ][ 1 ] =  "NZGD2000 / New Zealand Transverse Mercator";
-projections[  188 ][ 0 ] =  "2194";		projections[  188 ][ 1 ] =  "American Samoa 1962 / American Samoa Lambert";
-projections[  189 ][ 0 ] =  "2195";		projections[  189 ][ 1 ] =  "NAD83(HARN) / UTM zone 2S";
-projections[  190 ][ 0 ] =  "2196";		projections[  190 ][ 1 ] =  "ETRS89 / Kp2000 Jutland";
-projections[  191 ][ 0 ] =  "2197";		projections[  191 ][ 1 ] =  "ETRS89 / Kp2000 Zealand";
-projections[  192 ][ 0 ] =  "2198";		projections[  192 ][ 1 ] =  "ETRS89 / Kp2000 Bornholm";
-projections[  193 ][ 0 ] =  "2199";		projections[  193 ][ 1 ] =  "Albanian 1987 / Gauss Kruger zone 4";
-projections[  194 ][ 0 ] =  "2200";		projections[  194 ][ 1 ] =  "ATS77 / New Brunswick Stereographic (ATS77)";
-projections[  195 ][ 0 ] =  "2201";		projections[  195 ][ 1 ] =  "REGVEN / UTM zone 18N";
-projections[  196 ][ 0 ] =  "2202";		projections[  196 ][ 1 ] =  "REGVEN / UTM zone 19N";
-projections[  197 ][ 0 ] =  "2203";		projections[  197 ][ 1 ] =  "REGVEN / UTM zone 20N";
-projections[  198 ][ 0 ] =  "2204";		projections[  198 ][ 1 ] =  "NAD27 / Tennessee";
-projections[  199 ][ 0 ] =  "2205";		projections[  199 ][ 1 ] =  "NAD83 / Kentucky North";
-projections[  200 ][ 0 ] =  "2206";		projections[  200 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 9";
-projections[  201 ][ 0 ] =  "2207";		projections[  201 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 10";
-projections[  202 ][ 0 ] =  "2208";		projections[  202 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 11";
-projections[  203 ][ 0 ] =  "2209";		projections[  203 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 12";
-projections[  204 ][ 0 ] =  "2210";		projections[  204 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 13";
-projections[  205 ][ 0 ] =  "2211";		projections[  205 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 14";
-projections[  206 ][ 0 ] =  "2212";		projections[  206 ][ 1 ] =  "ED50 / 3-degree Gauss-Kruger zone 15";
-projections[  207 ][ 0 ] =  "2213";		projections[  207 ][ 1 ] =  "ETRS89 / TM 30 NE";
-projections[  208 ][ 0 ] =  "2214";		projections[  208 ][ 1 ] =  "Douala 1948 / AOF west";
-projections[  209 ][ 0 ] =  "2215";		projections[  209 ][ 1 ] =  "Manoca 1962 / UTM zone 32N";
-projections[  210 ][ 0 ] =  "2216";		projections[  210 ][ 1 ] =  "Qornoq 1927 / UTM zone 22N";
-projections[  211 ][ 0 ] =  "2217";		projections[  211 ][ 1 ] =  "Qornoq 1927 / UTM zone 23N";
-projections[  212 ][ 0 ] =  "2218";		projections[  212 ][ 1 ] =  "Scoresbysund 1952 / Greenland zone 5 east";
-projections[  213 ][ 0 ] =  "2219";		projections[  213 ][ 1 ] =  "ATS77 / UTM zone 19N";
-projections[  214 ][ 0 ] =  "2220";		projections[  214 ][ 1 ] =  "ATS77 / UTM zone 20N";
-projections[  215 ][ 0 ] =  "2221";		projections[  215 ][ 1 ] =  "Scoresbysund 1952 / Greenland zone 6 east";
-projections[  216 ][ 0 ] =  "2222";		projections[  216 ][ 1 ] =  "NAD83 / Arizona East (ft)";
-projections[  217 ][ 0 ] =  "2223";		projections[  217 ][ 1 ] =  "NAD83 / Arizona Central (ft)";
-projections[  218 ][ 0 ] =  "2224";		projections[  218 ][ 1 ] =  "NAD83 / Arizona West (ft)";
-projections[  219 ][ 0 ] =  "2225";		projections[  219 ][ 1 ] =  "NAD83 / California zone 1 (ftUS)";
-projections[  220 ][ 0 ] =  "2226";		projections[  220 ][ 1 ] =  "NAD83 / California zone 2 (ftUS)";
-projections[  221 ][ 0 ] =  "2227";		projections[  221 ][ 1 ] =  "NAD83 / California zone 3 (ftUS)";
-projections[  222 ][ 0 ] =  "2228";		projections[  222 ][ 1 ] =  "NAD83 / California zone 4 (ftUS)";
-projections[  223 ][ 0 ] =  "2229";		projections[  223 ][ 1 ] =  "NAD83 / California zone 5 (ftUS)";
-projections[  224 ][ 0 ] =  "2230";		projections[  224 ][ 1 ] =  "NAD83 / California zone 6 (ftUS)";
-projections[  225 ][ 0 ] =  "2231";		projections[  225 ][ 1 ] =  "NAD83 / Colorado North (ftUS)";
-projections[  226 ][ 0 ] =  "2232";		projections[  226 ][ 1 ] =  "NAD83 / Colorado Central (ftUS)";
-projections[  227 ][ 0 ] =  "2233";		projections[  227 ][ 1 ] =  "NAD83 / Colorado South (ftUS)";
-projections[  228 ][ 0 ] =  "2234";		projections[  228 ][ 1 ] =  "NAD83 / Connecticut (ftUS)";
-projections[  229 ][ 0 ] =  "2235";		projections[  229 ][ 1 ] =  "NAD83 / Delaware (ftUS)";
-projections[  230 ][ 0 ] =  "2236";		projections[  230 ][ 1 ] =  "NAD83 / Florida East (ftUS)";
-projections[  231 ][ 0 ] =  "2237";		projections[  231 ][ 1 ] =  "NAD83 / Florida West (ftUS)";
-projections[  232 ][ 0 ] =  "2238";		projections[  232 ][ 1 ] =  "NAD83 / Florida North (ftUS)";
-projections[  233 ][ 0 ] =  "2239";		projections[  233 ][ 1 ] =  "NAD83 / Georgia East (ftUS)";
-projections[  234 ][ 0 ] =  "2240";		projections[  234 ][ 1 ] =  "NAD83 / Georgia West (ftUS)";
-projections[  235 ][ 0 ] =  "2241";		projections[  235 ][ 1 ] =  "NAD83 / Idaho East (ftUS)";
-projections[  236 ][ 0 ] =  "2242";		projections[  236 ][ 1 ] =  "NAD83 / Idaho Central (ftUS)";
-projections[  237 ][ 0 ] =  "2243";		projections[  237 ][ 1 ] =  "NAD83 / Idaho West (ftUS)";
-projections[  238 ][ 0 ] =  "2244";		projections[  238 ][ 1 ] =  "NAD83 / Indiana East (ftUS)";
-projections[  239 ][ 0 ] =  "2245";		projections[  239 ][ 1 ] =  "NAD83 / Indiana West (ftUS)";
-projections[  240 ][ 0 ] =  "2246";		projections[  240 ][ 1 ] =  "NAD83 / Kentucky North (ftUS)";
-projections[  241 ][ 0 ] =  "2247";		projections[  241 ][ 1 ] =  "NAD83 / Kentucky South (ftUS)";
-projections[  242 ][ 0 ] =  "2248";		projections[  242 ][ 1 ] =  "NAD83 / Maryland (ftUS)";
-projections[  243 ][ 0 ] =  "2249";		projections[  243 ][ 1 ] =  "NAD83 / Massachusetts Mainland (ftUS)";
-projections[  244 ][ 0 ] =  "2250";		projections[  244 ][ 1 ] =  "NAD83 / Massachusetts Island (ftUS)";
-projections[  245 ][ 0 ] =  "2251";		projections[  245 ][ 1 ] =  "NAD83 / Michigan North (ft)";
-projections[  246 ][ 0 ] =  "2252";		projections[  246 ][ 1 ] =  "NAD83 / Michigan Central (ft)";
-projections[  247 ][ 0 ] =  "2253";		projections[  247 ][ 1 ] =  "NAD83 / Michigan South (ft)";
-projections[  248 ][ 0 ] =  "2254";		projections[  248 ][ 1 ] =  "NAD83 / Mississippi East (ftUS)";
-projections[  249 ][ 0 ] =  "2255";		projections[  249 ][ 1 ] =  "NAD83 / Mississippi West (ftUS)";
-projections[  250 ][ 0 ] =  "2256";		projections[  250 ][ 1 ] =  "NAD83 / Montana (ft)";
-projections[  251 ][ 0 ] =  "2257";		projections[  251 ][ 1 ] =  "NAD83 / New Mexico East (ftUS)";
-projections[  252 ][ 0 ] =  "2258";		projections[  252 ][ 1 ] =  "NAD83 / New Mexico Central (ftUS)";
-projections[  253 ][ 0 ] =  "2259";		projections[  253 ][ 1 ] =  "NAD83 / New Mexico West (ftUS)";
-projections[  254 ][ 0 ] =  "2260";		projections[  254 ][ 1 ] =  "NAD83 / New York East (ftUS)";
-projections[  255 ][ 0 ] =  "2261";		projections[  255 ][ 1 ] =  "NAD83 / New York Central (ftUS)";
-projections[  256 ][ 0 ] =  "2262";		projections[  256 ][ 1 ] =  "NAD83 / New York West (ftUS)";
-projections[  257 ][ 0 ] =  "2263";		projections[  257 ][ 1 ] =  "NAD83 / New York Long Island (ftUS)";
-projections[  258 ][ 0 ] =  "2264";		projections[  258 ][ 1 ] =  "NAD83 / North Carolina (ftUS)";
-projections[  259 ][ 0 ] =  "2265";		projections[  259 ][ 1 ] =  "NAD83 / North Dakota North (ft)";
-projections[  260 ][ 0 ] =  "2266";		projections[  260 ][ 1 ] =  "NAD83 / North Dakota South (ft)";
-projections[  261 ][ 0 ] =  "2267";		projections[  261 ][ 1 ] =  "NAD83 / Oklahoma North (ftUS)";
-projections[  262 ][ 0 ] =  "2268";		projections[  262 ][ 1 ] =  "NAD83 / Oklahoma South (ftUS)";
-projections[  263 ][ 0 ] =  "2269";		projections[  263 ][ 1 ] =  "NAD83 / Oregon North (ft)";
-projections[  264 ][ 0 ] =  "2270";		projections[  264 ][ 1 ] =  "NAD83 / Oregon South (ft)";
-projections[  265 ][ 0 ] =  "2271";		projections[  265 ][ 1 ] =  "NAD83 / Pennsylvania North (ftUS)";
-projections[  266 ][ 0 ] =  "2272";		projections[  266 ][ 1 ] =  "NAD83 / Pennsylvania South (ftUS)";
-projections[  267 ][ 0 ] =  "2273";		projections[  267 ][ 1 ] =  "NAD83 / South Carolina (ft)";
-projections[  268 ][ 0 ] =  "2274";		projections[  268 ][ 1 ] =  "NAD83 / Tennessee (ftUS)";
-projections[  269 ][ 0 ] =  "2275";		projections[  269 ][ 1 ] =  "NAD83 / Texas North (ftUS)";
-projections[  270 ][ 0 ] =  "2276";		projections[  270 ][ 1 ] =  "NAD83 / Texas North Central (ftUS)";
-projections[  271 ][ 0 ] =  "2277";		projections[  271 ][ 1 ] =  "NAD83 / Texas Central (ftUS)";
-projections[  272 ][ 0 ] =  "2278";		projections[  272 ][ 1 ] =  "NAD83 / Texas South Central (ftUS)";
-projections[  273 ][ 0 ] =  "2279";		projections[  273 ][ 1 ] =  "NAD83 / Texas South (ftUS)";
-projections[  274 ][ 0 ] =  "2280";		projections[  274 ][ 1 ] =  "NAD83 / Utah North (ft)";
-projections[  275 ][ 0 ] =  "2281";		projections[  275 ][ 1 ] =  "NAD83 / Utah Central (ft)";
-projections[  276 ][ 0 ] =  "2282";		projections[  276 ][ 1 ] =  "NAD83 / Utah South (ft)";
-projections[  277 ][ 0 ] =  "2283";		projections[  277 ][ 1 ] =  "NAD83 / Virginia North (ftUS)";
-projections[  278 ][ 0 ] =  "2284";		projections[  278 ][ 1 ] =  "NAD83 / Virginia South (ftUS)";
-projections[  279 ][ 0 ] =  "2285";		projections[  279 ][ 1 ] =  "NAD83 / Washington North (ftUS)";
-projections[  280 ][ 0 ] =  "2286";		projections[  280 ][ 1 ] =  "NAD83 / Washington South (ftUS)";
-projections[  281 ][ 0 ] =  "2287";		projections[  281 ][ 1 ] =  "NAD83 / Wisconsin North (ftUS)";
-projections[  282 ][ 0 ] =  "2288";		projections[  282 ][ 1 ] =  "NAD83 / Wisconsin Central (ftUS)";
-projections[  283 ][ 0 ] =  "2289";		projections[  283 ][ 1 ] =  "NAD83 / Wisconsin South (ftUS)";
-projections[  284 ][ 0 ] =  "2290";		projections[  284 ][ 1 ] =  "ATS77 / Prince Edward Isl. Stereographic";
-projections[  285 ][ 0 ] =  "2291";		projections[  285 ][ 1 ] =  "NAD83(CSRS98) / Prince Edward Isl. Stereographic";
-projections[  286 ][ 0 ] =  "2292";		projections[  286 ][ 1 ] =  "NAD83(CSRS98) / Prince Edward Isl. Stereographic";
-projections[  287 ][ 0 ] =  "2294";		projections[  287 ][ 1 ] =  "ATS77 / MTM Nova Scotia zone 4";
-projections[  288 ][ 0 ] =  "2295";		projections[  288 ][ 1 ] =  "ATS77 / MTM Nova Scotia zone 5";
-projections[  289 ][ 0 ] =  "2296";		projections[  289 ][ 1 ] =  "Ammassalik 1958 / Greenland zone 7 east";
-projections[  290 ][ 0 ] =  "2297";		projections[  290 ][ 1 ] =  "Qornoq 1927 / Greenland zone 1 east";
-projections[  291 ][ 0 ] =  "2298";		projections[  291 ][ 1 ] =  "Qornoq 1927 / Greenland zone 2 east";
-projections[  292 ][ 0 ] =  "2299";		projections[  292 ][ 1 ] =  "Qornoq 1927 / Greenland zone 2 west";
-projections[  293 ][ 0 ] =  "2300";		projections[  293 ][ 1 ] =  "Qornoq 1927 / Greenland zone 3 east";
-projections[  294 ][ 0 ] =  "2301";		projections[  294 ][ 1 ] =  "Qornoq 1927 / Greenland zone 3 west";
-projections[  295 ][ 0 ] =  "2302";		projections[  295 ][ 1 ] =  "Qornoq 1927 / Greenland zone 4 east";
-projections[  296 ][ 0 ] =  "2303";		projections[  296 ][ 1 ] =  "Qornoq 1927 / Greenland zone 4 west";
-projections[  297 ][ 0 ] =  "2304";		projections[  297 ][ 1 ] =  "Qornoq 1927 / Greenland zone 5 west";
-projections[  298 ][ 0 ] =  "2305";		projections[  298 ][ 1 ] =  "Qornoq 1927 / Greenland zone 6 west";
-projections[  299 ][ 0 ] =  "2306";		projections[  299 ][ 1 ] =  "Qornoq 1927 / Greenland zone 7 west";
-projections[  300 ][ 0 ] =  "2307";		projections[  300 ][ 1 ] =  "Qornoq 1927 / Greenland zone 8 east";
-projections[  301 ][ 0 ] =  "2308";		projections[  301 ][ 1 ] =  "Batavia / TM 109 SE";
-projections[  302 ][ 0 ] =  "2309";		projections[  302 ][ 1 ] =  "WGS 84 / TM 116 SE";
-projections[  303 ][ 0 ] =  "2310";		projections[  303 ][ 1 ] =  "WGS 84 / TM 132 SE";
-projections[  304 ][ 0 ] =  "2311";		projections[  304 ][ 1 ] =  "WGS 84 / TM 6 NE";
-projections[  305 ][ 0 ] =  "2312";		projections[  305 ][ 1 ] =  "Garoua / UTM zone 33N";
-projections[  306 ][ 0 ] =  "2313";		projections[  306 ][ 1 ] =  "Kousseri / UTM zone 33N";
-projections[  307 ][ 0 ] =  "2314";		projections[  307 ][ 1 ] =  "Trinidad 1903 / Trinidad Grid (ftCla)";
-projections[  308 ][ 0 ] =  "2315";		projections[  308 ][ 1 ] =  "Campo Inchauspe / UTM zone 19S";
-projections[  309 ][ 0 ] =  "2316";		projections[  309 ][ 1 ] =  "Campo Inchauspe / UTM zone 20S";
-projections[  310 ][ 0 ] =  "2317";		projections[  310 ][ 1 ] =  "PSAD56 / ICN Regional";
-projections[  311 ][ 0 ] =  "2318";		projections[  311 ][ 1 ] =  "Ain el Abd / Aramco Lambert";
-projections[  312 ][ 0 ] =  "2319";		projections[  312 ][ 1 ] =  "ED50 / TM27";
-projections[  313 ][ 0 ] =  "2320";		projections[  313 ][ 1 ] =  "ED50 / TM30";
-projections[  314 ][ 0 ] =  "2321";		projections[  314 ][ 1 ] =  "ED50 / TM33";
-projections[  315 ][ 0 ] =  "2322";		projections[  315 ][ 1 ] =  "ED50 / TM36";
-projections[  316 ][ 0 ] =  "2323";		projections[  316 ][ 1 ] =  "ED50 / TM39";
-projections[  317 ][ 0 ] =  "2324";		projections[  317 ][ 1 ] =  "ED50 / TM42";
-projections[  318 ][ 0 ] =  "2325";		projections[  318 ][ 1 ] =  "ED50 / TM45";
-projections[  319 ][ 0 ] =  "2326";		projections[  319 ][ 1 ] =  "Hong Kong 1980 Grid System";
-projections[  320 ][ 0 ] =  "2327";		projections[  320 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 13";
-projections[  321 ][ 0 ] =  "2328";		projections[  321 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 14";
-projections[  322 ][ 0 ] =  "2329";		projections[  322 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 15";
-projections[  323 ][ 0 ] =  "2330";		projections[  323 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 16";
-projections[  324 ][ 0 ] =  "2331";		projections[  324 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 17";
-projections[  325 ][ 0 ] =  "2332";		projections[  325 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 18";
-projections[  326 ][ 0 ] =  "2333";		projections[  326 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 19";
-projections[  327 ][ 0 ] =  "2334";		projections[  327 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 20";
-projections[  328 ][ 0 ] =  "2335";		projections[  328 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 21";
-projections[  329 ][ 0 ] =  "2336";		projections[  329 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 22";
-projections[  330 ][ 0 ] =  "2337";		projections[  330 ][ 1 ] =  "Xian 1980 / Gauss-Kruger zone 23";
-projections[  331 ][ 0 ] =  "2338";		projections[  331 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 75E";
-projections[  332 ][ 0 ] =  "2339";		projections[  332 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 81E";
-projections[  333 ][ 0 ] =  "2340";		projections[  333 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 87E";
-projections[  334 ][ 0 ] =  "2341";		projections[  334 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 93E";
-projections[  335 ][ 0 ] =  "2342";		projections[  335 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 99E";
-projections[  336 ][ 0 ] =  "2343";		projections[  336 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 105E";
-projections[  337 ][ 0 ] =  "2344";		projections[  337 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 111E";
-projections[  338 ][ 0 ] =  "2345";		projections[  338 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 117E";
-projections[  339 ][ 0 ] =  "2346";		projections[  339 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 123E";
-projections[  340 ][ 0 ] =  "2347";		projections[  340 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 129E";
-projections[  341 ][ 0 ] =  "2348";		projections[  341 ][ 1 ] =  "Xian 1980 / Gauss-Kruger CM 135E";
-projections[  342 ][ 0 ] =  "2349";		projections[  342 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 25";
-projections[  343 ][ 0 ] =  "2350";		projections[  343 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 26";
-projections[  344 ][ 0 ] =  "2351";		projections[  344 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 27";
-projections[  345 ][ 0 ] =  "2352";		projections[  345 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 28";
-projections[  346 ][ 0 ] =  "2353";		projections[  346 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 29";
-projections[  347 ][ 0 ] =  "2354";		projections[  347 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 30";
-projections[  348 ][ 0 ] =  "2355";		projections[  348 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 31";
-projections[  349 ][ 0 ] =  "2356";		projections[  349 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 32";
-projections[  350 ][ 0 ] =  "2357";		projections[  350 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 33";
-projections[  351 ][ 0 ] =  "2358";		projections[  351 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 34";
-projections[  352 ][ 0 ] =  "2359";		projections[  352 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 35";
-projections[  353 ][ 0 ] =  "2360";		projections[  353 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 36";
-projections[  354 ][ 0 ] =  "2361";		projections[  354 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 37";
-projections[  355 ][ 0 ] =  "2362";		projections[  355 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 38";
-projections[  356 ][ 0 ] =  "2363";		projections[  356 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 39";
-projections[  357 ][ 0 ] =  "2364";		projections[  357 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 40";
-projections[  358 ][ 0 ] =  "2365";		projections[  358 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 41";
-projections[  359 ][ 0 ] =  "2366";		projections[  359 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 42";
-projections[  360 ][ 0 ] =  "2367";		projections[  360 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 43";
-projections[  361 ][ 0 ] =  "2368";		projections[  361 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 44";
-projections[  362 ][ 0 ] =  "2369";		projections[  362 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger zone 45";
-projections[  363 ][ 0 ] =  "2370";		projections[  363 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 75E";
-projections[  364 ][ 0 ] =  "2371";		projections[  364 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 78E";
-projections[  365 ][ 0 ] =  "2372";		projections[  365 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 81E";
-projections[  366 ][ 0 ] =  "2373";		projections[  366 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 84E";
-projections[  367 ][ 0 ] =  "2374";		projections[  367 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 87E";
-projections[  368 ][ 0 ] =  "2375";		projections[  368 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 90E";
-projections[  369 ][ 0 ] =  "2376";		projections[  369 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 93E";
-projections[  370 ][ 0 ] =  "2377";		projections[  370 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 96E";
-projections[  371 ][ 0 ] =  "2378";		projections[  371 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 99E";
-projections[  372 ][ 0 ] =  "2379";		projections[  372 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 102E";
-projections[  373 ][ 0 ] =  "2380";		projections[  373 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 105E";
-projections[  374 ][ 0 ] =  "2381";		projections[  374 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 108E";
-projections[  375 ][ 0 ] =  "2382";		projections[  375 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 111E";
-projections[  376 ][ 0 ] =  "2383";		projections[  376 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 114E";
-projections[  377 ][ 0 ] =  "2384";		projections[  377 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 117E";
-projections[  378 ][ 0 ] =  "2385";		projections[  378 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 120E";
-projections[  379 ][ 0 ] =  "2386";		projections[  379 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 123E";
-projections[  380 ][ 0 ] =  "2387";		projections[  380 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 126E";
-projections[  381 ][ 0 ] =  "2388";		projections[  381 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 129E";
-projections[  382 ][ 0 ] =  "2389";		projections[  382 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 132E";
-projections[  383 ][ 0 ] =  "2390";		projections[  383 ][ 1 ] =  "Xian 1980 / 3-degree Gauss-Kruger CM 135E";
-projections[  384 ][ 0 ] =  "2391";		projections[  384 ][ 1 ] =  "KKJ / Finland zone 1";
-projections[  385 ][ 0 ] =  "2392";		projections[  385 ][ 1 ] =  "KKJ / Finland zone 2";
-projections[  386 ][ 0 ] =  "2393";		projections[  386 ][ 1 ] =  "KKJ / Finland Uniform Coordinate System";
-projections[  387 ][ 0 ] =  "2394";		projections[  387 ][ 1 ] =  "KKJ / Finland zone 4";
-projections[  388 ][ 0 ] =  "2395";		projections[  388 ][ 1 ] =  "South Yemen / Gauss-Kruger zone 8";
-projections[  389 ][ 0 ] =  "2396";		projections[  389 ][ 1 ] =  "South Yemen / Gauss-Kruger zone 9";
-projections[  390 ][ 0 ] =  "2397";		projections[  390 ][ 1 ] =  "Pulkovo 1942(83) / Gauss-Kruger zone 3";
-projections[  391 ][ 0 ] =  "2398";		projections[  391 ][ 1 ] =  "Pulkovo 1942(83) / Gauss-Kruger zone 4";
-projections[  392 ][ 0 ] =  "2399";		projections[  392 ][ 1 ] =  "Pulkovo 1942(83) / Gauss-Kruger zone 5";
-projections[  393 ][ 0 ] =  "2400";		projections[  393 ][ 1 ] =  "RT90 2.5 gon W";
-projections[  394 ][ 0 ] =  "2401";		projections[  394 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 25";
-projections[  395 ][ 0 ] =  "2402";		projections[  395 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 26";
-projections[  396 ][ 0 ] =  "2403";		projections[  396 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 27";
-projections[  397 ][ 0 ] =  "2404";		projections[  397 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 28";
-projections[  398 ][ 0 ] =  "2405";		projections[  398 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 29";
-projections[  399 ][ 0 ] =  "2406";		projections[  399 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 30";
-projections[  400 ][ 0 ] =  "2407";		projections[  400 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 31";
-projections[  401 ][ 0 ] =  "2408";		projections[  401 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 32";
-projections[  402 ][ 0 ] =  "2409";		projections[  402 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 33";
-projections[  403 ][ 0 ] =  "2410";		projections[  403 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 34";
-projections[  404 ][ 0 ] =  "2411";		projections[  404 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 35";
-projections[  405 ][ 0 ] =  "2412";		projections[  405 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 36";
-projections[  406 ][ 0 ] =  "2413";		projections[  406 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 37";
-projections[  407 ][ 0 ] =  "2414";		projections[  407 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 38";
-projections[  408 ][ 0 ] =  "2415";		projections[  408 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 39";
-projections[  409 ][ 0 ] =  "2416";		projections[  409 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 40";
-projections[  410 ][ 0 ] =  "2417";		projections[  410 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 41";
-projections[  411 ][ 0 ] =  "2418";		projections[  411 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 42";
-projections[  412 ][ 0 ] =  "2419";		projections[  412 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 43";
-projections[  413 ][ 0 ] =  "2420";		projections[  413 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 44";
-projections[  414 ][ 0 ] =  "2421";		projections[  414 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger zone 45";
-projections[  415 ][ 0 ] =  "2422";		projections[  415 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 75E";
-projections[  416 ][ 0 ] =  "2423";		projections[  416 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 78E";
-projections[  417 ][ 0 ] =  "2424";		projections[  417 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 81E";
-projections[  418 ][ 0 ] =  "2425";		projections[  418 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 84E";
-projections[  419 ][ 0 ] =  "2426";		projections[  419 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 87E";
-projections[  420 ][ 0 ] =  "2427";		projections[  420 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 90E";
-projections[  421 ][ 0 ] =  "2428";		projections[  421 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 93E";
-projections[  422 ][ 0 ] =  "2429";		projections[  422 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 96E";
-projections[  423 ][ 0 ] =  "2430";		projections[  423 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 99E";
-projections[  424 ][ 0 ] =  "2431";		projections[  424 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 102E";
-projections[  425 ][ 0 ] =  "2432";		projections[  425 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 105E";
-projections[  426 ][ 0 ] =  "2433";		projections[  426 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 108E";
-projections[  427 ][ 0 ] =  "2434";		projections[  427 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 111E";
-projections[  428 ][ 0 ] =  "2435";		projections[  428 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 114E";
-projections[  429 ][ 0 ] =  "2436";		projections[  429 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 117E";
-projections[  430 ][ 0 ] =  "2437";		projections[  430 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 120E";
-projections[  431 ][ 0 ] =  "2438";		projections[  431 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 123E";
-projections[  432 ][ 0 ] =  "2439";		projections[  432 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 126E";
-projections[  433 ][ 0 ] =  "2440";		projections[  433 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 129E";
-projections[  434 ][ 0 ] =  "2441";		projections[  434 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 132E";
-projections[  435 ][ 0 ] =  "2442";		projections[  435 ][ 1 ] =  "Beijing 1954 / 3-degree Gauss-Kruger CM 135E";
-projections[  436 ][ 0 ] =  "2443";		projections[  436 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS I";
-projections[  437 ][ 0 ] =  "2444";		projections[  437 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS II";
-projections[  438 ][ 0 ] =  "2445";		projections[  438 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS III";
-projections[  439 ][ 0 ] =  "2446";		projections[  439 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS IV";
-projections[  440 ][ 0 ] =  "2447";		projections[  440 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS V";
-projections[  441 ][ 0 ] =  "2448";		projections[  441 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS VI";
-projections[  442 ][ 0 ] =  "2449";		projections[  442 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS VII";
-projections[  443 ][ 0 ] =  "2450";		projections[  443 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS VIII";
-projections[  444 ][ 0 ] =  "2451";		projections[  444 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS IX";
-projections[  445 ][ 0 ] =  "2452";		projections[  445 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS X";
-projections[  446 ][ 0 ] =  "2453";		projections[  446 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XI";
-projections[  447 ][ 0 ] =  "2454";		projections[  447 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XII";
-projections[  448 ][ 0 ] =  "2455";		projections[  448 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XIII";
-projections[  449 ][ 0 ] =  "2456";		projections[  449 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XIV";
-projections[  450 ][ 0 ] =  "2457";		projections[  450 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XV";
-projections[  451 ][ 0 ] =  "2458";		projections[  451 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XVI";
-projections[  452 ][ 0 ] =  "2459";		projections[  452 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XVII";
-projections[  453 ][ 0 ] =  "2460";		projections[  453 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XVIII";
-projections[  454 ][ 0 ] =  "2461";		projections[  454 ][ 1 ] =  "JGD2000 / Japan Plane Rectangular CS XIX";
-projections[  455 ][ 0 ] =  "2462";		projections[  455 ][ 1 ] =  "Albanian 1987 / Gauss-Kruger zone 4";
-projections[  456 ][ 0 ] =  "2463";		projections[  456 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 21E";
-projections[  457 ][ 0 ] =  "2464";		projections[  457 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 27E";
-projections[  458 ][ 0 ] =  "2465";		projections[  458 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 33E";
-projections[  459 ][ 0 ] =  "2466";		projections[  459 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 39E";
-projections[  460 ][ 0 ] =  "2467";		projections[  460 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 45E";
-projections[  461 ][ 0 ] =  "2468";		projections[  461 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 51E";
-projections[  462 ][ 0 ] =  "2469";		projections[  462 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 57E";
-projections[  463 ][ 0 ] =  "2470";		projections[  463 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 63E";
-projections[  464 ][ 0 ] =  "2471";		projections[  464 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 69E";
-projections[  465 ][ 0 ] =  "2472";		projections[  465 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 75E";
-projections[  466 ][ 0 ] =  "2473";		projections[  466 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 81E";
-projections[  467 ][ 0 ] =  "2474";		projections[  467 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 87E";
-projections[  468 ][ 0 ] =  "2475";		projections[  468 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 93E";
-projections[  469 ][ 0 ] =  "2476";		projections[  469 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 99E";
-projections[  470 ][ 0 ] =  "2477";		projections[  470 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 105E";
-projections[  471 ][ 0 ] =  "2478";		projections[  471 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 111E";
-projections[  472 ][ 0 ] =  "2479";		projections[  472 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 117E";
-projections[  473 ][ 0 ] =  "2480";		projections[  473 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 123E";
-projections[  474 ][ 0 ] =  "2481";		projections[  474 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 129E";
-projections[  475 ][ 0 ] =  "2482";		projections[  475 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 135E";
-projections[  476 ][ 0 ] =  "2483";		projections[  476 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 141E";
-projections[  477 ][ 0 ] =  "2484";		projections[  477 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 147E";
-projections[  478 ][ 0 ] =  "2485";		projections[  478 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 153E";
-projections[  479 ][ 0 ] =  "2486";		projections[  479 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 159E";
-projections[  480 ][ 0 ] =  "2487";		projections[  480 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 165E";
-projections[  481 ][ 0 ] =  "2488";		projections[  481 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 171E";
-projections[  482 ][ 0 ] =  "2489";		projections[  482 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 177E";
-projections[  483 ][ 0 ] =  "2490";		projections[  483 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 177W";
-projections[  484 ][ 0 ] =  "2491";		projections[  484 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger CM 171W";
-projections[  485 ][ 0 ] =  "2492";		projections[  485 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 9E";
-projections[  486 ][ 0 ] =  "2493";		projections[  486 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 15E";
-projections[  487 ][ 0 ] =  "2494";		projections[  487 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 21E";
-projections[  488 ][ 0 ] =  "2495";		projections[  488 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 27E";
-projections[  489 ][ 0 ] =  "2496";		projections[  489 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 33E";
-projections[  490 ][ 0 ] =  "2497";		projections[  490 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 39E";
-projections[  491 ][ 0 ] =  "2498";		projections[  491 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 45E";
-projections[  492 ][ 0 ] =  "2499";		projections[  492 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 51E";
-projections[  493 ][ 0 ] =  "2500";		projections[  493 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 57E";
-projections[  494 ][ 0 ] =  "2501";		projections[  494 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 63E";
-projections[  495 ][ 0 ] =  "2502";		projections[  495 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 69E";
-projections[  496 ][ 0 ] =  "2503";		projections[  496 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 75E";
-projections[  497 ][ 0 ] =  "2504";		projections[  497 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 81E";
-projections[  498 ][ 0 ] =  "2505";		projections[  498 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 87E";
-projections[  499 ][ 0 ] =  "2506";		projections[  499 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 93E";
-projections[  500 ][ 0 ] =  "2507";		projections[  500 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 99E";
-projections[  501 ][ 0 ] =  "2508";		projections[  501 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 105E";
-projections[  502 ][ 0 ] =  "2509";		projections[  502 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 111E";
-projections[  503 ][ 0 ] =  "2510";		projections[  503 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 117E";
-projections[  504 ][ 0 ] =  "2511";		projections[  504 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 123E";
-projections[  505 ][ 0 ] =  "2512";		projections[  505 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 129E";
-projections[  506 ][ 0 ] =  "2513";		projections[  506 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 135E";
-projections[  507 ][ 0 ] =  "2514";		projections[  507 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 141E";
-projections[  508 ][ 0 ] =  "2515";		projections[  508 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 147E";
-projections[  509 ][ 0 ] =  "2516";		projections[  509 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 153E";
-projections[  510 ][ 0 ] =  "2517";		projections[  510 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 159E";
-projections[  511 ][ 0 ] =  "2518";		projections[  511 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 165E";
-projections[  512 ][ 0 ] =  "2519";		projections[  512 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 171E";
-projections[  513 ][ 0 ] =  "2520";		projections[  513 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 177E";
-projections[  514 ][ 0 ] =  "2521";		projections[  514 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 177W";
-projections[  515 ][ 0 ] =  "2522";		projections[  515 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger CM 171W";
-projections[  516 ][ 0 ] =  "2523";		projections[  516 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 7";
-projections[  517 ][ 0 ] =  "2524";		projections[  517 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 8";
-projections[  518 ][ 0 ] =  "2525";		projections[  518 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 9";
-projections[  519 ][ 0 ] =  "2526";		projections[  519 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 10";
-projections[  520 ][ 0 ] =  "2527";		projections[  520 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 11";
-projections[  521 ][ 0 ] =  "2528";		projections[  521 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 12";
-projections[  522 ][ 0 ] =  "2529";		projections[  522 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 13";
-projections[  523 ][ 0 ] =  "2530";		projections[  523 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 14";
-projections[  524 ][ 0 ] =  "2531";		projections[  524 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 15";
-projections[  525 ][ 0 ] =  "2532";		projections[  525 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 16";
-projections[  526 ][ 0 ] =  "2533";		projections[  526 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 17";
-projections[  527 ][ 0 ] =  "2534";		projections[  527 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 18";
-projections[  528 ][ 0 ] =  "2535";		projections[  528 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 19";
-projections[  529 ][ 0 ] =  "2536";		projections[  529 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 20";
-projections[  530 ][ 0 ] =  "2537";		projections[  530 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 21";
-projections[  531 ][ 0 ] =  "2538";		projections[  531 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 22";
-projections[  532 ][ 0 ] =  "2539";		projections[  532 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 23";
-projections[  533 ][ 0 ] =  "2540";		projections[  533 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 24";
-projections[  534 ][ 0 ] =  "2541";		projections[  534 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 25";
-projections[  535 ][ 0 ] =  "2542";		projections[  535 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 26";
-projections[  536 ][ 0 ] =  "2543";		projections[  536 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 27";
-projections[  537 ][ 0 ] =  "2544";		projections[  537 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 28";
-projections[  538 ][ 0 ] =  "2545";		projections[  538 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 29";
-projections[  539 ][ 0 ] =  "2546";		projections[  539 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 30";
-projections[  540 ][ 0 ] =  "2547";		projections[  540 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 31";
-projections[  541 ][ 0 ] =  "2548";		projections[  541 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 32";
-projections[  542 ][ 0 ] =  "2549";		projections[  542 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 33";
-projections[  543 ][ 0 ] =  "2550";		projections[  543 ][ 1 ] =  "Samboja / UTM zone 50S";
-projections[  544 ][ 0 ] =  "2551";		projections[  544 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 34";
-projections[  545 ][ 0 ] =  "2552";		projections[  545 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 35";
-projections[  546 ][ 0 ] =  "2553";		projections[  546 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 36";
-projections[  547 ][ 0 ] =  "2554";		projections[  547 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 37";
-projections[  548 ][ 0 ] =  "2555";		projections[  548 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 38";
-projections[  549 ][ 0 ] =  "2556";		projections[  549 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 39";
-projections[  550 ][ 0 ] =  "2557";		projections[  550 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 40";
-projections[  551 ][ 0 ] =  "2558";		projections[  551 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 41";
-projections[  552 ][ 0 ] =  "2559";		projections[  552 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 42";
-projections[  553 ][ 0 ] =  "2560";		projections[  553 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 43";
-projections[  554 ][ 0 ] =  "2561";		projections[  554 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 44";
-projections[  555 ][ 0 ] =  "2562";		projections[  555 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 45";
-projections[  556 ][ 0 ] =  "2563";		projections[  556 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 46";
-projections[  557 ][ 0 ] =  "2564";		projections[  557 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 47";
-projections[  558 ][ 0 ] =  "2565";		projections[  558 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 48";
-projections[  559 ][ 0 ] =  "2566";		projections[  559 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 49";
-projections[  560 ][ 0 ] =  "2567";		projections[  560 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 50";
-projections[  561 ][ 0 ] =  "2568";		projections[  561 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 51";
-projections[  562 ][ 0 ] =  "2569";		projections[  562 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 52";
-projections[  563 ][ 0 ] =  "2570";		projections[  563 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 53";
-projections[  564 ][ 0 ] =  "2571";		projections[  564 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 54";
-projections[  565 ][ 0 ] =  "2572";		projections[  565 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 55";
-projections[  566 ][ 0 ] =  "2573";		projections[  566 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 56";
-projections[  567 ][ 0 ] =  "2574";		projections[  567 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 57";
-projections[  568 ][ 0 ] =  "2575";		projections[  568 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 58";
-projections[  569 ][ 0 ] =  "2576";		projections[  569 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 59";
-projections[  570 ][ 0 ] =  "2577";		projections[  570 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60";
-projections[  571 ][ 0 ] =  "2578";		projections[  571 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 61";
-projections[  572 ][ 0 ] =  "2579";		projections[  572 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 62";
-projections[  573 ][ 0 ] =  "2580";		projections[  573 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 63";
-projections[  574 ][ 0 ] =  "2581";		projections[  574 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 64";
-projections[  575 ][ 0 ] =  "2582";		projections[  575 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 21E";
-projections[  576 ][ 0 ] =  "2583";		projections[  576 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 24E";
-projections[  577 ][ 0 ] =  "2584";		projections[  577 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 27E";
-projections[  578 ][ 0 ] =  "2585";		projections[  578 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 30E";
-projections[  579 ][ 0 ] =  "2586";		projections[  579 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 33E";
-projections[  580 ][ 0 ] =  "2587";		projections[  580 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 36E";
-projections[  581 ][ 0 ] =  "2588";		projections[  581 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 39E";
-projections[  582 ][ 0 ] =  "2589";		projections[  582 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 42E";
-projections[  583 ][ 0 ] =  "2590";		projections[  583 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 45E";
-projections[  584 ][ 0 ] =  "2591";		projections[  584 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 48E";
-projections[  585 ][ 0 ] =  "2592";		projections[  585 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 51E";
-projections[  586 ][ 0 ] =  "2593";		projections[  586 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 54E";
-projections[  587 ][ 0 ] =  "2594";		projections[  587 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 57E";
-projections[  588 ][ 0 ] =  "2595";		projections[  588 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 60E";
-projections[  589 ][ 0 ] =  "2596";		projections[  589 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 63E";
-projections[  590 ][ 0 ] =  "2597";		projections[  590 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 66E";
-projections[  591 ][ 0 ] =  "2598";		projections[  591 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 69E";
-projections[  592 ][ 0 ] =  "2599";		projections[  592 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 72E";
-projections[  593 ][ 0 ] =  "2600";		projections[  593 ][ 1 ] =  "Lietuvos Koordinoei Sistema 1994";
-projections[  594 ][ 0 ] =  "2601";		projections[  594 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 75E";
-projections[  595 ][ 0 ] =  "2602";		projections[  595 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 78E";
-projections[  596 ][ 0 ] =  "2603";		projections[  596 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 81E";
-projections[  597 ][ 0 ] =  "2604";		projections[  597 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 84E";
-projections[  598 ][ 0 ] =  "2605";		projections[  598 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 87E";
-projections[  599 ][ 0 ] =  "2606";		projections[  599 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 90E";
-projections[  600 ][ 0 ] =  "2607";		projections[  600 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 93E";
-projections[  601 ][ 0 ] =  "2608";		projections[  601 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 96E";
-projections[  602 ][ 0 ] =  "2609";		projections[  602 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 99E";
-projections[  603 ][ 0 ] =  "2610";		projections[  603 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 102E";
-projections[  604 ][ 0 ] =  "2611";		projections[  604 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 105E";
-projections[  605 ][ 0 ] =  "2612";		projections[  605 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 108E";
-projections[  606 ][ 0 ] =  "2613";		projections[  606 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 111E";
-projections[  607 ][ 0 ] =  "2614";		projections[  607 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 114E";
-projections[  608 ][ 0 ] =  "2615";		projections[  608 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 117E";
-projections[  609 ][ 0 ] =  "2616";		projections[  609 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 120E";
-projections[  610 ][ 0 ] =  "2617";		projections[  610 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 123E";
-projections[  611 ][ 0 ] =  "2618";		projections[  611 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 126E";
-projections[  612 ][ 0 ] =  "2619";		projections[  612 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 129E";
-projections[  613 ][ 0 ] =  "2620";		projections[  613 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 132E";
-projections[  614 ][ 0 ] =  "2621";		projections[  614 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 135E";
-projections[  615 ][ 0 ] =  "2622";		projections[  615 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 138E";
-projections[  616 ][ 0 ] =  "2623";		projections[  616 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 141E";
-projections[  617 ][ 0 ] =  "2624";		projections[  617 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 144E";
-projections[  618 ][ 0 ] =  "2625";		projections[  618 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 147E";
-projections[  619 ][ 0 ] =  "2626";		projections[  619 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 150E";
-projections[  620 ][ 0 ] =  "2627";		projections[  620 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 153E";
-projections[  621 ][ 0 ] =  "2628";		projections[  621 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 156E";
-projections[  622 ][ 0 ] =  "2629";		projections[  622 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 159E";
-projections[  623 ][ 0 ] =  "2630";		projections[  623 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 162E";
-projections[  624 ][ 0 ] =  "2631";		projections[  624 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 165E";
-projections[  625 ][ 0 ] =  "2632";		projections[  625 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168E";
-projections[  626 ][ 0 ] =  "2633";		projections[  626 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171E";
-projections[  627 ][ 0 ] =  "2634";		projections[  627 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174E";
-projections[  628 ][ 0 ] =  "2635";		projections[  628 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177E";
-projections[  629 ][ 0 ] =  "2636";		projections[  629 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 180E";
-projections[  630 ][ 0 ] =  "2637";		projections[  630 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 177W";
-projections[  631 ][ 0 ] =  "2638";		projections[  631 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 174W";
-projections[  632 ][ 0 ] =  "2639";		projections[  632 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 171W";
-projections[  633 ][ 0 ] =  "2640";		projections[  633 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 168W";
-projections[  634 ][ 0 ] =  "2641";		projections[  634 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 7";
-projections[  635 ][ 0 ] =  "2642";		projections[  635 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 8";
-projections[  636 ][ 0 ] =  "2643";		projections[  636 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 9";
-projections[  637 ][ 0 ] =  "2644";		projections[  637 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 10";
-projections[  638 ][ 0 ] =  "2645";		projections[  638 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 11";
-projections[  639 ][ 0 ] =  "2646";		projections[  639 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 12";
-projections[  640 ][ 0 ] =  "2647";		projections[  640 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 13";
-projections[  641 ][ 0 ] =  "2648";		projections[  641 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 14";
-projections[  642 ][ 0 ] =  "2649";		projections[  642 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 15";
-projections[  643 ][ 0 ] =  "2650";		projections[  643 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 16";
-projections[  644 ][ 0 ] =  "2651";		projections[  644 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 17";
-projections[  645 ][ 0 ] =  "2652";		projections[  645 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 18";
-projections[  646 ][ 0 ] =  "2653";		projections[  646 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 19";
-projections[  647 ][ 0 ] =  "2654";		projections[  647 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 20";
-projections[  648 ][ 0 ] =  "2655";		projections[  648 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 21";
-projections[  649 ][ 0 ] =  "2656";		projections[  649 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 22";
-projections[  650 ][ 0 ] =  "2657";		projections[  650 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 23";
-projections[  651 ][ 0 ] =  "2658";		projections[  651 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 24";
-projections[  652 ][ 0 ] =  "2659";		projections[  652 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 25";
-projections[  653 ][ 0 ] =  "2660";		projections[  653 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 26";
-projections[  654 ][ 0 ] =  "2661";		projections[  654 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 27";
-projections[  655 ][ 0 ] =  "2662";		projections[  655 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 28";
-projections[  656 ][ 0 ] =  "2663";		projections[  656 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 29";
-projections[  657 ][ 0 ] =  "2664";		projections[  657 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 30";
-projections[  658 ][ 0 ] =  "2665";		projections[  658 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 31";
-projections[  659 ][ 0 ] =  "2666";		projections[  659 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 32";
-projections[  660 ][ 0 ] =  "2667";		projections[  660 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 33";
-projections[  661 ][ 0 ] =  "2668";		projections[  661 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 34";
-projections[  662 ][ 0 ] =  "2669";		projections[  662 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 35";
-projections[  663 ][ 0 ] =  "2670";		projections[  663 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 36";
-projections[  664 ][ 0 ] =  "2671";		projections[  664 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 37";
-projections[  665 ][ 0 ] =  "2672";		projections[  665 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 38";
-projections[  666 ][ 0 ] =  "2673";		projections[  666 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 39";
-projections[  667 ][ 0 ] =  "2674";		projections[  667 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 40";
-projections[  668 ][ 0 ] =  "2675";		projections[  668 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 41";
-projections[  669 ][ 0 ] =  "2676";		projections[  669 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 42";
-projections[  670 ][ 0 ] =  "2677";		projections[  670 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 43";
-projections[  671 ][ 0 ] =  "2678";		projections[  671 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 44";
-projections[  672 ][ 0 ] =  "2679";		projections[  672 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 45";
-projections[  673 ][ 0 ] =  "2680";		projections[  673 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 46";
-projections[  674 ][ 0 ] =  "2681";		projections[  674 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 47";
-projections[  675 ][ 0 ] =  "2682";		projections[  675 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 48";
-projections[  676 ][ 0 ] =  "2683";		projections[  676 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 49";
-projections[  677 ][ 0 ] =  "2684";		projections[  677 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 50";
-projections[  678 ][ 0 ] =  "2685";		projections[  678 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 51";
-projections[  679 ][ 0 ] =  "2686";		projections[  679 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 52";
-projections[  680 ][ 0 ] =  "2687";		projections[  680 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 53";
-projections[  681 ][ 0 ] =  "2688";		projections[  681 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 54";
-projections[  682 ][ 0 ] =  "2689";		projections[  682 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 55";
-projections[  683 ][ 0 ] =  "2690";		projections[  683 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 56";
-projections[  684 ][ 0 ] =  "2691";		projections[  684 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 57";
-projections[  685 ][ 0 ] =  "2692";		projections[  685 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 58";
-projections[  686 ][ 0 ] =  "2693";		projections[  686 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 59";
-projections[  687 ][ 0 ] =  "2694";		projections[  687 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60";
-projections[  688 ][ 0 ] =  "2695";		projections[  688 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 61";
-projections[  689 ][ 0 ] =  "2696";		projections[  689 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 62";
-projections[  690 ][ 0 ] =  "2697";		projections[  690 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 63";
-projections[  691 ][ 0 ] =  "2698";		projections[  691 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 64";
-projections[  692 ][ 0 ] =  "2699";		projections[  692 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 21E";
-projections[  693 ][ 0 ] =  "2700";		projections[  693 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 24E";
-projections[  694 ][ 0 ] =  "2701";		projections[  694 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 27E";
-projections[  695 ][ 0 ] =  "2702";		projections[  695 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 30E";
-projections[  696 ][ 0 ] =  "2703";		projections[  696 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 33E";
-projections[  697 ][ 0 ] =  "2704";		projections[  697 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 36E";
-projections[  698 ][ 0 ] =  "2705";		projections[  698 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 39E";
-projections[  699 ][ 0 ] =  "2706";		projections[  699 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 42E";
-projections[  700 ][ 0 ] =  "2707";		projections[  700 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 45E";
-projections[  701 ][ 0 ] =  "2708";		projections[  701 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 48E";
-projections[  702 ][ 0 ] =  "2709";		projections[  702 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 51E";
-projections[  703 ][ 0 ] =  "2710";		projections[  703 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 54E";
-projections[  704 ][ 0 ] =  "2711";		projections[  704 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 57E";
-projections[  705 ][ 0 ] =  "2712";		projections[  705 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 60E";
-projections[  706 ][ 0 ] =  "2713";		projections[  706 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 63E";
-projections[  707 ][ 0 ] =  "2714";		projections[  707 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 66E";
-projections[  708 ][ 0 ] =  "2715";		projections[  708 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 69E";
-projections[  709 ][ 0 ] =  "2716";		projections[  709 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 72E";
-projections[  710 ][ 0 ] =  "2717";		projections[  710 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 75E";
-projections[  711 ][ 0 ] =  "2718";		projections[  711 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 78E";
-projections[  712 ][ 0 ] =  "2719";		projections[  712 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 81E";
-projections[  713 ][ 0 ] =  "2720";		projections[  713 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 84E";
-projections[  714 ][ 0 ] =  "2721";		projections[  714 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 87E";
-projections[  715 ][ 0 ] =  "2722";		projections[  715 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 90E";
-projections[  716 ][ 0 ] =  "2723";		projections[  716 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 93E";
-projections[  717 ][ 0 ] =  "2724";		projections[  717 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 96E";
-projections[  718 ][ 0 ] =  "2725";		projections[  718 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 99E";
-projections[  719 ][ 0 ] =  "2726";		projections[  719 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 102E";
-projections[  720 ][ 0 ] =  "2727";		projections[  720 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 105E";
-projections[  721 ][ 0 ] =  "2728";		projections[  721 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 108E";
-projections[  722 ][ 0 ] =  "2729";		projections[  722 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 111E";
-projections[  723 ][ 0 ] =  "2730";		projections[  723 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 114E";
-projections[  724 ][ 0 ] =  "2731";		projections[  724 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 117E";
-projections[  725 ][ 0 ] =  "2732";		projections[  725 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 120E";
-projections[  726 ][ 0 ] =  "2733";		projections[  726 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 123E";
-projections[  727 ][ 0 ] =  "2734";		projections[  727 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 126E";
-projections[  728 ][ 0 ] =  "2735";		projections[  728 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 129E";
-projections[  729 ][ 0 ] =  "2736";		projections[  729 ][ 1 ] =  "Tete / UTM zone 36S";
-projections[  730 ][ 0 ] =  "2737";		projections[  730 ][ 1 ] =  "Tete / UTM zone 37S";
-projections[  731 ][ 0 ] =  "2738";		projections[  731 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 132E";
-projections[  732 ][ 0 ] =  "2739";		projections[  732 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 135E";
-projections[  733 ][ 0 ] =  "2740";		projections[  733 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 138E";
-projections[  734 ][ 0 ] =  "2741";		projections[  734 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 141E";
-projections[  735 ][ 0 ] =  "2742";		projections[  735 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 144E";
-projections[  736 ][ 0 ] =  "2743";		projections[  736 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 147E";
-projections[  737 ][ 0 ] =  "2744";		projections[  737 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 150E";
-projections[  738 ][ 0 ] =  "2745";		projections[  738 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 153E";
-projections[  739 ][ 0 ] =  "2746";		projections[  739 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 156E";
-projections[  740 ][ 0 ] =  "2747";		projections[  740 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 159E";
-projections[  741 ][ 0 ] =  "2748";		projections[  741 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 162E";
-projections[  742 ][ 0 ] =  "2749";		projections[  742 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 165E";
-projections[  743 ][ 0 ] =  "2750";		projections[  743 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168E";
-projections[  744 ][ 0 ] =  "2751";		projections[  744 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171E";
-projections[  745 ][ 0 ] =  "2752";		projections[  745 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174E";
-projections[  746 ][ 0 ] =  "2753";		projections[  746 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177E";
-projections[  747 ][ 0 ] =  "2754";		projections[  747 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 180E";
-projections[  748 ][ 0 ] =  "2755";		projections[  748 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 177W";
-projections[  749 ][ 0 ] =  "2756";		projections[  749 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 174W";
-projections[  750 ][ 0 ] =  "2757";		projections[  750 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 171W";
-projections[  751 ][ 0 ] =  "2758";		projections[  751 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 168W";
-projections[  752 ][ 0 ] =  "2759";		projections[  752 ][ 1 ] =  "NAD83(HARN) / Alabama East";
-projections[  753 ][ 0 ] =  "2760";		projections[  753 ][ 1 ] =  "NAD83(HARN) / Alabama West";
-projections[  754 ][ 0 ] =  "2761";		projections[  754 ][ 1 ] =  "NAD83(HARN) / Arizona East";
-projections[  755 ][ 0 ] =  "2762";		projections[  755 ][ 1 ] =  "NAD83(HARN) / Arizona Central";
-projections[  756 ][ 0 ] =  "2763";		projections[  756 ][ 1 ] =  "NAD83(HARN) / Arizona West";
-projections[  757 ][ 0 ] =  "2764";		projections[  757 ][ 1 ] =  "NAD83(HARN) / Arkansas North";
-projections[  758 ][ 0 ] =  "2765";		projections[  758 ][ 1 ] =  "NAD83(HARN) / Arkansas South";
-projections[  759 ][ 0 ] =  "2766";		projections[  759 ][ 1 ] =  "NAD83(HARN) / California zone 1";
-projections[  760 ][ 0 ] =  "2767";		projections[  760 ][ 1 ] =  "NAD83(HARN) / California zone 2";
-projections[  761 ][ 0 ] =  "2768";		projections[  761 ][ 1 ] =  "NAD83(HARN) / California zone 3";
-projections[  762 ][ 0 ] =  "2769";		projections[  762 ][ 1 ] =  "NAD83(HARN) / California zone 4";
-projections[  763 ][ 0 ] =  "2770";		projections[  763 ][ 1 ] =  "NAD83(HARN) / California zone 5";
-projections[  764 ][ 0 ] =  "2771";		projections[  764 ][ 1 ] =  "NAD83(HARN) / California zone 6";
-projections[  765 ][ 0 ] =  "2772";		projections[  765 ][ 1 ] =  "NAD83(HARN) / Colorado North";
-projections[  766 ][ 0 ] =  "2773";		projections[  766 ][ 1 ] =  "NAD83(HARN) / Colorado Central";
-projections[  767 ][ 0 ] =  "2774";		projections[  767 ][ 1 ] =  "NAD83(HARN) / Colorado South";
-projections[  768 ][ 0 ] =  "2775";		projections[  768 ][ 1 ] =  "NAD83(HARN) / Connecticut";
-projections[  769 ][ 0 ] =  "2776";		projections[  769 ][ 1 ] =  "NAD83(HARN) / Delaware";
-projections[  770 ][ 0 ] =  "2777";		projections[  770 ][ 1 ] =  "NAD83(HARN) / Florida East";
-projections[  771 ][ 0 ] =  "2778";		projections[  771 ][ 1 ] =  "NAD83(HARN) / Florida West";
-projections[  772 ][ 0 ] =  "2779";		projections[  772 ][ 1 ] =  "NAD83(HARN) / Florida North";
-projections[  773 ][ 0 ] =  "2780";		projections[  773 ][ 1 ] =  "NAD83(HARN) / Georgia East";
-projections[  774 ][ 0 ] =  "2781";		projections[  774 ][ 1 ] =  "NAD83(HARN) / Georgia West";
-projections[  775 ][ 0 ] =  "2782";		projections[  775 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 1";
-projections[  776 ][ 0 ] =  "2783";		projections[  776 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 2";
-projections[  777 ][ 0 ] =  "2784";		projections[  777 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 3";
-projections[  778 ][ 0 ] =  "2785";		projections[  778 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 4";
-projections[  779 ][ 0 ] =  "2786";		projections[  779 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 5";
-projections[  780 ][ 0 ] =  "2787";		projections[  780 ][ 1 ] =  "NAD83(HARN) / Idaho East";
-projections[  781 ][ 0 ] =  "2788";		projections[  781 ][ 1 ] =  "NAD83(HARN) / Idaho Central";
-projections[  782 ][ 0 ] =  "2789";		projections[  782 ][ 1 ] =  "NAD83(HARN) / Idaho West";
-projections[  783 ][ 0 ] =  "2790";		projections[  783 ][ 1 ] =  "NAD83(HARN) / Illinois East";
-projections[  784 ][ 0 ] =  "2791";		projections[  784 ][ 1 ] =  "NAD83(HARN) / Illinois West";
-projections[  785 ][ 0 ] =  "2792";		projections[  785 ][ 1 ] =  "NAD83(HARN) / Indiana East";
-projections[  786 ][ 0 ] =  "2793";		projections[  786 ][ 1 ] =  "NAD83(HARN) / Indiana West";
-projections[  787 ][ 0 ] =  "2794";		projections[  787 ][ 1 ] =  "NAD83(HARN) / Iowa North";
-projections[  788 ][ 0 ] =  "2795";		projections[  788 ][ 1 ] =  "NAD83(HARN) / Iowa South";
-projections[  789 ][ 0 ] =  "2796";		projections[  789 ][ 1 ] =  "NAD83(HARN) / Kansas North";
-projections[  790 ][ 0 ] =  "2797";		projections[  790 ][ 1 ] =  "NAD83(HARN) / Kansas South";
-projections[  791 ][ 0 ] =  "2798";		projections[  791 ][ 1 ] =  "NAD83(HARN) / Kentucky North";
-projections[  792 ][ 0 ] =  "2799";		projections[  792 ][ 1 ] =  "NAD83(HARN) / Kentucky South";
-projections[  793 ][ 0 ] =  "2800";		projections[  793 ][ 1 ] =  "NAD83(HARN) / Louisiana North";
-projections[  794 ][ 0 ] =  "2801";		projections[  794 ][ 1 ] =  "NAD83(HARN) / Louisiana South";
-projections[  795 ][ 0 ] =  "2802";		projections[  795 ][ 1 ] =  "NAD83(HARN) / Maine East";
-projections[  796 ][ 0 ] =  "2803";		projections[  796 ][ 1 ] =  "NAD83(HARN) / Maine West";
-projections[  797 ][ 0 ] =  "2804";		projections[  797 ][ 1 ] =  "NAD83(HARN) / Maryland";
-projections[  798 ][ 0 ] =  "2805";		projections[  798 ][ 1 ] =  "NAD83(HARN) / Massachusetts Mainland";
-projections[  799 ][ 0 ] =  "2806";		projections[  799 ][ 1 ] =  "NAD83(HARN) / Massachusetts Island";
-projections[  800 ][ 0 ] =  "2807";		projections[  800 ][ 1 ] =  "NAD83(HARN) / Michigan North";
-projections[  801 ][ 0 ] =  "2808";		projections[  801 ][ 1 ] =  "NAD83(HARN) / Michigan Central";
-projections[  802 ][ 0 ] =  "2809";		projections[  802 ][ 1 ] =  "NAD83(HARN) / Michigan South";
-projections[  803 ][ 0 ] =  "2810";		projections[  803 ][ 1 ] =  "NAD83(HARN) / Minnesota North";
-projections[  804 ][ 0 ] =  "2811";		projections[  804 ][ 1 ] =  "NAD83(HARN) / Minnesota Central";
-projections[  805 ][ 0 ] =  "2812";		projections[  805 ][ 1 ] =  "NAD83(HARN) / Minnesota South";
-projections[  806 ][ 0 ] =  "2813";		projections[  806 ][ 1 ] =  "NAD83(HARN) / Mississippi East";
-projections[  807 ][ 0 ] =  "2814";		projections[  807 ][ 1 ] =  "NAD83(HARN) / Mississippi West";
-projections[  808 ][ 0 ] =  "2815";		projections[  808 ][ 1 ] =  "NAD83(HARN) / Missouri East";
-projections[  809 ][ 0 ] =  "2816";		projections[  809 ][ 1 ] =  "NAD83(HARN) / Missouri Central";
-projections[  810 ][ 0 ] =  "2817";		projections[  810 ][ 1 ] =  "NAD83(HARN) / Missouri West";
-projections[  811 ][ 0 ] =  "2818";		projections[  811 ][ 1 ] =  "NAD83(HARN) / Montana";
-projections[  812 ][ 0 ] =  "2819";		projections[  812 ][ 1 ] =  "NAD83(HARN) / Nebraska";
-projections[  813 ][ 0 ] =  "2820";		projections[  813 ][ 1 ] =  "NAD83(HARN) / Nevada East";
-projections[  814 ][ 0 ] =  "2821";		projections[  814 ][ 1 ] =  "NAD83(HARN) / Nevada Central";
-projections[  815 ][ 0 ] =  "2822";		projections[  815 ][ 1 ] =  "NAD83(HARN) / Nevada West";
-projections[  816 ][ 0 ] =  "2823";		projections[  816 ][ 1 ] =  "NAD83(HARN) / New Hampshire";
-projections[  817 ][ 0 ] =  "2824";		projections[  817 ][ 1 ] =  "NAD83(HARN) / New Jersey";
-projections[  818 ][ 0 ] =  "2825";		projections[  818 ][ 1 ] =  "NAD83(HARN) / New Mexico East";
-projections[  819 ][ 0 ] =  "2826";		projections[  819 ][ 1 ] =  "NAD83(HARN) / New Mexico Central";
-projections[  820 ][ 0 ] =  "2827";		projections[  820 ][ 1 ] =  "NAD83(HARN) / New Mexico West";
-projections[  821 ][ 0 ] =  "2828";		projections[  821 ][ 1 ] =  "NAD83(HARN) / New York East";
-projections[  822 ][ 0 ] =  "2829";		projections[  822 ][ 1 ] =  "NAD83(HARN) / New York Central";
-projections[  823 ][ 0 ] =  "2830";		projections[  823 ][ 1 ] =  "NAD83(HARN) / New York West";
-projections[  824 ][ 0 ] =  "2831";		projections[  824 ][ 1 ] =  "NAD83(HARN) / New York Long Island";
-projections[  825 ][ 0 ] =  "2832";		projections[  825 ][ 1 ] =  "NAD83(HARN) / North Dakota North";
-projections[  826 ][ 0 ] =  "2833";		projections[  826 ][ 1 ] =  "NAD83(HARN) / North Dakota South";
-projections[  827 ][ 0 ] =  "2834";		projections[  827 ][ 1 ] =  "NAD83(HARN) / Ohio North";
-projections[  828 ][ 0 ] =  "2835";		projections[  828 ][ 1 ] =  "NAD83(HARN) / Ohio South";
-projections[  829 ][ 0 ] =  "2836";		projections[  829 ][ 1 ] =  "NAD83(HARN) / Oklahoma North";
-projections[  830 ][ 0 ] =  "2837";		projections[  830 ][ 1 ] =  "NAD83(HARN) / Oklahoma South";
-projections[  831 ][ 0 ] =  "2838";		projections[  831 ][ 1 ] =  "NAD83(HARN) / Oregon North";
-projections[  832 ][ 0 ] =  "2839";		projections[  832 ][ 1 ] =  "NAD83(HARN) / Oregon South";
-projections[  833 ][ 0 ] =  "2840";		projections[  833 ][ 1 ] =  "NAD83(HARN) / Rhode Island";
-projections[  834 ][ 0 ] =  "2841";		projections[  834 ][ 1 ] =  "NAD83(HARN) / South Dakota North";
-projections[  835 ][ 0 ] =  "2842";		projections[  835 ][ 1 ] =  "NAD83(HARN) / South Dakota South";
-projections[  836 ][ 0 ] =  "2843";		projections[  836 ][ 1 ] =  "NAD83(HARN) / Tennessee";
-projections[  837 ][ 0 ] =  "2844";		projections[  837 ][ 1 ] =  "NAD83(HARN) / Texas North";
-projections[  838 ][ 0 ] =  "2845";		projections[  838 ][ 1 ] =  "NAD83(HARN) / Texas North Central";
-projections[  839 ][ 0 ] =  "2846";		projections[  839 ][ 1 ] =  "NAD83(HARN) / Texas Central";
-projections[  840 ][ 0 ] =  "2847";		projections[  840 ][ 1 ] =  "NAD83(HARN) / Texas South Central";
-projections[  841 ][ 0 ] =  "2848";		projections[  841 ][ 1 ] =  "NAD83(HARN) / Texas South";
-projections[  842 ][ 0 ] =  "2849";		projections[  842 ][ 1 ] =  "NAD83(HARN) / Utah North";
-projections[  843 ][ 0 ] =  "2850";		projections[  843 ][ 1 ] =  "NAD83(HARN) / Utah Central";
-projections[  844 ][ 0 ] =  "2851";		projections[  844 ][ 1 ] =  "NAD83(HARN) / Utah South";
-projections[  845 ][ 0 ] =  "2852";		projections[  845 ][ 1 ] =  "NAD83(HARN) / Vermont";
-projections[  846 ][ 0 ] =  "2853";		projections[  846 ][ 1 ] =  "NAD83(HARN) / Virginia North";
-projections[  847 ][ 0 ] =  "2854";		projections[  847 ][ 1 ] =  "NAD83(HARN) / Virginia South";
-projections[  848 ][ 0 ] =  "2855";		projections[  848 ][ 1 ] =  "NAD83(HARN) / Washington North";
-projections[  849 ][ 0 ] =  "2856";		projections[  849 ][ 1 ] =  "NAD83(HARN) / Washington South";
-projections[  850 ][ 0 ] =  "2857";		projections[  850 ][ 1 ] =  "NAD83(HARN) / West Virginia North";
-projections[  851 ][ 0 ] =  "2858";		projections[  851 ][ 1 ] =  "NAD83(HARN) / West Virginia South";
-projections[  852 ][ 0 ] =  "2859";		projections[  852 ][ 1 ] =  "NAD83(HARN) / Wisconsin North";
-projections[  853 ][ 0 ] =  "2860";		projections[  853 ][ 1 ] =  "NAD83(HARN) / Wisconsin Central";
-projections[  854 ][ 0 ] =  "2861";		projections[  854 ][ 1 ] =  "NAD83(HARN) / Wisconsin South";
-projections[  855 ][ 0 ] =  "2862";		projections[  855 ][ 1 ] =  "NAD83(HARN) / Wyoming East";
-projections[  856 ][ 0 ] =  "2863";		projections[  856 ][ 1 ] =  "NAD83(HARN) / Wyoming East Central";
-projections[  857 ][ 0 ] =  "2864";		projections[  857 ][ 1 ] =  "NAD83(HARN) / Wyoming West Central";
-projections[  858 ][ 0 ] =  "2865";		projections[  858 ][ 1 ] =  "NAD83(HARN) / Wyoming West";
-projections[  859 ][ 0 ] =  "2866";		projections[  859 ][ 1 ] =  "NAD83(HARN) / Puerto Rico & Virgin Is.";
-projections[  860 ][ 0 ] =  "2867";		projections[  860 ][ 1 ] =  "NAD83(HARN) / Arizona East (ft)";
-projections[  861 ][ 0 ] =  "2868";		projections[  861 ][ 1 ] =  "NAD83(HARN) / Arizona Central (ft)";
-projections[  862 ][ 0 ] =  "2869";		projections[  862 ][ 1 ] =  "NAD83(HARN) / Arizona West (ft)";
-projections[  863 ][ 0 ] =  "2870";		projections[  863 ][ 1 ] =  "NAD83(HARN) / California zone 1 (ftUS)";
-projections[  864 ][ 0 ] =  "2871";		projections[  864 ][ 1 ] =  "NAD83(HARN) / California zone 2 (ftUS)";
-projections[  865 ][ 0 ] =  "2872";		projections[  865 ][ 1 ] =  "NAD83(HARN) / California zone 3 (ftUS)";
-projections[  866 ][ 0 ] =  "2873";		projections[  866 ][ 1 ] =  "NAD83(HARN) / California zone 4 (ftUS)";
-projections[  867 ][ 0 ] =  "2874";		projections[  867 ][ 1 ] =  "NAD83(HARN) / California zone 5 (ftUS)";
-projections[  868 ][ 0 ] =  "2875";		projections[  868 ][ 1 ] =  "NAD83(HARN) / California zone 6 (ftUS)";
-projections[  869 ][ 0 ] =  "2876";		projections[  869 ][ 1 ] =  "NAD83(HARN) / Colorado North (ftUS)";
-projections[  870 ][ 0 ] =  "2877";		projections[  870 ][ 1 ] =  "NAD83(HARN) / Colorado Central (ftUS)";
-projections[  871 ][ 0 ] =  "2878";		projections[  871 ][ 1 ] =  "NAD83(HARN) / Colorado South (ftUS)";
-projections[  872 ][ 0 ] =  "2879";		projections[  872 ][ 1 ] =  "NAD83(HARN) / Connecticut (ftUS)";
-projections[  873 ][ 0 ] =  "2880";		projections[  873 ][ 1 ] =  "NAD83(HARN) / Delaware (ftUS)";
-projections[  874 ][ 0 ] =  "2881";		projections[  874 ][ 1 ] =  "NAD83(HARN) / Florida East (ftUS)";
-projections[  875 ][ 0 ] =  "2882";		projections[  875 ][ 1 ] =  "NAD83(HARN) / Florida West (ftUS)";
-projections[  876 ][ 0 ] =  "2883";		projections[  876 ][ 1 ] =  "NAD83(HARN) / Florida North (ftUS)";
-projections[  877 ][ 0 ] =  "2884";		projections[  877 ][ 1 ] =  "NAD83(HARN) / Georgia East (ftUS)";
-projections[  878 ][ 0 ] =  "2885";		projections[  878 ][ 1 ] =  "NAD83(HARN) / Georgia West (ftUS)";
-projections[  879 ][ 0 ] =  "2886";		projections[  879 ][ 1 ] =  "NAD83(HARN) / Idaho East (ftUS)";
-projections[  880 ][ 0 ] =  "2887";		projections[  880 ][ 1 ] =  "NAD83(HARN) / Idaho Central (ftUS)";
-projections[  881 ][ 0 ] =  "2888";		projections[  881 ][ 1 ] =  "NAD83(HARN) / Idaho West (ftUS)";
-projections[  882 ][ 0 ] =  "2889";		projections[  882 ][ 1 ] =  "NAD83(HARN) / Indiana East (ftUS)";
-projections[  883 ][ 0 ] =  "2890";		projections[  883 ][ 1 ] =  "NAD83(HARN) / Indiana West (ftUS)";
-projections[  884 ][ 0 ] =  "2891";		projections[  884 ][ 1 ] =  "NAD83(HARN) / Kentucky North (ftUS)";
-projections[  885 ][ 0 ] =  "2892";		projections[  885 ][ 1 ] =  "NAD83(HARN) / Kentucky South (ftUS)";
-projections[  886 ][ 0 ] =  "2893";		projections[  886 ][ 1 ] =  "NAD83(HARN) / Maryland (ftUS)";
-projections[  887 ][ 0 ] =  "2894";		projections[  887 ][ 1 ] =  "NAD83(HARN) / Massachusetts Mainland (ftUS)";
-projections[  888 ][ 0 ] =  "2895";		projections[  888 ][ 1 ] =  "NAD83(HARN) / Massachusetts Island (ftUS)";
-projections[  889 ][ 0 ] =  "2896";		projections[  889 ][ 1 ] =  "NAD83(HARN) / Michigan North (ft)";
-projections[  890 ][ 0 ] =  "2897";		projections[  890 ][ 1 ] =  "NAD83(HARN) / Michigan Central (ft)";
-projections[  891 ][ 0 ] =  "2898";		projections[  891 ][ 1 ] =  "NAD83(HARN) / Michigan South (ft)";
-projections[  892 ][ 0 ] =  "2899";		projections[  892 ][ 1 ] =  "NAD83(HARN) / Mississippi East (ftUS)";
-projections[  893 ][ 0 ] =  "2900";		projections[  893 ][ 1 ] =  "NAD83(HARN) / Mississippi West (ftUS)";
-projections[  894 ][ 0 ] =  "2901";		projections[  894 ][ 1 ] =  "NAD83(HARN) / Montana (ft)";
-projections[  895 ][ 0 ] =  "2902";		projections[  895 ][ 1 ] =  "NAD83(HARN) / New Mexico East (ftUS)";
-projections[  896 ][ 0 ] =  "2903";		projections[  896 ][ 1 ] =  "NAD83(HARN) / New Mexico Central (ftUS)";
-projections[  897 ][ 0 ] =  "2904";		projections[  897 ][ 1 ] =  "NAD83(HARN) / New Mexico West (ftUS)";
-projections[  898 ][ 0 ] =  "2905";		projections[  898 ][ 1 ] =  "NAD83(HARN) / New York East (ftUS)";
-projections[  899 ][ 0 ] =  "2906";		projections[  899 ][ 1 ] =  "NAD83(HARN) / New York Central (ftUS)";
-projections[  900 ][ 0 ] =  "2907";		projections[  900 ][ 1 ] =  "NAD83(HARN) / New York West (ftUS)";
-projections[  901 ][ 0 ] =  "2908";		projections[  901 ][ 1 ] =  "NAD83(HARN) / New York Long Island (ftUS)";
-projections[  902 ][ 0 ] =  "2909";		projections[  902 ][ 1 ] =  "NAD83(HARN) / North Dakota North (ft)";
-projections[  903 ][ 0 ] =  "2910";		projections[  903 ][ 1 ] =  "NAD83(HARN) / North Dakota South (ft)";
-projections[  904 ][ 0 ] =  "2911";		projections[  904 ][ 1 ] =  "NAD83(HARN) / Oklahoma North (ftUS)";
-projections[  905 ][ 0 ] =  "2912";		projections[  905 ][ 1 ] =  "NAD83(HARN) / Oklahoma South (ftUS)";
-projections[  906 ][ 0 ] =  "2913";		projections[  906 ][ 1 ] =  "NAD83(HARN) / Oregon North (ft)";
-projections[  907 ][ 0 ] =  "2914";		projections[  907 ][ 1 ] =  "NAD83(HARN) / Oregon South (ft)";
-projections[  908 ][ 0 ] =  "2915";		projections[  908 ][ 1 ] =  "NAD83(HARN) / Tennessee (ftUS)";
-projections[  909 ][ 0 ] =  "2916";		projections[  909 ][ 1 ] =  "NAD83(HARN) / Texas North (ftUS)";
-projections[  910 ][ 0 ] =  "2917";		projections[  910 ][ 1 ] =  "NAD83(HARN) / Texas North Central (ftUS)";
-projections[  911 ][ 0 ] =  "2918";		projections[  911 ][ 1 ] =  "NAD83(HARN) / Texas Central (ftUS)";
-projections[  912 ][ 0 ] =  "2919";		projections[  912 ][ 1 ] =  "NAD83(HARN) / Texas South Central (ftUS)";
-projections[  913 ][ 0 ] =  "2920";		projections[  913 ][ 1 ] =  "NAD83(HARN) / Texas South (ftUS)";
-projections[  914 ][ 0 ] =  "2921";		projections[  914 ][ 1 ] =  "NAD83(HARN) / Utah North (ft)";
-projections[  915 ][ 0 ] =  "2922";		projections[  915 ][ 1 ] =  "NAD83(HARN) / Utah Central (ft)";
-projections[  916 ][ 0 ] =  "2923";		projections[  916 ][ 1 ] =  "NAD83(HARN) / Utah South (ft)";
-projections[  917 ][ 0 ] =  "2924";		projections[  917 ][ 1 ] =  "NAD83(HARN) / Virginia North (ftUS)";
-projections[  918 ][ 0 ] =  "2925";		projections[  918 ][ 1 ] =  "NAD83(HARN) / Virginia South (ftUS)";
-projections[  919 ][ 0 ] =  "2926";		projections[  919 ][ 1 ] =  "NAD83(HARN) / Washington North (ftUS)";
-projections[  920 ][ 0 ] =  "2927";		projections[  920 ][ 1 ] =  "NAD83(HARN) / Washington South (ftUS)";
-projections[  921 ][ 0 ] =  "2928";		projections[  921 ][ 1 ] =  "NAD83(HARN) / Wisconsin North (ftUS)";
-projections[  922 ][ 0 ] =  "2929";		projections[  922 ][ 1 ] =  "NAD83(HARN) / Wisconsin Central (ftUS)";
-projections[  923 ][ 0 ] =  "2930";		projections[  923 ][ 1 ] =  "NAD83(HARN) / Wisconsin South (ftUS)";
-projections[  924 ][ 0 ] =  "2931";		projections[  924 ][ 1 ] =  "Beduaram / TM 13 NE";
-projections[  925 ][ 0 ] =  "2932";		projections[  925 ][ 1 ] =  "QND95 / Qatar National Grid";
-projections[  926 ][ 0 ] =  "2933";		projections[  926 ][ 1 ] =  "Segara / UTM zone 50S";
-projections[  927 ][ 0 ] =  "2934";		projections[  927 ][ 1 ] =  "Segara (Jakarta) / NEIEZ";
-projections[  928 ][ 0 ] =  "2935";		projections[  928 ][ 1 ] =  "Pulkovo 1942 / CS63 zone A1";
-projections[  929 ][ 0 ] =  "2936";		projections[  929 ][ 1 ] =  "Pulkovo 1942 / CS63 zone A2";
-projections[  930 ][ 0 ] =  "2937";		projections[  930 ][ 1 ] =  "Pulkovo 1942 / CS63 zone A3";
-projections[  931 ][ 0 ] =  "2938";		projections[  931 ][ 1 ] =  "Pulkovo 1942 / CS63 zone A4";
-projections[  932 ][ 0 ] =  "2939";		projections[  932 ][ 1 ] =  "Pulkovo 1942 / CS63 zone K2";
-projections[  933 ][ 0 ] =  "2940";		projections[  933 ][ 1 ] =  "Pulkovo 1942 / CS63 zone K3";
-projections[  934 ][ 0 ] =  "2941";		projections[  934 ][ 1 ] =  "Pulkovo 1942 / CS63 zone K4";
-projections[  935 ][ 0 ] =  "2942";		projections[  935 ][ 1 ] =  "Porto Santo / UTM zone 28N";
-projections[  936 ][ 0 ] =  "2943";		projections[  936 ][ 1 ] =  "Selvagem Grande / UTM zone 28N";
-projections[  937 ][ 0 ] =  "2944";		projections[  937 ][ 1 ] =  "NAD83(CSRS) / SCoPQ zone 2";
-projections[  938 ][ 0 ] =  "2945";		projections[  938 ][ 1 ] =  "NAD83(CSRS) / MTM zone 3";
-projections[  939 ][ 0 ] =  "2946";		projections[  939 ][ 1 ] =  "NAD83(CSRS) / MTM zone 4";
-projections[  940 ][ 0 ] =  "2947";		projections[  940 ][ 1 ] =  "NAD83(CSRS) / MTM zone 5";
-projections[  941 ][ 0 ] =  "2948";		projections[  941 ][ 1 ] =  "NAD83(CSRS) / MTM zone 6";
-projections[  942 ][ 0 ] =  "2949";		projections[  942 ][ 1 ] =  "NAD83(CSRS) / MTM zone 7";
-projections[  943 ][ 0 ] =  "2950";		projections[  943 ][ 1 ] =  "NAD83(CSRS) / MTM zone 8";
-projections[  944 ][ 0 ] =  "2951";		projections[  944 ][ 1 ] =  "NAD83(CSRS) / MTM zone 9";
-projections[  945 ][ 0 ] =  "2952";		projections[  945 ][ 1 ] =  "NAD83(CSRS) / MTM zone 10";
-projections[  946 ][ 0 ] =  "2953";		projections[  946 ][ 1 ] =  "NAD83(CSRS) / New Brunswick Stereo";
-projections[  947 ][ 0 ] =  "2954";		projections[  947 ][ 1 ] =  "NAD83(CSRS) / Prince Edward Isl. Stereographic";
-projections[  948 ][ 0 ] =  "2955";		projections[  948 ][ 1 ] =  "NAD83(CSRS) / UTM zone 11N";
-projections[  949 ][ 0 ] =  "2956";		projections[  949 ][ 1 ] =  "NAD83(CSRS) / UTM zone 12N";
-projections[  950 ][ 0 ] =  "2957";		projections[  950 ][ 1 ] =  "NAD83(CSRS) / UTM zone 13N";
-projections[  951 ][ 0 ] =  "2958";		projections[  951 ][ 1 ] =  "NAD83(CSRS) / UTM zone 17N";
-projections[  952 ][ 0 ] =  "2959";		projections[  952 ][ 1 ] =  "NAD83(CSRS) / UTM zone 18N";
-projections[  953 ][ 0 ] =  "2960";		projections[  953 ][ 1 ] =  "NAD83(CSRS) / UTM zone 19N";
-projections[  954 ][ 0 ] =  "2961";		projections[  954 ][ 1 ] =  "NAD83(CSRS) / UTM zone 20N";
-projections[  955 ][ 0 ] =  "2962";		projections[  955 ][ 1 ] =  "NAD83(CSRS) / UTM zone 21N";
-projections[  956 ][ 0 ] =  "2963";		projections[  956 ][ 1 ] =  "Lisbon 1890 (Lisbon) / Portugal Bonne";
-projections[  957 ][ 0 ] =  "2964";		projections[  957 ][ 1 ] =  "NAD27 / Alaska Albers";
-projections[  958 ][ 0 ] =  "2965";		projections[  958 ][ 1 ] =  "NAD83 / Indiana East (ftUS)";
-projections[  959 ][ 0 ] =  "2966";		projections[  959 ][ 1 ] =  "NAD83 / Indiana West (ftUS)";
-projections[  960 ][ 0 ] =  "2967";		projections[  960 ][ 1 ] =  "NAD83(HARN) / Indiana East (ftUS)";
-projections[  961 ][ 0 ] =  "2968";		projections[  961 ][ 1 ] =  "NAD83(HARN) / Indiana West (ftUS)";
-projections[  962 ][ 0 ] =  "2969";		projections[  962 ][ 1 ] =  "Fort Marigot / UTM zone 20N";
-projections[  963 ][ 0 ] =  "2970";		projections[  963 ][ 1 ] =  "Guadeloupe 1948 / UTM zone 20N";
-projections[  964 ][ 0 ] =  "2971";		projections[  964 ][ 1 ] =  "CSG67 / UTM zone 22N";
-projections[  965 ][ 0 ] =  "2972";		projections[  965 ][ 1 ] =  "RGFG95 / UTM zone 22N";
-projections[  966 ][ 0 ] =  "2973";		projections[  966 ][ 1 ] =  "Martinique 1938 / UTM zone 20N";
-projections[  967 ][ 0 ] =  "2975";		projections[  967 ][ 1 ] =  "RGR92 / UTM zone 40S";
-projections[  968 ][ 0 ] =  "2976";		projections[  968 ][ 1 ] =  "Tahiti 52 / UTM zone 6S";
-projections[  969 ][ 0 ] =  "2977";		projections[  969 ][ 1 ] =  "Tahaa 54 / UTM zone 5S";
-projections[  970 ][ 0 ] =  "2978";		projections[  970 ][ 1 ] =  "IGN72 Nuku Hiva / UTM zone 7S";
-projections[  971 ][ 0 ] =  "2979";		projections[  971 ][ 1 ] =  "K0 1949 / UTM zone 42S";
-projections[  972 ][ 0 ] =  "2980";		projections[  972 ][ 1 ] =  "Combani 1950 / UTM zone 38S";
-projections[  973 ][ 0 ] =  "2981";		projections[  973 ][ 1 ] =  "IGN56 Lifou / UTM zone 58S";
-projections[  974 ][ 0 ] =  "2982";		projections[  974 ][ 1 ] =  "IGN72 Grand Terre / UTM zone 58S";
-projections[  975 ][ 0 ] =  "2983";		projections[  975 ][ 1 ] =  "ST87 Ouvea / UTM zone 58S";
-projections[  976 ][ 0 ] =  "2984";		projections[  976 ][ 1 ] =  "RGNC 1991 / Lambert New Caledonia";
-projections[  977 ][ 0 ] =  "2985";		projections[  977 ][ 1 ] =  "Petrels 1972 / Terre Adelie Polar Stereographic";
-projections[  978 ][ 0 ] =  "2986";		projections[  978 ][ 1 ] =  "Perroud 1950 / Terre Adelie Polar Stereographic";
-projections[  979 ][ 0 ] =  "2987";		projections[  979 ][ 1 ] =  "Saint Pierre et Miquelon 1950 / UTM zone 21N";
-projections[  980 ][ 0 ] =  "2988";		projections[  980 ][ 1 ] =  "MOP78 / UTM zone 1S";
-projections[  981 ][ 0 ] =  "2989";		projections[  981 ][ 1 ] =  "RRAF 1991 / UTM zone 20N";
-projections[  982 ][ 0 ] =  "2990";		projections[  982 ][ 1 ] =  "Reunion 1947 / TM Reunion";
-projections[  983 ][ 0 ] =  "2991";		projections[  983 ][ 1 ] =  "NAD83 / Oregon Lambert";
-projections[  984 ][ 0 ] =  "2992";		projections[  984 ][ 1 ] =  "NAD83 / Oregon Lambert (ft)";
-projections[  985 ][ 0 ] =  "2993";		projections[  985 ][ 1 ] =  "NAD83(HARN) / Oregon Lambert";
-projections[  986 ][ 0 ] =  "2994";		projections[  986 ][ 1 ] =  "NAD83(HARN) / Oregon Lambert (ft)";
-projections[  987 ][ 0 ] =  "2995";		projections[  987 ][ 1 ] =  "IGN53 Mare / UTM zone 58S";
-projections[  988 ][ 0 ] =  "2996";		projections[  988 ][ 1 ] =  "ST84 Ile des Pins / UTM zone 58S";
-projections[  989 ][ 0 ] =  "2997";		projections[  989 ][ 1 ] =  "ST71 Belep / UTM zone 58S";
-projections[  990 ][ 0 ] =  "2998";		projections[  990 ][ 1 ] =  "NEA74 Noumea / UTM zone 58S";
-projections[  991 ][ 0 ] =  "2999";		projections[  991 ][ 1 ] =  "Grand Comoros / UTM zone 38S";
-projections[  992 ][ 0 ] =  "3000";		projections[  992 ][ 1 ] =  "Segara / NEIEZ";
-projections[  993 ][ 0 ] =  "3001";		projections[  993 ][ 1 ] =  "Batavia / NEIEZ";
-projections[  994 ][ 0 ] =  "3002";		projections[  994 ][ 1 ] =  "Makassar / NEIEZ";
-projections[  995 ][ 0 ] =  "3003";		projections[  995 ][ 1 ] =  "Monte Mario / Italy zone 1";
-projections[  996 ][ 0 ] =  "3004";		projections[  996 ][ 1 ] =  "Monte Mario / Italy zone 2";
-projections[  997 ][ 0 ] =  "3005";		projections[  997 ][ 1 ] =  "NAD83 / BC Albers";
-projections[  998 ][ 0 ] =  "3006";		projections[  998 ][ 1 ] =  "SWEREF99 TM";
-projections[  999 ][ 0 ] =  "3007";		projections[  999 ][ 1 ] =  "SWEREF99 12 00";
-projections[ 1000 ][ 0 ] =  "3008";		projections[ 1000 ][ 1 ] =  "SWEREF99 13 30";
-projections[ 1001 ][ 0 ] =  "3009";		projections[ 1001 ][ 1 ] =  "SWEREF99 15 00";
-projections[ 1002 ][ 0 ] =  "3010";		projections[ 1002 ][ 1 ] =  "SWEREF99 16 30";
-projections[ 1003 ][ 0 ] =  "3011";		projections[ 1003 ][ 1 ] =  "SWEREF99 18 00";
-projections[ 1004 ][ 0 ] =  "3012";		projections[ 1004 ][ 1 ] =  "SWEREF99 14 15";
-projections[ 1005 ][ 0 ] =  "3013";		projections[ 1005 ][ 1 ] =  "SWEREF99 15 45";
-projections[ 1006 ][ 0 ] =  "3014";		projections[ 1006 ][ 1 ] =  "SWEREF99 17 15";
-projections[ 1007 ][ 0 ] =  "3015";		projections[ 1007 ][ 1 ] =  "SWEREF99 18 45";
-projections[ 1008 ][ 0 ] =  "3016";		projections[ 1008 ][ 1 ] =  "SWEREF99 20 15";
-projections[ 1009 ][ 0 ] =  "3017";		projections[ 1009 ][ 1 ] =  "SWEREF99 21 45";
-projections[ 1010 ][ 0 ] =  "3018";		projections[ 1010 ][ 1 ] =  "SWEREF99 23 15";
-projections[ 1011 ][ 0 ] =  "3019";		projections[ 1011 ][ 1 ] =  "RT90 7.5 gon V";
-projections[ 1012 ][ 0 ] =  "3020";		projections[ 1012 ][ 1 ] =  "RT90 5 gon V";
-projections[ 1013 ][ 0 ] =  "3021";		projections[ 1013 ][ 1 ] =  "RT90 2.5 gon V";
-projections[ 1014 ][ 0 ] =  "3022";		projections[ 1014 ][ 1 ] =  "RT90 0 gon";
-projections[ 1015 ][ 0 ] =  "3023";		projections[ 1015 ][ 1 ] =  "RT90 2.5 gon O";
-projections[ 1016 ][ 0 ] =  "3024";		projections[ 1016 ][ 1 ] =  "RT90 5 gon O";
-projections[ 1017 ][ 0 ] =  "3025";		projections[ 1017 ][ 1 ] =  "RT38 7.5 gon V";
-projections[ 1018 ][ 0 ] =  "3026";		projections[ 1018 ][ 1 ] =  "RT38 5 gon V";
-projections[ 1019 ][ 0 ] =  "3027";		projections[ 1019 ][ 1 ] =  "RT38 2.5 gon V";
-projections[ 1020 ][ 0 ] =  "3028";		projections[ 1020 ][ 1 ] =  "RT38 0 gon";
-projections[ 1021 ][ 0 ] =  "3029";		projections[ 1021 ][ 1 ] =  "RT38 2.5 gon O";
-projections[ 1022 ][ 0 ] =  "3030";		projections[ 1022 ][ 1 ] =  "RT38 5 gon O";
-projections[ 1023 ][ 0 ] =  "3031";		projections[ 1023 ][ 1 ] =  "WGS 84 / Antarctic Polar Stereographic";
-projections[ 1024 ][ 0 ] =  "3032";		projections[ 1024 ][ 1 ] =  "WGS 84 / Australian Antarctic Polar Stereographic";
-projections[ 1025 ][ 0 ] =  "3033";		projections[ 1025 ][ 1 ] =  "WGS 84 / Australian Antarctic Lambert";
-projections[ 1026 ][ 0 ] =  "3034";		projections[ 1026 ][ 1 ] =  "ETRS89 / ETRS-LCC";
-projections[ 1027 ][ 0 ] =  "3035";		projections[ 1027 ][ 1 ] =  "ETRS89 / ETRS-LAEA";
-projections[ 1028 ][ 0 ] =  "3036";		projections[ 1028 ][ 1 ] =  "Moznet / UTM zone 36S";
-projections[ 1029 ][ 0 ] =  "3037";		projections[ 1029 ][ 1 ] =  "Moznet / UTM zone 37S";
-projections[ 1030 ][ 0 ] =  "3038";		projections[ 1030 ][ 1 ] =  "ETRS89 / ETRS-TM26";
-projections[ 1031 ][ 0 ] =  "3039";		projections[ 1031 ][ 1 ] =  "ETRS89 / ETRS-TM27";
-projections[ 1032 ][ 0 ] =  "3040";		projections[ 1032 ][ 1 ] =  "ETRS89 / ETRS-TM28";
-projections[ 1033 ][ 0 ] =  "3041";		projections[ 1033 ][ 1 ] =  "ETRS89 / ETRS-TM29";
-projections[ 1034 ][ 0 ] =  "3042";		projections[ 1034 ][ 1 ] =  "ETRS89 / ETRS-TM30";
-projections[ 1035 ][ 0 ] =  "3043";		projections[ 1035 ][ 1 ] =  "ETRS89 / ETRS-TM31";
-projections[ 1036 ][ 0 ] =  "3044";		projections[ 1036 ][ 1 ] =  "ETRS89 / ETRS-TM32";
-projections[ 1037 ][ 0 ] =  "3045";		projections[ 1037 ][ 1 ] =  "ETRS89 / ETRS-TM33";
-projections[ 1038 ][ 0 ] =  "3046";		projections[ 1038 ][ 1 ] =  "ETRS89 / ETRS-TM34";
-projections[ 1039 ][ 0 ] =  "3047";		projections[ 1039 ][ 1 ] =  "ETRS89 / ETRS-TM35";
-projections[ 1040 ][ 0 ] =  "3048";		projections[ 1040 ][ 1 ] =  "ETRS89 / ETRS-TM36";
-projections[ 1041 ][ 0 ] =  "3049";		projections[ 1041 ][ 1 ] =  "ETRS89 / ETRS-TM37";
-projections[ 1042 ][ 0 ] =  "3050";		projections[ 1042 ][ 1 ] =  "ETRS89 / ETRS-TM38";
-projections[ 1043 ][ 0 ] =  "3051";		projections[ 1043 ][ 1 ] =  "ETRS89 / ETRS-TM39";
-projections[ 1044 ][ 0 ] =  "3052";		projections[ 1044 ][ 1 ] =  "Reykjavik 1900 / Lambert 1900";
-projections[ 1045 ][ 0 ] =  "3053";		projections[ 1045 ][ 1 ] =  "Hjorsey 1955 / Lambert 1955";
-projections[ 1046 ][ 0 ] =  "3054";		projections[ 1046 ][ 1 ] =  "Hjorsey 1955 / UTM zone 26N";
-projections[ 1047 ][ 0 ] =  "3055";		projections[ 1047 ][ 1 ] =  "Hjorsey 1955 / UTM zone 27N";
-projections[ 1048 ][ 0 ] =  "3056";		projections[ 1048 ][ 1 ] =  "Hjorsey 1955 / UTM zone 28N";
-projections[ 1049 ][ 0 ] =  "3057";		projections[ 1049 ][ 1 ] =  "ISN93 / Lambert 1993";
-projections[ 1050 ][ 0 ] =  "3058";		projections[ 1050 ][ 1 ] =  "Helle 1954 / Jan Mayen Grid";
-projections[ 1051 ][ 0 ] =  "3059";		projections[ 1051 ][ 1 ] =  "LKS92 / Latvia TM";
-projections[ 1052 ][ 0 ] =  "3060";		projections[ 1052 ][ 1 ] =  "IGN72 Grande Terre / UTM zone 58S";
-projections[ 1053 ][ 0 ] =  "3061";		projections[ 1053 ][ 1 ] =  "Porto Santo 1995 / UTM zone 28N";
-projections[ 1054 ][ 0 ] =  "3062";		projections[ 1054 ][ 1 ] =  "Azores Oriental 1995 / UTM zone 26N";
-projections[ 1055 ][ 0 ] =  "3063";		projections[ 1055 ][ 1 ] =  "Azores Central 1995 / UTM zone 26N";
-projections[ 1056 ][ 0 ] =  "3064";		projections[ 1056 ][ 1 ] =  "IGM95 / UTM zone 32N";
-projections[ 1057 ][ 0 ] =  "3065";		projections[ 1057 ][ 1 ] =  "IGM95 / UTM zone 33N";
-projections[ 1058 ][ 0 ] =  "3066";		projections[ 1058 ][ 1 ] =  "ED50 / Jordan TM";
-projections[ 1059 ][ 0 ] =  "3067";		projections[ 1059 ][ 1 ] =  "ETRS89 / ETRS-TM35FIN";
-projections[ 1060 ][ 0 ] =  "3068";		projections[ 1060 ][ 1 ] =  "DHDN / Soldner Berlin";
-projections[ 1061 ][ 0 ] =  "3069";		projections[ 1061 ][ 1 ] =  "NAD27 / Wisconsin Transverse Mercator";
-projections[ 1062 ][ 0 ] =  "3070";		projections[ 1062 ][ 1 ] =  "NAD83 / Wisconsin Transverse Mercator";
-projections[ 1063 ][ 0 ] =  "3071";		projections[ 1063 ][ 1 ] =  "NAD83(HARN) / Wisconsin Transverse Mercator";
-projections[ 1064 ][ 0 ] =  "3072";		projections[ 1064 ][ 1 ] =  "NAD83 / Maine CS2000 East";
-projections[ 1065 ][ 0 ] =  "3073";		projections[ 1065 ][ 1 ] =  "NAD83 / Maine CS2000 Central";
-projections[ 1066 ][ 0 ] =  "3074";		projections[ 1066 ][ 1 ] =  "NAD83 / Maine CS2000 West";
-projections[ 1067 ][ 0 ] =  "3075";		projections[ 1067 ][ 1 ] =  "NAD83(HARN) / Maine CS2000 East";
-projections[ 1068 ][ 0 ] =  "3076";		projections[ 1068 ][ 1 ] =  "NAD83(HARN) / Maine CS2000 Central";
-projections[ 1069 ][ 0 ] =  "3077";		projections[ 1069 ][ 1 ] =  "NAD83(HARN) / Maine CS2000 West";
-projections[ 1070 ][ 0 ] =  "3078";		projections[ 1070 ][ 1 ] =  "NAD83 / Michigan Oblique Mercator";
-projections[ 1071 ][ 0 ] =  "3079";		projections[ 1071 ][ 1 ] =  "NAD83(HARN) / Michigan Oblique Mercator";
-projections[ 1072 ][ 0 ] =  "3080";		projections[ 1072 ][ 1 ] =  "NAD27 / Shackleford";
-projections[ 1073 ][ 0 ] =  "3081";		projections[ 1073 ][ 1 ] =  "NAD83 / Texas State Mapping System";
-projections[ 1074 ][ 0 ] =  "3082";		projections[ 1074 ][ 1 ] =  "NAD83 / Texas Centric Lambert Conformal";
-projections[ 1075 ][ 0 ] =  "3083";		projections[ 1075 ][ 1 ] =  "NAD83 / Texas Centric Albers Equal Area";
-projections[ 1076 ][ 0 ] =  "3084";		projections[ 1076 ][ 1 ] =  "NAD83(HARN) / Texas Centric Lambert Conformal";
-projections[ 1077 ][ 0 ] =  "3085";		projections[ 1077 ][ 1 ] =  "NAD83(HARN) / Texas Centric Albers Equal Area";
-projections[ 1078 ][ 0 ] =  "3086";		projections[ 1078 ][ 1 ] =  "NAD83 / Florida GDL Albers";
-projections[ 1079 ][ 0 ] =  "3087";		projections[ 1079 ][ 1 ] =  "NAD83(HARN) / Florida GDL Albers";
-projections[ 1080 ][ 0 ] =  "3088";		projections[ 1080 ][ 1 ] =  "NAD83 / Kentucky Single Zone";
-projections[ 1081 ][ 0 ] =  "3089";		projections[ 1081 ][ 1 ] =  "NAD83 / Kentucky Single Zone (ftUS)";
-projections[ 1082 ][ 0 ] =  "3090";		projections[ 1082 ][ 1 ] =  "NAD83(HARN) / Kentucky Single Zone";
-projections[ 1083 ][ 0 ] =  "3091";		projections[ 1083 ][ 1 ] =  "NAD83(HARN) / Kentucky Single Zone (ftUS)";
-projections[ 1084 ][ 0 ] =  "3092";		projections[ 1084 ][ 1 ] =  "Tokyo / UTM zone 51N";
-projections[ 1085 ][ 0 ] =  "3093";		projections[ 1085 ][ 1 ] =  "Tokyo / UTM zone 52N";
-projections[ 1086 ][ 0 ] =  "3094";		projections[ 1086 ][ 1 ] =  "Tokyo / UTM zone 53N";
-projections[ 1087 ][ 0 ] =  "3095";		projections[ 1087 ][ 1 ] =  "Tokyo / UTM zone 54N";
-projections[ 1088 ][ 0 ] =  "3096";		projections[ 1088 ][ 1 ] =  "Tokyo / UTM zone 55N";
-projections[ 1089 ][ 0 ] =  "3097";		projections[ 1089 ][ 1 ] =  "JGD2000 / UTM zone 51N";
-projections[ 1090 ][ 0 ] =  "3098";		projections[ 1090 ][ 1 ] =  "JGD2000 / UTM zone 52N";
-projections[ 1091 ][ 0 ] =  "3099";		projections[ 1091 ][ 1 ] =  "JGD2000 / UTM zone 53N";
-projections[ 1092 ][ 0 ] =  "3100";		projections[ 1092 ][ 1 ] =  "JGD2000 / UTM zone 54N";
-projections[ 1093 ][ 0 ] =  "3101";		projections[ 1093 ][ 1 ] =  "JGD2000 / UTM zone 55N";
-projections[ 1094 ][ 0 ] =  "3102";		projections[ 1094 ][ 1 ] =  "American Samoa 1962 / American Samoa Lambert";
-projections[ 1095 ][ 0 ] =  "3103";		projections[ 1095 ][ 1 ] =  "Mauritania 1999 / UTM zone 28N";
-projections[ 1096 ][ 0 ] =  "3104";		projections[ 1096 ][ 1 ] =  "Mauritania 1999 / UTM zone 29N";
-projections[ 1097 ][ 0 ] =  "3105";		projections[ 1097 ][ 1 ] =  "Mauritania 1999 / UTM zone 30N";
-projections[ 1098 ][ 0 ] =  "3106";		projections[ 1098 ][ 1 ] =  "Gulshan 303 / Bangladesh Transverse Mercator";
-projections[ 1099 ][ 0 ] =  "3107";		projections[ 1099 ][ 1 ] =  "GDA94 / SA Lambert";
-projections[ 1100 ][ 0 ] =  "3108";		projections[ 1100 ][ 1 ] =  "ETRS89 / Guernsey Grid";
-projections[ 1101 ][ 0 ] =  "3109";		projections[ 1101 ][ 1 ] =  "ETRS89 / Jersey Transverse Mercator";
-projections[ 1102 ][ 0 ] =  "3110";		projections[ 1102 ][ 1 ] =  "AGD66 / Vicgrid66";
-projections[ 1103 ][ 0 ] =  "3111";		projections[ 1103 ][ 1 ] =  "GDA94 / Vicgrid94";
-projections[ 1104 ][ 0 ] =  "3112";		projections[ 1104 ][ 1 ] =  "GDA94 / Geoscience Australia Lambert";
-projections[ 1105 ][ 0 ] =  "3113";		projections[ 1105 ][ 1 ] =  "GDA94 / BCSG02";
-projections[ 1106 ][ 0 ] =  "3114";		projections[ 1106 ][ 1 ] =  "MAGNA-SIRGAS / Colombia Far West zone";
-projections[ 1107 ][ 0 ] =  "3115";		projections[ 1107 ][ 1 ] =  "MAGNA-SIRGAS / Colombia West zone";
-projections[ 1108 ][ 0 ] =  "3116";		projections[ 1108 ][ 1 ] =  "MAGNA-SIRGAS / Colombia Bogota zone";
-projections[ 1109 ][ 0 ] =  "3117";		projections[ 1109 ][ 1 ] =  "MAGNA-SIRGAS / Colombia East Central zone";
-projections[ 1110 ][ 0 ] =  "3118";		projections[ 1110 ][ 1 ] =  "MAGNA-SIRGAS / Colombia East zone";
-projections[ 1111 ][ 0 ] =  "3119";		projections[ 1111 ][ 1 ] =  "Douala 1948 / AEF west";
-projections[ 1112 ][ 0 ] =  "3120";		projections[ 1112 ][ 1 ] =  "Pulkovo 1942(58) / Poland zone I";
-projections[ 1113 ][ 0 ] =  "3121";		projections[ 1113 ][ 1 ] =  "PRS92 / Philippines zone 1";
-projections[ 1114 ][ 0 ] =  "3122";		projections[ 1114 ][ 1 ] =  "PRS92 / Philippines zone 2";
-projections[ 1115 ][ 0 ] =  "3123";		projections[ 1115 ][ 1 ] =  "PRS92 / Philippines zone 3";
-projections[ 1116 ][ 0 ] =  "3124";		projections[ 1116 ][ 1 ] =  "PRS92 / Philippines zone 4";
-projections[ 1117 ][ 0 ] =  "3125";		projections[ 1117 ][ 1 ] =  "PRS92 / Philippines zone 5";
-projections[ 1118 ][ 0 ] =  "3126";		projections[ 1118 ][ 1 ] =  "ETRS89 / ETRS-GK19FIN";
-projections[ 1119 ][ 0 ] =  "3127";		projections[ 1119 ][ 1 ] =  "ETRS89 / ETRS-GK20FIN";
-projections[ 1120 ][ 0 ] =  "3128";		projections[ 1120 ][ 1 ] =  "ETRS89 / ETRS-GK21FIN";
-projections[ 1121 ][ 0 ] =  "3129";		projections[ 1121 ][ 1 ] =  "ETRS89 / ETRS-GK22FIN";
-projections[ 1122 ][ 0 ] =  "3130";		projections[ 1122 ][ 1 ] =  "ETRS89 / ETRS-GK23FIN";
-projections[ 1123 ][ 0 ] =  "3131";		projections[ 1123 ][ 1 ] =  "ETRS89 / ETRS-GK24FIN";
-projections[ 1124 ][ 0 ] =  "3132";		projections[ 1124 ][ 1 ] =  "ETRS89 / ETRS-GK25FIN";
-projections[ 1125 ][ 0 ] =  "3133";		projections[ 1125 ][ 1 ] =  "ETRS89 / ETRS-GK26FIN";
-projections[ 1126 ][ 0 ] =  "3134";		projections[ 1126 ][ 1 ] =  "ETRS89 / ETRS-GK27FIN";
-projections[ 1127 ][ 0 ] =  "3135";		projections[ 1127 ][ 1 ] =  "ETRS89 / ETRS-GK28FIN";
-projections[ 1128 ][ 0 ] =  "3136";		projections[ 1128 ][ 1 ] =  "ETRS89 / ETRS-GK29FIN";
-projections[ 1129 ][ 0 ] =  "3137";		projections[ 1129 ][ 1 ] =  "ETRS89 / ETRS-GK30FIN";
-projections[ 1130 ][ 0 ] =  "3138";		projections[ 1130 ][ 1 ] =  "ETRS89 / ETRS-GK31FIN";
-projections[ 1131 ][ 0 ] =  "3139";		projections[ 1131 ][ 1 ] =  "Vanua Levu 1915 / Vanua Levu Grid";
-projections[ 1132 ][ 0 ] =  "3140";		projections[ 1132 ][ 1 ] =  "Viti Levu 1912 / Viti Levu Grid";
-projections[ 1133 ][ 0 ] =  "3141";		projections[ 1133 ][ 1 ] =  "Fiji 1956 / UTM zone 60S";
-projections[ 1134 ][ 0 ] =  "3142";		projections[ 1134 ][ 1 ] =  "Fiji 1956 / UTM zone 1S";
-projections[ 1135 ][ 0 ] =  "3143";		projections[ 1135 ][ 1 ] =  "Fiji 1986 / Fiji Map Grid";
-projections[ 1136 ][ 0 ] =  "3144";		projections[ 1136 ][ 1 ] =  "FD54 / Faroe Lambert";
-projections[ 1137 ][ 0 ] =  "3145";		projections[ 1137 ][ 1 ] =  "ETRS89 / Faroe Lambert";
-projections[ 1138 ][ 0 ] =  "3146";		projections[ 1138 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 6";
-projections[ 1139 ][ 0 ] =  "3147";		projections[ 1139 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger CM 18E";
-projections[ 1140 ][ 0 ] =  "3148";		projections[ 1140 ][ 1 ] =  "Indian 1960 / UTM zone 48N";
-projections[ 1141 ][ 0 ] =  "3149";		projections[ 1141 ][ 1 ] =  "Indian 1960 / UTM zone 49N";
-projections[ 1142 ][ 0 ] =  "3150";		projections[ 1142 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 6";
-projections[ 1143 ][ 0 ] =  "3151";		projections[ 1143 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger CM 18E";
-projections[ 1144 ][ 0 ] =  "3152";		projections[ 1144 ][ 1 ] =  "ST74";
-projections[ 1145 ][ 0 ] =  "3153";		projections[ 1145 ][ 1 ] =  "NAD83(CSRS) / BC Albers";
-projections[ 1146 ][ 0 ] =  "3154";		projections[ 1146 ][ 1 ] =  "NAD83(CSRS) / UTM zone 7N";
-projections[ 1147 ][ 0 ] =  "3155";		projections[ 1147 ][ 1 ] =  "NAD83(CSRS) / UTM zone 8N";
-projections[ 1148 ][ 0 ] =  "3156";		projections[ 1148 ][ 1 ] =  "NAD83(CSRS) / UTM zone 9N";
-projections[ 1149 ][ 0 ] =  "3157";		projections[ 1149 ][ 1 ] =  "NAD83(CSRS) / UTM zone 10N";
-projections[ 1150 ][ 0 ] =  "3158";		projections[ 1150 ][ 1 ] =  "NAD83(CSRS) / UTM zone 14N";
-projections[ 1151 ][ 0 ] =  "3159";		projections[ 1151 ][ 1 ] =  "NAD83(CSRS) / UTM zone 15N";
-projections[ 1152 ][ 0 ] =  "3160";		projections[ 1152 ][ 1 ] =  "NAD83(CSRS) / UTM zone 16N";
-projections[ 1153 ][ 0 ] =  "3161";		projections[ 1153 ][ 1 ] =  "NAD83 / Ontario MNR Lambert";
-projections[ 1154 ][ 0 ] =  "3162";		projections[ 1154 ][ 1 ] =  "NAD83(CSRS) / Ontario MNR Lambert";
-projections[ 1155 ][ 0 ] =  "3163";		projections[ 1155 ][ 1 ] =  "RGNC91-93 / Lambert New Caledonia";
-projections[ 1156 ][ 0 ] =  "3164";		projections[ 1156 ][ 1 ] =  "ST87 Ouvea / UTM zone 58S";
-projections[ 1157 ][ 0 ] =  "3165";		projections[ 1157 ][ 1 ] =  "NEA74 Noumea / Noumea Lambert";
-projections[ 1158 ][ 0 ] =  "3166";		projections[ 1158 ][ 1 ] =  "NEA74 Noumea / Noumea Lambert 2";
-projections[ 1159 ][ 0 ] =  "3167";		projections[ 1159 ][ 1 ] =  "Kertau (RSO) / RSO Malaya (ch)";
-projections[ 1160 ][ 0 ] =  "3168";		projections[ 1160 ][ 1 ] =  "Kertau (RSO) / RSO Malaya (m)";
-projections[ 1161 ][ 0 ] =  "3169";		projections[ 1161 ][ 1 ] =  "RGNC91-93 / UTM zone 57S";
-projections[ 1162 ][ 0 ] =  "3170";		projections[ 1162 ][ 1 ] =  "RGNC91-93 / UTM zone 58S";
-projections[ 1163 ][ 0 ] =  "3171";		projections[ 1163 ][ 1 ] =  "RGNC91-93 / UTM zone 59S";
-projections[ 1164 ][ 0 ] =  "3172";		projections[ 1164 ][ 1 ] =  "IGN53 Mare / UTM zone 59S";
-projections[ 1165 ][ 0 ] =  "3173";		projections[ 1165 ][ 1 ] =  "fk89 / Faroe Lambert FK89";
-projections[ 1166 ][ 0 ] =  "3174";		projections[ 1166 ][ 1 ] =  "NAD83 / Great Lakes Albers";
-projections[ 1167 ][ 0 ] =  "3175";		projections[ 1167 ][ 1 ] =  "NAD83 / Great Lakes and St Lawrence Albers";
-projections[ 1168 ][ 0 ] =  "3176";		projections[ 1168 ][ 1 ] =  "Indian 1960 / TM 106 NE";
-projections[ 1169 ][ 0 ] =  "3177";		projections[ 1169 ][ 1 ] =  "LGD2006 / Libya TM";
-projections[ 1170 ][ 0 ] =  "3178";		projections[ 1170 ][ 1 ] =  "GR96 / UTM zone 18N";
-projections[ 1171 ][ 0 ] =  "3179";		projections[ 1171 ][ 1 ] =  "GR96 / UTM zone 19N";
-projections[ 1172 ][ 0 ] =  "3180";		projections[ 1172 ][ 1 ] =  "GR96 / UTM zone 20N";
-projections[ 1173 ][ 0 ] =  "3181";		projections[ 1173 ][ 1 ] =  "GR96 / UTM zone 21N";
-projections[ 1174 ][ 0 ] =  "3182";		projections[ 1174 ][ 1 ] =  "GR96 / UTM zone 22N";
-projections[ 1175 ][ 0 ] =  "3183";		projections[ 1175 ][ 1 ] =  "GR96 / UTM zone 23N";
-projections[ 1176 ][ 0 ] =  "3184";		projections[ 1176 ][ 1 ] =  "GR96 / UTM zone 24N";
-projections[ 1177 ][ 0 ] =  "3185";		projections[ 1177 ][ 1 ] =  "GR96 / UTM zone 25N";
-projections[ 1178 ][ 0 ] =  "3186";		projections[ 1178 ][ 1 ] =  "GR96 / UTM zone 26N";
-projections[ 1179 ][ 0 ] =  "3187";		projections[ 1179 ][ 1 ] =  "GR96 / UTM zone 27N";
-projections[ 1180 ][ 0 ] =  "3188";		projections[ 1180 ][ 1 ] =  "GR96 / UTM zone 28N";
-projections[ 1181 ][ 0 ] =  "3189";		projections[ 1181 ][ 1 ] =  "GR96 / UTM zone 29N";
-projections[ 1182 ][ 0 ] =  "3190";		projections[ 1182 ][ 1 ] =  "LGD2006 / Libya TM zone 5";
-projections[ 1183 ][ 0 ] =  "3191";		projections[ 1183 ][ 1 ] =  "LGD2006 / Libya TM zone 6";
-projections[ 1184 ][ 0 ] =  "3192";		projections[ 1184 ][ 1 ] =  "LGD2006 / Libya TM zone 7";
-projections[ 1185 ][ 0 ] =  "3193";		projections[ 1185 ][ 1 ] =  "LGD2006 / Libya TM zone 8";
-projections[ 1186 ][ 0 ] =  "3194";		projections[ 1186 ][ 1 ] =  "LGD2006 / Libya TM zone 9";
-projections[ 1187 ][ 0 ] =  "3195";		projections[ 1187 ][ 1 ] =  "LGD2006 / Libya TM zone 10";
-projections[ 1188 ][ 0 ] =  "3196";		projections[ 1188 ][ 1 ] =  "LGD2006 / Libya TM zone 11";
-projections[ 1189 ][ 0 ] =  "3197";		projections[ 1189 ][ 1 ] =  "LGD2006 / Libya TM zone 12";
-projections[ 1190 ][ 0 ] =  "3198";		projections[ 1190 ][ 1 ] =  "LGD2006 / Libya TM zone 13";
-projections[ 1191 ][ 0 ] =  "3199";		projections[ 1191 ][ 1 ] =  "LGD2006 / UTM zone 32N";
-projections[ 1192 ][ 0 ] =  "3200";		projections[ 1192 ][ 1 ] =  "FD58 / Iraq zone";
-projections[ 1193 ][ 0 ] =  "3201";		projections[ 1193 ][ 1 ] =  "LGD2006 / UTM zone 33N";
-projections[ 1194 ][ 0 ] =  "3202";		projections[ 1194 ][ 1 ] =  "LGD2006 / UTM zone 34N";
-projections[ 1195 ][ 0 ] =  "3203";		projections[ 1195 ][ 1 ] =  "LGD2006 / UTM zone 35N";
-projections[ 1196 ][ 0 ] =  "3204";		projections[ 1196 ][ 1 ] =  "WGS 84 / SCAR IMW SP19-20";
-projections[ 1197 ][ 0 ] =  "3205";		projections[ 1197 ][ 1 ] =  "WGS 84 / SCAR IMW SP21-22";
-projections[ 1198 ][ 0 ] =  "3206";		projections[ 1198 ][ 1 ] =  "WGS 84 / SCAR IMW SP23-24";
-projections[ 1199 ][ 0 ] =  "3207";		projections[ 1199 ][ 1 ] =  "WGS 84 / SCAR IMW SQ01-02";
-projections[ 1200 ][ 0 ] =  "3208";		projections[ 1200 ][ 1 ] =  "WGS 84 / SCAR IMW SQ19-20";
-projections[ 1201 ][ 0 ] =  "3209";		projections[ 1201 ][ 1 ] =  "WGS 84 / SCAR IMW SQ21-22";
-projections[ 1202 ][ 0 ] =  "3210";		projections[ 1202 ][ 1 ] =  "WGS 84 / SCAR IMW SQ37-38";
-projections[ 1203 ][ 0 ] =  "3211";		projections[ 1203 ][ 1 ] =  "WGS 84 / SCAR IMW SQ39-40";
-projections[ 1204 ][ 0 ] =  "3212";		projections[ 1204 ][ 1 ] =  "WGS 84 / SCAR IMW SQ41-42";
-projections[ 1205 ][ 0 ] =  "3213";		projections[ 1205 ][ 1 ] =  "WGS 84 / SCAR IMW SQ43-44";
-projections[ 1206 ][ 0 ] =  "3214";		projections[ 1206 ][ 1 ] =  "WGS 84 / SCAR IMW SQ45-46";
-projections[ 1207 ][ 0 ] =  "3215";		projections[ 1207 ][ 1 ] =  "WGS 84 / SCAR IMW SQ47-48";
-projections[ 1208 ][ 0 ] =  "3216";		projections[ 1208 ][ 1 ] =  "WGS 84 / SCAR IMW SQ49-50";
-projections[ 1209 ][ 0 ] =  "3217";		projections[ 1209 ][ 1 ] =  "WGS 84 / SCAR IMW SQ51-52";
-projections[ 1210 ][ 0 ] =  "3218";		projections[ 1210 ][ 1 ] =  "WGS 84 / SCAR IMW SQ53-54";
-projections[ 1211 ][ 0 ] =  "3219";		projections[ 1211 ][ 1 ] =  "WGS 84 / SCAR IMW SQ55-56";
-projections[ 1212 ][ 0 ] =  "3220";		projections[ 1212 ][ 1 ] =  "WGS 84 / SCAR IMW SQ57-58";
-projections[ 1213 ][ 0 ] =  "3221";		projections[ 1213 ][ 1 ] =  "WGS 84 / SCAR IMW SR13-14";
-projections[ 1214 ][ 0 ] =  "3222";		projections[ 1214 ][ 1 ] =  "WGS 84 / SCAR IMW SR15-16";
-projections[ 1215 ][ 0 ] =  "3223";		projections[ 1215 ][ 1 ] =  "WGS 84 / SCAR IMW SR17-18";
-projections[ 1216 ][ 0 ] =  "3224";		projections[ 1216 ][ 1 ] =  "WGS 84 / SCAR IMW SR19-20";
-projections[ 1217 ][ 0 ] =  "3225";		projections[ 1217 ][ 1 ] =  "WGS 84 / SCAR IMW SR27-28";
-projections[ 1218 ][ 0 ] =  "3226";		projections[ 1218 ][ 1 ] =  "WGS 84 / SCAR IMW SR29-30";
-projections[ 1219 ][ 0 ] =  "3227";		projections[ 1219 ][ 1 ] =  "WGS 84 / SCAR IMW SR31-32";
-projections[ 1220 ][ 0 ] =  "3228";		projections[ 1220 ][ 1 ] =  "WGS 84 / SCAR IMW SR33-34";
-projections[ 1221 ][ 0 ] =  "3229";		projections[ 1221 ][ 1 ] =  "WGS 84 / SCAR IMW SR35-36";
-projections[ 1222 ][ 0 ] =  "3230";		projections[ 1222 ][ 1 ] =  "WGS 84 / SCAR IMW SR37-38";
-projections[ 1223 ][ 0 ] =  "3231";		projections[ 1223 ][ 1 ] =  "WGS 84 / SCAR IMW SR39-40";
-projections[ 1224 ][ 0 ] =  "3232";		projections[ 1224 ][ 1 ] =  "WGS 84 / SCAR IMW SR41-42";
-projections[ 1225 ][ 0 ] =  "3233";		projections[ 1225 ][ 1 ] =  "WGS 84 / SCAR IMW SR43-44";
-projections[ 1226 ][ 0 ] =  "3234";		projections[ 1226 ][ 1 ] =  "WGS 84 / SCAR IMW SR45-46";
-projections[ 1227 ][ 0 ] =  "3235";		projections[ 1227 ][ 1 ] =  "WGS 84 / SCAR IMW SR47-48";
-projections[ 1228 ][ 0 ] =  "3236";		projections[ 1228 ][ 1 ] =  "WGS 84 / SCAR IMW SR49-50";
-projections[ 1229 ][ 0 ] =  "3237";		projections[ 1229 ][ 1 ] =  "WGS 84 / SCAR IMW SR51-52";
-projections[ 1230 ][ 0 ] =  "3238";		projections[ 1230 ][ 1 ] =  "WGS 84 / SCAR IMW SR53-54";
-projections[ 1231 ][ 0 ] =  "3239";		projections[ 1231 ][ 1 ] =  "WGS 84 / SCAR IMW SR55-56";
-projections[ 1232 ][ 0 ] =  "3240";		projections[ 1232 ][ 1 ] =  "WGS 84 / SCAR IMW SR57-58";
-projections[ 1233 ][ 0 ] =  "3241";		projections[ 1233 ][ 1 ] =  "WGS 84 / SCAR IMW SR59-60";
-projections[ 1234 ][ 0 ] =  "3242";		projections[ 1234 ][ 1 ] =  "WGS 84 / SCAR IMW SS04-06";
-projections[ 1235 ][ 0 ] =  "3243";		projections[ 1235 ][ 1 ] =  "WGS 84 / SCAR IMW SS07-09";
-projections[ 1236 ][ 0 ] =  "3244";		projections[ 1236 ][ 1 ] =  "WGS 84 / SCAR IMW SS10-12";
-projections[ 1237 ][ 0 ] =  "3245";		projections[ 1237 ][ 1 ] =  "WGS 84 / SCAR IMW SS13-15";
-projections[ 1238 ][ 0 ] =  "3246";		projections[ 1238 ][ 1 ] =  "WGS 84 / SCAR IMW SS16-18";
-projections[ 1239 ][ 0 ] =  "3247";		projections[ 1239 ][ 1 ] =  "WGS 84 / SCAR IMW SS19-21";
-projections[ 1240 ][ 0 ] =  "3248";		projections[ 1240 ][ 1 ] =  "WGS 84 / SCAR IMW SS25-27";
-projections[ 1241 ][ 0 ] =  "3249";		projections[ 1241 ][ 1 ] =  "WGS 84 / SCAR IMW SS28-30";
-projections[ 1242 ][ 0 ] =  "3250";		projections[ 1242 ][ 1 ] =  "WGS 84 / SCAR IMW SS31-33";
-projections[ 1243 ][ 0 ] =  "3251";		projections[ 1243 ][ 1 ] =  "WGS 84 / SCAR IMW SS34-36";
-projections[ 1244 ][ 0 ] =  "3252";		projections[ 1244 ][ 1 ] =  "WGS 84 / SCAR IMW SS37-39";
-projections[ 1245 ][ 0 ] =  "3253";		projections[ 1245 ][ 1 ] =  "WGS 84 / SCAR IMW SS40-42";
-projections[ 1246 ][ 0 ] =  "3254";		projections[ 1246 ][ 1 ] =  "WGS 84 / SCAR IMW SS43-45";
-projections[ 1247 ][ 0 ] =  "3255";		projections[ 1247 ][ 1 ] =  "WGS 84 / SCAR IMW SS46-48";
-projections[ 1248 ][ 0 ] =  "3256";		projections[ 1248 ][ 1 ] =  "WGS 84 / SCAR IMW SS49-51";
-projections[ 1249 ][ 0 ] =  "3257";		projections[ 1249 ][ 1 ] =  "WGS 84 / SCAR IMW SS52-54";
-projections[ 1250 ][ 0 ] =  "3258";		projections[ 1250 ][ 1 ] =  "WGS 84 / SCAR IMW SS55-57";
-projections[ 1251 ][ 0 ] =  "3259";		projections[ 1251 ][ 1 ] =  "WGS 84 / SCAR IMW SS58-60";
-projections[ 1252 ][ 0 ] =  "3260";		projections[ 1252 ][ 1 ] =  "WGS 84 / SCAR IMW ST01-04";
-projections[ 1253 ][ 0 ] =  "3261";		projections[ 1253 ][ 1 ] =  "WGS 84 / SCAR IMW ST05-08";
-projections[ 1254 ][ 0 ] =  "3262";		projections[ 1254 ][ 1 ] =  "WGS 84 / SCAR IMW ST09-12";
-projections[ 1255 ][ 0 ] =  "3263";		projections[ 1255 ][ 1 ] =  "WGS 84 / SCAR IMW ST13-16";
-projections[ 1256 ][ 0 ] =  "3264";		projections[ 1256 ][ 1 ] =  "WGS 84 / SCAR IMW ST17-20";
-projections[ 1257 ][ 0 ] =  "3265";		projections[ 1257 ][ 1 ] =  "WGS 84 / SCAR IMW ST21-24";
-projections[ 1258 ][ 0 ] =  "3266";		projections[ 1258 ][ 1 ] =  "WGS 84 / SCAR IMW ST25-28";
-projections[ 1259 ][ 0 ] =  "3267";		projections[ 1259 ][ 1 ] =  "WGS 84 / SCAR IMW ST29-32";
-projections[ 1260 ][ 0 ] =  "3268";		projections[ 1260 ][ 1 ] =  "WGS 84 / SCAR IMW ST33-36";
-projections[ 1261 ][ 0 ] =  "3269";		projections[ 1261 ][ 1 ] =  "WGS 84 / SCAR IMW ST37-40";
-projections[ 1262 ][ 0 ] =  "3270";		projections[ 1262 ][ 1 ] =  "WGS 84 / SCAR IMW ST41-44";
-projections[ 1263 ][ 0 ] =  "3271";		projections[ 1263 ][ 1 ] =  "WGS 84 / SCAR IMW ST45-48";
-projections[ 1264 ][ 0 ] =  "3272";		projections[ 1264 ][ 1 ] =  "WGS 84 / SCAR IMW ST49-52";
-projections[ 1265 ][ 0 ] =  "3273";		projections[ 1265 ][ 1 ] =  "WGS 84 / SCAR IMW ST53-56";
-projections[ 1266 ][ 0 ] =  "3274";		projections[ 1266 ][ 1 ] =  "WGS 84 / SCAR IMW ST57-60";
-projections[ 1267 ][ 0 ] =  "3275";		projections[ 1267 ][ 1 ] =  "WGS 84 / SCAR IMW SU01-05";
-projections[ 1268 ][ 0 ] =  "3276";		projections[ 1268 ][ 1 ] =  "WGS 84 / SCAR IMW SU06-10";
-projections[ 1269 ][ 0 ] =  "3277";		projections[ 1269 ][ 1 ] =  "WGS 84 / SCAR IMW SU11-15";
-projections[ 1270 ][ 0 ] =  "3278";		projections[ 1270 ][ 1 ] =  "WGS 84 / SCAR IMW SU16-20";
-projections[ 1271 ][ 0 ] =  "3279";		projections[ 1271 ][ 1 ] =  "WGS 84 / SCAR IMW SU21-25";
-projections[ 1272 ][ 0 ] =  "3280";		projections[ 1272 ][ 1 ] =  "WGS 84 / SCAR IMW SU26-30";
-projections[ 1273 ][ 0 ] =  "3281";		projections[ 1273 ][ 1 ] =  "WGS 84 / SCAR IMW SU31-35";
-projections[ 1274 ][ 0 ] =  "3282";		projections[ 1274 ][ 1 ] =  "WGS 84 / SCAR IMW SU36-40";
-projections[ 1275 ][ 0 ] =  "3283";		projections[ 1275 ][ 1 ] =  "WGS 84 / SCAR IMW SU41-45";
-projections[ 1276 ][ 0 ] =  "3284";		projections[ 1276 ][ 1 ] =  "WGS 84 / SCAR IMW SU46-50";
-projections[ 1277 ][ 0 ] =  "3285";		projections[ 1277 ][ 1 ] =  "WGS 84 / SCAR IMW SU51-55";
-projections[ 1278 ][ 0 ] =  "3286";		projections[ 1278 ][ 1 ] =  "WGS 84 / SCAR IMW SU56-60";
-projections[ 1279 ][ 0 ] =  "3287";		projections[ 1279 ][ 1 ] =  "WGS 84 / SCAR IMW SV01-10";
-projections[ 1280 ][ 0 ] =  "3288";		projections[ 1280 ][ 1 ] =  "WGS 84 / SCAR IMW SV11-20";
-projections[ 1281 ][ 0 ] =  "3289";		projections[ 1281 ][ 1 ] =  "WGS 84 / SCAR IMW SV21-30";
-projections[ 1282 ][ 0 ] =  "3290";		projections[ 1282 ][ 1 ] =  "WGS 84 / SCAR IMW SV31-40";
-projections[ 1283 ][ 0 ] =  "3291";		projections[ 1283 ][ 1 ] =  "WGS 84 / SCAR IMW SV41-50";
-projections[ 1284 ][ 0 ] =  "3292";		projections[ 1284 ][ 1 ] =  "WGS 84 / SCAR IMW SV51-60";
-projections[ 1285 ][ 0 ] =  "3293";		projections[ 1285 ][ 1 ] =  "WGS 84 / SCAR IMW SW01-60";
-projections[ 1286 ][ 0 ] =  "3294";		projections[ 1286 ][ 1 ] =  "WGS 84 / USGS Transantarctic Mountains";
-projections[ 1287 ][ 0 ] =  "3295";		projections[ 1287 ][ 1 ] =  "Guam 1963 / Yap Islands";
-projections[ 1288 ][ 0 ] =  "3296";		projections[ 1288 ][ 1 ] =  "RGPF / UTM zone 5S";
-projections[ 1289 ][ 0 ] =  "3297";		projections[ 1289 ][ 1 ] =  "RGPF / UTM zone 6S";
-projections[ 1290 ][ 0 ] =  "3298";		projections[ 1290 ][ 1 ] =  "RGPF / UTM zone 7S";
-projections[ 1291 ][ 0 ] =  "3299";		projections[ 1291 ][ 1 ] =  "RGPF / UTM zone 8S";
-projections[ 1292 ][ 0 ] =  "3300";		projections[ 1292 ][ 1 ] =  "Estonian Coordinate System of 1992";
-projections[ 1293 ][ 0 ] =  "3301";		projections[ 1293 ][ 1 ] =  "Estonian Coordinate System of 1997";
-projections[ 1294 ][ 0 ] =  "3302";		projections[ 1294 ][ 1 ] =  "IGN63 Hiva Oa / UTM zone 7S";
-projections[ 1295 ][ 0 ] =  "3303";		projections[ 1295 ][ 1 ] =  "Fatu Iva 72 / UTM zone 7S";
-projections[ 1296 ][ 0 ] =  "3304";		projections[ 1296 ][ 1 ] =  "Tahiti 79 / UTM zone 6S";
-projections[ 1297 ][ 0 ] =  "3305";		projections[ 1297 ][ 1 ] =  "Moorea 87 / UTM zone 6S";
-projections[ 1298 ][ 0 ] =  "3306";		projections[ 1298 ][ 1 ] =  "Maupiti 83 / UTM zone 5S";
-projections[ 1299 ][ 0 ] =  "3307";		projections[ 1299 ][ 1 ] =  "Nakhl-e Ghanem / UTM zone 39N";
-projections[ 1300 ][ 0 ] =  "3308";		projections[ 1300 ][ 1 ] =  "GDA94 / NSW Lambert";
-projections[ 1301 ][ 0 ] =  "3309";		projections[ 1301 ][ 1 ] =  "NAD27 / California Albers";
-projections[ 1302 ][ 0 ] =  "3310";		projections[ 1302 ][ 1 ] =  "NAD83 / California Albers";
-projections[ 1303 ][ 0 ] =  "3311";		projections[ 1303 ][ 1 ] =  "NAD83(HARN) / California Albers";
-projections[ 1304 ][ 0 ] =  "3312";		projections[ 1304 ][ 1 ] =  "CSG67 / UTM zone 21N";
-projections[ 1305 ][ 0 ] =  "3313";		projections[ 1305 ][ 1 ] =  "RGFG95 / UTM zone 21N";
-projections[ 1306 ][ 0 ] =  "3314";		projections[ 1306 ][ 1 ] =  "Katanga 1955 / Katanga Lambert";
-projections[ 1307 ][ 0 ] =  "3315";		projections[ 1307 ][ 1 ] =  "Katanga 1955 / Katanga TM";
-projections[ 1308 ][ 0 ] =  "3316";		projections[ 1308 ][ 1 ] =  "Kasai 1953 / Congo TM zone 22";
-projections[ 1309 ][ 0 ] =  "3317";		projections[ 1309 ][ 1 ] =  "Kasai 1953 / Congo TM zone 24";
-projections[ 1310 ][ 0 ] =  "3318";		projections[ 1310 ][ 1 ] =  "IGC 1962 / Congo TM zone 12";
-projections[ 1311 ][ 0 ] =  "3319";		projections[ 1311 ][ 1 ] =  "IGC 1962 / Congo TM zone 14";
-projections[ 1312 ][ 0 ] =  "3320";		projections[ 1312 ][ 1 ] =  "IGC 1962 / Congo TM zone 16";
-projections[ 1313 ][ 0 ] =  "3321";		projections[ 1313 ][ 1 ] =  "IGC 1962 / Congo TM zone 18";
-projections[ 1314 ][ 0 ] =  "3322";		projections[ 1314 ][ 1 ] =  "IGC 1962 / Congo TM zone 20";
-projections[ 1315 ][ 0 ] =  "3323";		projections[ 1315 ][ 1 ] =  "IGC 1962 / Congo TM zone 22";
-projections[ 1316 ][ 0 ] =  "3324";		projections[ 1316 ][ 1 ] =  "IGC 1962 / Congo TM zone 24";
-projections[ 1317 ][ 0 ] =  "3325";		projections[ 1317 ][ 1 ] =  "IGC 1962 / Congo TM zone 26";
-projections[ 1318 ][ 0 ] =  "3326";		projections[ 1318 ][ 1 ] =  "IGC 1962 / Congo TM zone 28";
-projections[ 1319 ][ 0 ] =  "3327";		projections[ 1319 ][ 1 ] =  "IGC 1962 / Congo TM zone 30";
-projections[ 1320 ][ 0 ] =  "3328";		projections[ 1320 ][ 1 ] =  "Pulkovo 1942(58) / GUGiK-80";
-projections[ 1321 ][ 0 ] =  "3329";		projections[ 1321 ][ 1 ] =  "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 5";
-projections[ 1322 ][ 0 ] =  "3330";		projections[ 1322 ][ 1 ] =  "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 6";
-projections[ 1323 ][ 0 ] =  "3331";		projections[ 1323 ][ 1 ] =  "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 7";
-projections[ 1324 ][ 0 ] =  "3332";		projections[ 1324 ][ 1 ] =  "Pulkovo 1942(58) / 3-degree Gauss-Kruger zone 8";
-projections[ 1325 ][ 0 ] =  "3333";		projections[ 1325 ][ 1 ] =  "Pulkovo 1942(58) / Gauss-Kruger zone 3";
-projections[ 1326 ][ 0 ] =  "3334";		projections[ 1326 ][ 1 ] =  "Pulkovo 1942(58) / Gauss-Kruger zone 4";
-projections[ 1327 ][ 0 ] =  "3335";		projections[ 1327 ][ 1 ] =  "Pulkovo 1942(58) / Gauss-Kruger zone 5";
-projections[ 1328 ][ 0 ] =  "3336";		projections[ 1328 ][ 1 ] =  "IGN 1962 Kerguelen / UTM zone 42S";
-projections[ 1329 ][ 0 ] =  "3337";		projections[ 1329 ][ 1 ] =  "Le Pouce 1934 / Mauritius Grid";
-projections[ 1330 ][ 0 ] =  "3338";		projections[ 1330 ][ 1 ] =  "NAD83 / Alaska Albers";
-projections[ 1331 ][ 0 ] =  "3339";		projections[ 1331 ][ 1 ] =  "IGCB 1955 / Congo TM zone 12";
-projections[ 1332 ][ 0 ] =  "3340";		projections[ 1332 ][ 1 ] =  "IGCB 1955 / Congo TM zone 14";
-projections[ 1333 ][ 0 ] =  "3341";		projections[ 1333 ][ 1 ] =  "IGCB 1955 / Congo TM zone 16";
-projections[ 1334 ][ 0 ] =  "3342";		projections[ 1334 ][ 1 ] =  "IGCB 1955 / UTM zone 33S";
-projections[ 1335 ][ 0 ] =  "3343";		projections[ 1335 ][ 1 ] =  "Mauritania 1999 / UTM zone 28N";
-projections[ 1336 ][ 0 ] =  "3344";		projections[ 1336 ][ 1 ] =  "Mauritania 1999 / UTM zone 29N";
-projections[ 1337 ][ 0 ] =  "3345";		projections[ 1337 ][ 1 ] =  "Mauritania 1999 / UTM zone 30N";
-projections[ 1338 ][ 0 ] =  "3346";		projections[ 1338 ][ 1 ] =  "LKS94 / Lithuania TM";
-projections[ 1339 ][ 0 ] =  "3347";		projections[ 1339 ][ 1 ] =  "NAD83 / Statistics Canada Lambert";
-projections[ 1340 ][ 0 ] =  "3348";		projections[ 1340 ][ 1 ] =  "NAD83(CSRS) / Statistics Canada Lambert";
-projections[ 1341 ][ 0 ] =  "3349";		projections[ 1341 ][ 1 ] =  "WGS 84 / PDC Mercator";
-projections[ 1342 ][ 0 ] =  "3350";		projections[ 1342 ][ 1 ] =  "Pulkovo 1942 / CS63 zone C0";
-projections[ 1343 ][ 0 ] =  "3351";		projections[ 1343 ][ 1 ] =  "Pulkovo 1942 / CS63 zone C1";
-projections[ 1344 ][ 0 ] =  "3352";		projections[ 1344 ][ 1 ] =  "Pulkovo 1942 / CS63 zone C2";
-projections[ 1345 ][ 0 ] =  "3353";		projections[ 1345 ][ 1 ] =  "Mhast (onshore) / UTM zone 32S";
-projections[ 1346 ][ 0 ] =  "3354";		projections[ 1346 ][ 1 ] =  "Mhast (offshore) / UTM zone 32S";
-projections[ 1347 ][ 0 ] =  "3355";		projections[ 1347 ][ 1 ] =  "Egypt Gulf of Suez S-650 TL / Red Belt";
-projections[ 1348 ][ 0 ] =  "3356";		projections[ 1348 ][ 1 ] =  "Grand Cayman 1959 / UTM zone 17N";
-projections[ 1349 ][ 0 ] =  "3357";		projections[ 1349 ][ 1 ] =  "Little Cayman 1961 / UTM zone 17N";
-projections[ 1350 ][ 0 ] =  "3358";		projections[ 1350 ][ 1 ] =  "NAD83(HARN) / North Carolina";
-projections[ 1351 ][ 0 ] =  "3359";		projections[ 1351 ][ 1 ] =  "NAD83(HARN) / North Carolina (ftUS)";
-projections[ 1352 ][ 0 ] =  "3360";		projections[ 1352 ][ 1 ] =  "NAD83(HARN) / South Carolina";
-projections[ 1353 ][ 0 ] =  "3361";		projections[ 1353 ][ 1 ] =  "NAD83(HARN) / South Carolina (ft)";
-projections[ 1354 ][ 0 ] =  "3362";		projections[ 1354 ][ 1 ] =  "NAD83(HARN) / Pennsylvania North";
-projections[ 1355 ][ 0 ] =  "3363";		projections[ 1355 ][ 1 ] =  "NAD83(HARN) / Pennsylvania North (ftUS)";
-projections[ 1356 ][ 0 ] =  "3364";		projections[ 1356 ][ 1 ] =  "NAD83(HARN) / Pennsylvania South";
-projections[ 1357 ][ 0 ] =  "3365";		projections[ 1357 ][ 1 ] =  "NAD83(HARN) / Pennsylvania South (ftUS)";
-projections[ 1358 ][ 0 ] =  "3366";		projections[ 1358 ][ 1 ] =  "Hong Kong 1963 Grid System";
-projections[ 1359 ][ 0 ] =  "3367";		projections[ 1359 ][ 1 ] =  "IGN Astro 1960 / UTM zone 28N";
-projections[ 1360 ][ 0 ] =  "3368";		projections[ 1360 ][ 1 ] =  "IGN Astro 1960 / UTM zone 29N";
-projections[ 1361 ][ 0 ] =  "3369";		projections[ 1361 ][ 1 ] =  "IGN Astro 1960 / UTM zone 30N";
-projections[ 1362 ][ 0 ] =  "3370";		projections[ 1362 ][ 1 ] =  "NAD27 / UTM zone 59N";
-projections[ 1363 ][ 0 ] =  "3371";		projections[ 1363 ][ 1 ] =  "NAD27 / UTM zone 60N";
-projections[ 1364 ][ 0 ] =  "3372";		projections[ 1364 ][ 1 ] =  "NAD83 / UTM zone 59N";
-projections[ 1365 ][ 0 ] =  "3373";		projections[ 1365 ][ 1 ] =  "NAD83 / UTM zone 60N";
-projections[ 1366 ][ 0 ] =  "3374";		projections[ 1366 ][ 1 ] =  "FD54 / UTM zone 29N";
-projections[ 1367 ][ 0 ] =  "3375";		projections[ 1367 ][ 1 ] =  "GDM2000 / Peninsula RSO";
-projections[ 1368 ][ 0 ] =  "3376";		projections[ 1368 ][ 1 ] =  "GDM2000 / East Malaysia BRSO";
-projections[ 1369 ][ 0 ] =  "3377";		projections[ 1369 ][ 1 ] =  "GDM2000 / Johor Grid";
-projections[ 1370 ][ 0 ] =  "3378";		projections[ 1370 ][ 1 ] =  "GDM2000 / Sembilan and Melaka Grid";
-projections[ 1371 ][ 0 ] =  "3379";		projections[ 1371 ][ 1 ] =  "GDM2000 / PahangGrid";
-projections[ 1372 ][ 0 ] =  "3380";		projections[ 1372 ][ 1 ] =  "GDM2000 / Selangor Grid";
-projections[ 1373 ][ 0 ] =  "3381";		projections[ 1373 ][ 1 ] =  "GDM2000 / Terengganu Grid";
-projections[ 1374 ][ 0 ] =  "3382";		projections[ 1374 ][ 1 ] =  "GDM2000 / Pinang Grid";
-projections[ 1375 ][ 0 ] =  "3383";		projections[ 1375 ][ 1 ] =  "GDM2000 / Kedah and Perlis Grid";
-projections[ 1376 ][ 0 ] =  "3384";		projections[ 1376 ][ 1 ] =  "GDM2000 / Perak Grid";
-projections[ 1377 ][ 0 ] =  "3385";		projections[ 1377 ][ 1 ] =  "GDM2000 / Kelantan Grid";
-projections[ 1378 ][ 0 ] =  "3386";		projections[ 1378 ][ 1 ] =  "KKJ / Finland zone 0";
-projections[ 1379 ][ 0 ] =  "3387";		projections[ 1379 ][ 1 ] =  "KKJ / Finland zone 5";
-projections[ 1380 ][ 0 ] =  "3388";		projections[ 1380 ][ 1 ] =  "Pulkovo 1942 / Caspian Sea Mercator";
-projections[ 1381 ][ 0 ] =  "3389";		projections[ 1381 ][ 1 ] =  "Pulkovo 1942 / 3-degree Gauss-Kruger zone 60";
-projections[ 1382 ][ 0 ] =  "3390";		projections[ 1382 ][ 1 ] =  "Pulkovo 1995 / 3-degree Gauss-Kruger zone 60";
-projections[ 1383 ][ 0 ] =  "3391";		projections[ 1383 ][ 1 ] =  "Karbala 1979 (Polservice) / UTM zone 37N";
-projections[ 1384 ][ 0 ] =  "3392";		projections[ 1384 ][ 1 ] =  "Karbala 1979 (Polservice) / UTM zone 38N";
-projections[ 1385 ][ 0 ] =  "3393";		projections[ 1385 ][ 1 ] =  "Karbala 1979 (Polservice) / UTM zone 39N";
-projections[ 1386 ][ 0 ] =  "3394";		projections[ 1386 ][ 1 ] =  "Nahrwan 1934 / Iraq zone";
-projections[ 1387 ][ 0 ] =  "3395";		projections[ 1387 ][ 1 ] =  "WGS 84 / World Mercator";
-projections[ 1388 ][ 0 ] =  "3396";		projections[ 1388 ][ 1 ] =  "PD/83 / Gauss-Kruger zone 3";
-projections[ 1389 ][ 0 ] =  "3397";		projections[ 1389 ][ 1 ] =  "PD/83 / Gauss-Kruger zone 4";
-projections[ 1390 ][ 0 ] =  "3398";		projections[ 1390 ][ 1 ] =  "RD/83 / Gauss-Kruger zone 4";
-projections[ 1391 ][ 0 ] =  "3399";		projections[ 1391 ][ 1 ] =  "RD/83 / Gauss-Kruger zone 5";
-projections[ 1392 ][ 0 ] =  "3400";		projections[ 1392 ][ 1 ] =  "NAD83 / Alberta 10-TM (Forest)";
-projections[ 1393 ][ 0 ] =  "3401";		projections[ 1393 ][ 1 ] =  "NAD83 / Alberta 10-TM (Resource)";
-projections[ 1394 ][ 0 ] =  "3402";		projections[ 1394 ][ 1 ] =  "NAD83(CSRS) / Alberta 10-TM (Forest)";
-projections[ 1395 ][ 0 ] =  "3403";		projections[ 1395 ][ 1 ] =  "NAD83(CSRS) / Alberta 10-TM (Resource)";
-projections[ 1396 ][ 0 ] =  "3404";		projections[ 1396 ][ 1 ] =  "NAD83(HARN) / North Carolina (ftUS)";
-projections[ 1397 ][ 0 ] =  "3405";		projections[ 1397 ][ 1 ] =  "VN-2000 / UTM zone 48N";
-projections[ 1398 ][ 0 ] =  "3406";		projections[ 1398 ][ 1 ] =  "VN-2000 / UTM zone 49N";
-projections[ 1399 ][ 0 ] =  "3407";		projections[ 1399 ][ 1 ] =  "Hong Kong 1963 Grid System";
-projections[ 1400 ][ 0 ] =  "3408";		projections[ 1400 ][ 1 ] =  "NSIDC EASE-Grid North";
-projections[ 1401 ][ 0 ] =  "3409";		projections[ 1401 ][ 1 ] =  "NSIDC EASE-Grid South";
-projections[ 1402 ][ 0 ] =  "3410";		projections[ 1402 ][ 1 ] =  "NSIDC EASE-Grid Global";
-projections[ 1403 ][ 0 ] =  "3411";		projections[ 1403 ][ 1 ] =  "NSIDC Sea Ice Polar Stereographic North";
-projections[ 1404 ][ 0 ] =  "3412";		projections[ 1404 ][ 1 ] =  "NSIDC Sea Ice Polar Stereographic South";
-projections[ 1405 ][ 0 ] =  "3413";		projections[ 1405 ][ 1 ] =  "WGS 84 / NSIDC Sea Ice Polar Stereographic North";
-projections[ 1406 ][ 0 ] =  "3414";		projections[ 1406 ][ 1 ] =  "SVY21 / Singapore TM";
-projections[ 1407 ][ 0 ] =  "3415";		projections[ 1407 ][ 1 ] =  "WGS 72BE / South China Sea Lambert";
-projections[ 1408 ][ 0 ] =  "3416";		projections[ 1408 ][ 1 ] =  "ETRS89 / Austria Lambert";
-projections[ 1409 ][ 0 ] =  "3417";		projections[ 1409 ][ 1 ] =  "NAD83 / Iowa North (ft US)";
-projections[ 1410 ][ 0 ] =  "3418";		projections[ 1410 ][ 1 ] =  "NAD83 / Iowa South (ft US)";
-projections[ 1411 ][ 0 ] =  "3419";		projections[ 1411 ][ 1 ] =  "NAD83 / Kansas North (ft US)";
-projections[ 1412 ][ 0 ] =  "3420";		projections[ 1412 ][ 1 ] =  "NAD83 / Kansas South (ft US)";
-projections[ 1413 ][ 0 ] =  "3421";		projections[ 1413 ][ 1 ] =  "NAD83 / Nevada East (ft US)";
-projections[ 1414 ][ 0 ] =  "3422";		projections[ 1414 ][ 1 ] =  "NAD83 / Nevada Central (ft US)";
-projections[ 1415 ][ 0 ] =  "3423";		projections[ 1415 ][ 1 ] =  "NAD83 / Nevada West (ft US)";
-projections[ 1416 ][ 0 ] =  "3424";		projections[ 1416 ][ 1 ] =  "NAD83 / New Jersey (ft US)";
-projections[ 1417 ][ 0 ] =  "3425";		projections[ 1417 ][ 1 ] =  "NAD83(HARN) / Iowa North (ft US)";
-projections[ 1418 ][ 0 ] =  "3426";		projections[ 1418 ][ 1 ] =  "NAD83(HARN) / Iowa South (ft US)";
-projections[ 1419 ][ 0 ] =  "3427";		projections[ 1419 ][ 1 ] =  "NAD83(HARN) / Kansas North (ft US)";
-projections[ 1420 ][ 0 ] =  "3428";		projections[ 1420 ][ 1 ] =  "NAD83(HARN) / Kansas South (ft US)";
-projections[ 1421 ][ 0 ] =  "3429";		projections[ 1421 ][ 1 ] =  "NAD83(HARN) / Nevada East (ft US)";
-projections[ 1422 ][ 0 ] =  "3430";		projections[ 1422 ][ 1 ] =  "NAD83(HARN) / Nevada Central (ft US)";
-projections[ 1423 ][ 0 ] =  "3431";		projections[ 1423 ][ 1 ] =  "NAD83(HARN) / Nevada West (ft US)";
-projections[ 1424 ][ 0 ] =  "3432";		projections[ 1424 ][ 1 ] =  "NAD83(HARN) / New Jersey (ft US)";
-projections[ 1425 ][ 0 ] =  "3433";		projections[ 1425 ][ 1 ] =  "NAD83 / Arkansas North (ftUS)";
-projections[ 1426 ][ 0 ] =  "3434";		projections[ 1426 ][ 1 ] =  "NAD83 / Arkansas South (ftUS)";
-projections[ 1427 ][ 0 ] =  "3435";		projections[ 1427 ][ 1 ] =  "NAD83 / Illinois East (ftUS)";
-projections[ 1428 ][ 0 ] =  "3436";		projections[ 1428 ][ 1 ] =  "NAD83 / Illinois West (ftUS)";
-projections[ 1429 ][ 0 ] =  "3437";		projections[ 1429 ][ 1 ] =  "NAD83 / New Hampshire (ftUS)";
-projections[ 1430 ][ 0 ] =  "3438";		projections[ 1430 ][ 1 ] =  "NAD83 / Rhode Island (ftUS)";
-projections[ 1431 ][ 0 ] =  "3439";		projections[ 1431 ][ 1 ] =  "PSD93 / UTM zone 39N";
-projections[ 1432 ][ 0 ] =  "3440";		projections[ 1432 ][ 1 ] =  "PSD93 / UTM zone 40N";
-projections[ 1433 ][ 0 ] =  "3441";		projections[ 1433 ][ 1 ] =  "NAD83(HARN) / Arkansas North (ftUS)";
-projections[ 1434 ][ 0 ] =  "3442";		projections[ 1434 ][ 1 ] =  "NAD83(HARN) / Arkansas South (ftUS)";
-projections[ 1435 ][ 0 ] =  "3443";		projections[ 1435 ][ 1 ] =  "NAD83(HARN) / Illinois East (ftUS)";
-projections[ 1436 ][ 0 ] =  "3444";		projections[ 1436 ][ 1 ] =  "NAD83(HARN) / Illinois West (ftUS)";
-projections[ 1437 ][ 0 ] =  "3445";		projections[ 1437 ][ 1 ] =  "NAD83(HARN) / New Hampshire (ftUS)";
-projections[ 1438 ][ 0 ] =  "3446";		projections[ 1438 ][ 1 ] =  "NAD83(HARN) / Rhode Island (ftUS)";
-projections[ 1439 ][ 0 ] =  "3447";		projections[ 1439 ][ 1 ] =  "ETRS89 / Belgian Lambert 2005";
-projections[ 1440 ][ 0 ] =  "3448";		projections[ 1440 ][ 1 ] =  "JAD2001 / Jamaica Metric Grid";
-projections[ 1441 ][ 0 ] =  "3449";		projections[ 1441 ][ 1 ] =  "JAD2001 / UTM zone 17N";
-projections[ 1442 ][ 0 ] =  "3450";		projections[ 1442 ][ 1 ] =  "JAD2001 / UTM zone 18N";
-projections[ 1443 ][ 0 ] =  "3451";		projections[ 1443 ][ 1 ] =  "NAD83 / Louisiana North (ftUS)";
-projections[ 1444 ][ 0 ] =  "3452";		projections[ 1444 ][ 1 ] =  "NAD83 / Louisiana South (ftUS)";
-projections[ 1445 ][ 0 ] =  "3453";		projections[ 1445 ][ 1 ] =  "NAD83 / Louisiana Offshore (ftUS)";
-projections[ 1446 ][ 0 ] =  "3454";		projections[ 1446 ][ 1 ] =  "NAD83 / South Dakota North (ftUS)";
-projections[ 1447 ][ 0 ] =  "3455";		projections[ 1447 ][ 1 ] =  "NAD83 / South Dakota South (ftUS)";
-projections[ 1448 ][ 0 ] =  "3456";		projections[ 1448 ][ 1 ] =  "NAD83(HARN) / Louisiana North (ftUS)";
-projections[ 1449 ][ 0 ] =  "3457";		projections[ 1449 ][ 1 ] =  "NAD83(HARN) / Louisiana South (ftUS)";
-projections[ 1450 ][ 0 ] =  "3458";		projections[ 1450 ][ 1 ] =  "NAD83(HARN) / South Dakota North (ftUS)";
-projections[ 1451 ][ 0 ] =  "3459";		projections[ 1451 ][ 1 ] =  "NAD83(HARN) / South Dakota South (ftUS)";
-projections[ 1452 ][ 0 ] =  "3460";		projections[ 1452 ][ 1 ] =  "Fiji 1986 / Fiji Map Grid";
-projections[ 1453 ][ 0 ] =  "3461";		projections[ 1453 ][ 1 ] =  "Dabola 1981 / UTM zone 28N";
-projections[ 1454 ][ 0 ] =  "3462";		projections[ 1454 ][ 1 ] =  "Dabola 1981 / UTM zone 29N";
-projections[ 1455 ][ 0 ] =  "3463";		projections[ 1455 ][ 1 ] =  "NAD83 / Maine CS2000 Central";
-projections[ 1456 ][ 0 ] =  "3464";		projections[ 1456 ][ 1 ] =  "NAD83(HARN) / Maine CS2000 Central";
-projections[ 1457 ][ 0 ] =  "3465";		projections[ 1457 ][ 1 ] =  "NAD83(NSRS2007) / Alabama East";
-projections[ 1458 ][ 0 ] =  "3466";		projections[ 1458 ][ 1 ] =  "NAD83(NSRS2007) / Alabama West";
-projections[ 1459 ][ 0 ] =  "3467";		projections[ 1459 ][ 1 ] =  "NAD83(NSRS2007) / Alaska Albers";
-projections[ 1460 ][ 0 ] =  "3468";		projections[ 1460 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 1";
-projections[ 1461 ][ 0 ] =  "3469";		projections[ 1461 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 2";
-projections[ 1462 ][ 0 ] =  "3470";		projections[ 1462 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 3";
-projections[ 1463 ][ 0 ] =  "3471";		projections[ 1463 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 4";
-projections[ 1464 ][ 0 ] =  "3472";		projections[ 1464 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 5";
-projections[ 1465 ][ 0 ] =  "3473";		projections[ 1465 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 6";
-projections[ 1466 ][ 0 ] =  "3474";		projections[ 1466 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 7";
-projections[ 1467 ][ 0 ] =  "3475";		projections[ 1467 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 8";
-projections[ 1468 ][ 0 ] =  "3476";		projections[ 1468 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 9";
-projections[ 1469 ][ 0 ] =  "3477";		projections[ 1469 ][ 1 ] =  "NAD83(NSRS2007) / Alaska zone 10";
-projections[ 1470 ][ 0 ] =  "3478";		projections[ 1470 ][ 1 ] =  "NAD83(NSRS2007) / Arizona Central";
-projections[ 1471 ][ 0 ] =  "3479";		projections[ 1471 ][ 1 ] =  "NAD83(NSRS2007) / Arizona Central (ft)";
-projections[ 1472 ][ 0 ] =  "3480";		projections[ 1472 ][ 1 ] =  "NAD83(NSRS2007) / Arizona East";
-projections[ 1473 ][ 0 ] =  "3481";		projections[ 1473 ][ 1 ] =  "NAD83(NSRS2007) / Arizona East (ft)";
-projections[ 1474 ][ 0 ] =  "3482";		projections[ 1474 ][ 1 ] =  "NAD83(NSRS2007) / Arizona West";
-projections[ 1475 ][ 0 ] =  "3483";		projections[ 1475 ][ 1 ] =  "NAD83(NSRS2007) / Arizona West (ft)";
-projections[ 1476 ][ 0 ] =  "3484";		projections[ 1476 ][ 1 ] =  "NAD83(NSRS2007) / Arkansas North";
-projections[ 1477 ][ 0 ] =  "3485";		projections[ 1477 ][ 1 ] =  "NAD83(NSRS2007) / Arkansas North (ftUS)";
-projections[ 1478 ][ 0 ] =  "3486";		projections[ 1478 ][ 1 ] =  "NAD83(NSRS2007) / Arkansas South";
-projections[ 1479 ][ 0 ] =  "3487";		projections[ 1479 ][ 1 ] =  "NAD83(NSRS2007) / Arkansas South (ftUS)";
-projections[ 1480 ][ 0 ] =  "3488";		projections[ 1480 ][ 1 ] =  "NAD83(NSRS2007) / California Albers";
-projections[ 1481 ][ 0 ] =  "3489";		projections[ 1481 ][ 1 ] =  "NAD83(NSRS2007) / California zone 1";
-projections[ 1482 ][ 0 ] =  "3490";		projections[ 1482 ][ 1 ] =  "NAD83(NSRS2007) / California zone 1 (ftUS)";
-projections[ 1483 ][ 0 ] =  "3491";		projections[ 1483 ][ 1 ] =  "NAD83(NSRS2007) / California zone 2";
-projections[ 1484 ][ 0 ] =  "3492";		projections[ 1484 ][ 1 ] =  "NAD83(NSRS2007) / California zone 2 (ftUS)";
-projections[ 1485 ][ 0 ] =  "3493";		projections[ 1485 ][ 1 ] =  "NAD83(NSRS2007) / California zone 3";
-projections[ 1486 ][ 0 ] =  "3494";		projections[ 1486 ][ 1 ] =  "NAD83(NSRS2007) / California zone 3 (ftUS)";
-projections[ 1487 ][ 0 ] =  "3495";		projections[ 1487 ][ 1 ] =  "NAD83(NSRS2007) / California zone 4";
-projections[ 1488 ][ 0 ] =  "3496";		projections[ 1488 ][ 1 ] =  "NAD83(NSRS2007) / California zone 4 (ftUS)";
-projections[ 1489 ][ 0 ] =  "3497";		projections[ 1489 ][ 1 ] =  "NAD83(NSRS2007) / California zone 5";
-projections[ 1490 ][ 0 ] =  "3498";		projections[ 1490 ][ 1 ] =  "NAD83(NSRS2007) / California zone 5 (ftUS)";
-projections[ 1491 ][ 0 ] =  "3499";		projections[ 1491 ][ 1 ] =  "NAD83(NSRS2007) / California zone 6";
-projections[ 1492 ][ 0 ] =  "3500";		projections[ 1492 ][ 1 ] =  "NAD83(NSRS2007) / California zone 6 (ftUS)";
-projections[ 1493 ][ 0 ] =  "3501";		projections[ 1493 ][ 1 ] =  "NAD83(NSRS2007) / Colorado Central";
-projections[ 1494 ][ 0 ] =  "3502";		projections[ 1494 ][ 1 ] =  "NAD83(NSRS2007) / Colorado Central (ftUS)";
-projections[ 1495 ][ 0 ] =  "3503";		projections[ 1495 ][ 1 ] =  "NAD83(NSRS2007) / Colorado North";
-projections[ 1496 ][ 0 ] =  "3504";		projections[ 1496 ][ 1 ] =  "NAD83(NSRS2007) / Colorado North (ftUS)";
-projections[ 1497 ][ 0 ] =  "3505";		projections[ 1497 ][ 1 ] =  "NAD83(NSRS2007) / Colorado South";
-projections[ 1498 ][ 0 ] =  "3506";		projections[ 1498 ][ 1 ] =  "NAD83(NSRS2007) / Colorado South (ftUS)";
-projections[ 1499 ][ 0 ] =  "3507";		projections[ 1499 ][ 1 ] =  "NAD83(NSRS2007) / Connecticut";
-projections[ 1500 ][ 0 ] =  "3508";		projections[ 1500 ][ 1 ] =  "NAD83(NSRS2007) / Connecticut (ftUS)";
-projections[ 1501 ][ 0 ] =  "3509";		projections[ 1501 ][ 1 ] =  "NAD83(NSRS2007) / Delaware";
-projections[ 1502 ][ 0 ] =  "3510";		projections[ 1502 ][ 1 ] =  "NAD83(NSRS2007) / Delaware (ftUS)";
-projections[ 1503 ][ 0 ] =  "3511";		projections[ 1503 ][ 1 ] =  "NAD83(NSRS2007) / Florida East";
-projections[ 1504 ][ 0 ] =  "3512";		projections[ 1504 ][ 1 ] =  "NAD83(NSRS2007) / Florida East (ftUS)";
-projections[ 1505 ][ 0 ] =  "3513";		projections[ 1505 ][ 1 ] =  "NAD83(NSRS2007) / Florida GDL Albers";
-projections[ 1506 ][ 0 ] =  "3514";		projections[ 1506 ][ 1 ] =  "NAD83(NSRS2007) / Florida North";
-projections[ 1507 ][ 0 ] =  "3515";		projections[ 1507 ][ 1 ] =  "NAD83(NSRS2007) / Florida North (ftUS)";
-projections[ 1508 ][ 0 ] =  "3516";		projections[ 1508 ][ 1 ] =  "NAD83(NSRS2007) / Florida West";
-projections[ 1509 ][ 0 ] =  "3517";		projections[ 1509 ][ 1 ] =  "NAD83(NSRS2007) / Florida West (ftUS)";
-projections[ 1510 ][ 0 ] =  "3518";		projections[ 1510 ][ 1 ] =  "NAD83(NSRS2007) / Georgia East";
-projections[ 1511 ][ 0 ] =  "3519";		projections[ 1511 ][ 1 ] =  "NAD83(NSRS2007) / Georgia East (ftUS)";
-projections[ 1512 ][ 0 ] =  "3520";		projections[ 1512 ][ 1 ] =  "NAD83(NSRS2007) / Georgia West";
-projections[ 1513 ][ 0 ] =  "3521";		projections[ 1513 ][ 1 ] =  "NAD83(NSRS2007) / Georgia West (ftUS)";
-projections[ 1514 ][ 0 ] =  "3522";		projections[ 1514 ][ 1 ] =  "NAD83(NSRS2007) / Idaho Central";
-projections[ 1515 ][ 0 ] =  "3523";		projections[ 1515 ][ 1 ] =  "NAD83(NSRS2007) / Idaho Central (ftUS)";
-projections[ 1516 ][ 0 ] =  "3524";		projections[ 1516 ][ 1 ] =  "NAD83(NSRS2007) / Idaho East";
-projections[ 1517 ][ 0 ] =  "3525";		projections[ 1517 ][ 1 ] =  "NAD83(NSRS2007) / Idaho East (ftUS)";
-projections[ 1518 ][ 0 ] =  "3526";		projections[ 1518 ][ 1 ] =  "NAD83(NSRS2007) / Idaho West";
-projections[ 1519 ][ 0 ] =  "3527";		projections[ 1519 ][ 1 ] =  "NAD83(NSRS2007) / Idaho West (ftUS)";
-projections[ 1520 ][ 0 ] =  "3528";		projections[ 1520 ][ 1 ] =  "NAD83(NSRS2007) / Illinois East";
-projections[ 1521 ][ 0 ] =  "3529";		projections[ 1521 ][ 1 ] =  "NAD83(NSRS2007) / Illinois East (ftUS)";
-projections[ 1522 ][ 0 ] =  "3530";		projections[ 1522 ][ 1 ] =  "NAD83(NSRS2007) / Illinois West";
-projections[ 1523 ][ 0 ] =  "3531";		projections[ 1523 ][ 1 ] =  "NAD83(NSRS2007) / Illinois West (ftUS)";
-projections[ 1524 ][ 0 ] =  "3532";		projections[ 1524 ][ 1 ] =  "NAD83(NSRS2007) / Indiana East";
-projections[ 1525 ][ 0 ] =  "3533";		projections[ 1525 ][ 1 ] =  "NAD83(NSRS2007) / Indiana East (ftUS)";
-projections[ 1526 ][ 0 ] =  "3534";		projections[ 1526 ][ 1 ] =  "NAD83(NSRS2007) / Indiana West";
-projections[ 1527 ][ 0 ] =  "3535";		projections[ 1527 ][ 1 ] =  "NAD83(NSRS2007) / Indiana West (ftUS)";
-projections[ 1528 ][ 0 ] =  "3536";		projections[ 1528 ][ 1 ] =  "NAD83(NSRS2007) / Iowa North";
-projections[ 1529 ][ 0 ] =  "3537";		projections[ 1529 ][ 1 ] =  "NAD83(NSRS2007) / Iowa North (ft US)";
-projections[ 1530 ][ 0 ] =  "3538";		projections[ 1530 ][ 1 ] =  "NAD83(NSRS2007) / Iowa South";
-projections[ 1531 ][ 0 ] =  "3539";		projections[ 1531 ][ 1 ] =  "NAD83(NSRS2007) / Iowa South (ft US)";
-projections[ 1532 ][ 0 ] =  "3540";		projections[ 1532 ][ 1 ] =  "NAD83(NSRS2007) / Kansas North";
-projections[ 1533 ][ 0 ] =  "3541";		projections[ 1533 ][ 1 ] =  "NAD83(NSRS2007) / Kansas North (ft US)";
-projections[ 1534 ][ 0 ] =  "3542";		projections[ 1534 ][ 1 ] =  "NAD83(NSRS2007) / Kansas South";
-projections[ 1535 ][ 0 ] =  "3543";		projections[ 1535 ][ 1 ] =  "NAD83(NSRS2007) / Kansas South (ft US)";
-projections[ 1536 ][ 0 ] =  "3544";		projections[ 1536 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky North";
-projections[ 1537 ][ 0 ] =  "3545";		projections[ 1537 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky North (ftUS)";
-projections[ 1538 ][ 0 ] =  "3546";		projections[ 1538 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky Single Zone";
-projections[ 1539 ][ 0 ] =  "3547";		projections[ 1539 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky Single Zone (ftUS)";
-projections[ 1540 ][ 0 ] =  "3548";		projections[ 1540 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky South";
-projections[ 1541 ][ 0 ] =  "3549";		projections[ 1541 ][ 1 ] =  "NAD83(NSRS2007) / Kentucky South (ftUS)";
-projections[ 1542 ][ 0 ] =  "3550";		projections[ 1542 ][ 1 ] =  "NAD83(NSRS2007) / Louisiana North";
-projections[ 1543 ][ 0 ] =  "3551";		projections[ 1543 ][ 1 ] =  "NAD83(NSRS2007) / Louisiana North (ftUS)";
-projections[ 1544 ][ 0 ] =  "3552";		projections[ 1544 ][ 1 ] =  "NAD83(NSRS2007) / Louisiana South";
-projections[ 1545 ][ 0 ] =  "3553";		projections[ 1545 ][ 1 ] =  "NAD83(NSRS2007) / Louisiana South (ftUS)";
-projections[ 1546 ][ 0 ] =  "3554";		projections[ 1546 ][ 1 ] =  "NAD83(NSRS2007) / Maine CS2000 Central";
-projections[ 1547 ][ 0 ] =  "3555";		projections[ 1547 ][ 1 ] =  "NAD83(NSRS2007) / Maine CS2000 East";
-projections[ 1548 ][ 0 ] =  "3556";		projections[ 1548 ][ 1 ] =  "NAD83(NSRS2007) / Maine CS2000 West";
-projections[ 1549 ][ 0 ] =  "3557";		projections[ 1549 ][ 1 ] =  "NAD83(NSRS2007) / Maine East";
-projections[ 1550 ][ 0 ] =  "3558";		projections[ 1550 ][ 1 ] =  "NAD83(NSRS2007) / Maine West";
-projections[ 1551 ][ 0 ] =  "3559";		projections[ 1551 ][ 1 ] =  "NAD83(NSRS2007) / Maryland";
-projections[ 1552 ][ 0 ] =  "3560";		projections[ 1552 ][ 1 ] =  "NAD83 / Utah North (ftUS)";
-projections[ 1553 ][ 0 ] =  "3561";		projections[ 1553 ][ 1 ] =  "Old Hawaiian / Hawaii zone 1";
-projections[ 1554 ][ 0 ] =  "3562";		projections[ 1554 ][ 1 ] =  "Old Hawaiian / Hawaii zone 2";
-projections[ 1555 ][ 0 ] =  "3563";		projections[ 1555 ][ 1 ] =  "Old Hawaiian / Hawaii zone 3";
-projections[ 1556 ][ 0 ] =  "3564";		projections[ 1556 ][ 1 ] =  "Old Hawaiian / Hawaii zone 4";
-projections[ 1557 ][ 0 ] =  "3565";		projections[ 1557 ][ 1 ] =  "Old Hawaiian / Hawaii zone 5";
-projections[ 1558 ][ 0 ] =  "3566";		projections[ 1558 ][ 1 ] =  "NAD83 / Utah Central (ftUS)";
-projections[ 1559 ][ 0 ] =  "3567";		projections[ 1559 ][ 1 ] =  "NAD83 / Utah South (ftUS)";
-projections[ 1560 ][ 0 ] =  "3568";		projections[ 1560 ][ 1 ] =  "NAD83(HARN) / Utah North (ftUS)";
-projections[ 1561 ][ 0 ] =  "3569";		projections[ 1561 ][ 1 ] =  "NAD83(HARN) / Utah Central (ftUS)";
-projections[ 1562 ][ 0 ] =  "3570";		projections[ 1562 ][ 1 ] =  "NAD83(HARN) / Utah South (ftUS)";
-projections[ 1563 ][ 0 ] =  "3571";		projections[ 1563 ][ 1 ] =  "WGS 84 / North Pole LAEA Bering Sea";
-projections[ 1564 ][ 0 ] =  "3572";		projections[ 1564 ][ 1 ] =  "WGS 84 / North Pole LAEA Alaska";
-projections[ 1565 ][ 0 ] =  "3573";		projections[ 1565 ][ 1 ] =  "WGS 84 / North Pole LAEA Canada";
-projections[ 1566 ][ 0 ] =  "3574";		projections[ 1566 ][ 1 ] =  "WGS 84 / North Pole LAEA Atlantic";
-projections[ 1567 ][ 0 ] =  "3575";		projections[ 1567 ][ 1 ] =  "WGS 84 / North Pole LAEA Europe";
-projections[ 1568 ][ 0 ] =  "3576";		projections[ 1568 ][ 1 ] =  "WGS 84 / North Pole LAEA Russia";
-projections[ 1569 ][ 0 ] =  "3577";		projections[ 1569 ][ 1 ] =  "GDA94 / Australian Albers";
-projections[ 1570 ][ 0 ] =  "3578";		projections[ 1570 ][ 1 ] =  "NAD83 / Yukon Albers";
-projections[ 1571 ][ 0 ] =  "3579";		projections[ 1571 ][ 1 ] =  "NAD83(CSRS) / Yukon Albers";
-projections[ 1572 ][ 0 ] =  "3580";		projections[ 1572 ][ 1 ] =  "NAD83 / NWT Lambert";
-projections[ 1573 ][ 0 ] =  "3581";		projections[ 1573 ][ 1 ] =  "NAD83(CSRS) / NWT Lambert";
-projections[ 1574 ][ 0 ] =  "3582";		projections[ 1574 ][ 1 ] =  "NAD83(NSRS2007) / Maryland (ftUS)";
-projections[ 1575 ][ 0 ] =  "3583";		projections[ 1575 ][ 1 ] =  "NAD83(NSRS2007) / Massachusetts Island";
-projections[ 1576 ][ 0 ] =  "3584";		projections[ 1576 ][ 1 ] =  "NAD83(NSRS2007) / Massachusetts Island (ftUS)";
-projections[ 1577 ][ 0 ] =  "3585";		projections[ 1577 ][ 1 ] =  "NAD83(NSRS2007) / Massachusetts Mainland";
-projections[ 1578 ][ 0 ] =  "3586";		projections[ 1578 ][ 1 ] =  "NAD83(NSRS2007) / Massachusetts Mainland (ftUS)";
-projections[ 1579 ][ 0 ] =  "3587";		projections[ 1579 ][ 1 ] =  "NAD83(NSRS2007) / Michigan Central";
-projections[ 1580 ][ 0 ] =  "3588";		projections[ 1580 ][ 1 ] =  "NAD83(NSRS2007) / Michigan Central (ft)";
-projections[ 1581 ][ 0 ] =  "3589";		projections[ 1581 ][ 1 ] =  "NAD83(NSRS2007) / Michigan North";
-projections[ 1582 ][ 0 ] =  "3590";		projections[ 1582 ][ 1 ] =  "NAD83(NSRS2007) / Michigan North (ft)";
-projections[ 1583 ][ 0 ] =  "3591";		projections[ 1583 ][ 1 ] =  "NAD83(NSRS2007) / Michigan Oblique Mercator";
-projections[ 1584 ][ 0 ] =  "3592";		projections[ 1584 ][ 1 ] =  "NAD83(NSRS2007) / Michigan South";
-projections[ 1585 ][ 0 ] =  "3593";		projections[ 1585 ][ 1 ] =  "NAD83(NSRS2007) / Michigan South (ft)";
-projections[ 1586 ][ 0 ] =  "3594";		projections[ 1586 ][ 1 ] =  "NAD83(NSRS2007) / Minnesota Central";
-projections[ 1587 ][ 0 ] =  "3595";		projections[ 1587 ][ 1 ] =  "NAD83(NSRS2007) / Minnesota North";
-projections[ 1588 ][ 0 ] =  "3596";		projections[ 1588 ][ 1 ] =  "NAD83(NSRS2007) / Minnesota South";
-projections[ 1589 ][ 0 ] =  "3597";		projections[ 1589 ][ 1 ] =  "NAD83(NSRS2007) / Mississippi East";
-projections[ 1590 ][ 0 ] =  "3598";		projections[ 1590 ][ 1 ] =  "NAD83(NSRS2007) / Mississippi East (ftUS)";
-projections[ 1591 ][ 0 ] =  "3599";		projections[ 1591 ][ 1 ] =  "NAD83(NSRS2007) / Mississippi West";
-projections[ 1592 ][ 0 ] =  "3600";		projections[ 1592 ][ 1 ] =  "NAD83(NSRS2007) / Mississippi West (ftUS)";
-projections[ 1593 ][ 0 ] =  "3601";		projections[ 1593 ][ 1 ] =  "NAD83(NSRS2007) / Missouri Central";
-projections[ 1594 ][ 0 ] =  "3602";		projections[ 1594 ][ 1 ] =  "NAD83(NSRS2007) / Missouri East";
-projections[ 1595 ][ 0 ] =  "3603";		projections[ 1595 ][ 1 ] =  "NAD83(NSRS2007) / Missouri West";
-projections[ 1596 ][ 0 ] =  "3604";		projections[ 1596 ][ 1 ] =  "NAD83(NSRS2007) / Montana";
-projections[ 1597 ][ 0 ] =  "3605";		projections[ 1597 ][ 1 ] =  "NAD83(NSRS2007) / Montana (ft)";
-projections[ 1598 ][ 0 ] =  "3606";		projections[ 1598 ][ 1 ] =  "NAD83(NSRS2007) / Nebraska";
-projections[ 1599 ][ 0 ] =  "3607";		projections[ 1599 ][ 1 ] =  "NAD83(NSRS2007) / Nevada Central";
-projections[ 1600 ][ 0 ] =  "3608";		projections[ 1600 ][ 1 ] =  "NAD83(NSRS2007) / Nevada Central (ft US)";
-projections[ 1601 ][ 0 ] =  "3609";		projections[ 1601 ][ 1 ] =  "NAD83(NSRS2007) / Nevada East";
-projections[ 1602 ][ 0 ] =  "3610";		projections[ 1602 ][ 1 ] =  "NAD83(NSRS2007) / Nevada East (ft US)";
-projections[ 1603 ][ 0 ] =  "3611";		projections[ 1603 ][ 1 ] =  "NAD83(NSRS2007) / Nevada West";
-projections[ 1604 ][ 0 ] =  "3612";		projections[ 1604 ][ 1 ] =  "NAD83(NSRS2007) / Nevada West (ft US)";
-projections[ 1605 ][ 0 ] =  "3613";		projections[ 1605 ][ 1 ] =  "NAD83(NSRS2007) / New Hampshire";
-projections[ 1606 ][ 0 ] =  "3614";		projections[ 1606 ][ 1 ] =  "NAD83(NSRS2007) / New Hampshire (ftUS)";
-projections[ 1607 ][ 0 ] =  "3615";		projections[ 1607 ][ 1 ] =  "NAD83(NSRS2007) / New Jersey";
-projections[ 1608 ][ 0 ] =  "3616";		projections[ 1608 ][ 1 ] =  "NAD83(NSRS2007) / New Jersey (ft US)";
-projections[ 1609 ][ 0 ] =  "3617";		projections[ 1609 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico Central";
-projections[ 1610 ][ 0 ] =  "3618";		projections[ 1610 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico Central (ftUS)";
-projections[ 1611 ][ 0 ] =  "3619";		projections[ 1611 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico East";
-projections[ 1612 ][ 0 ] =  "3620";		projections[ 1612 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico East (ftUS)";
-projections[ 1613 ][ 0 ] =  "3621";		projections[ 1613 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico West";
-projections[ 1614 ][ 0 ] =  "3622";		projections[ 1614 ][ 1 ] =  "NAD83(NSRS2007) / New Mexico West (ftUS)";
-projections[ 1615 ][ 0 ] =  "3623";		projections[ 1615 ][ 1 ] =  "NAD83(NSRS2007) / New York Central";
-projections[ 1616 ][ 0 ] =  "3624";		projections[ 1616 ][ 1 ] =  "NAD83(NSRS2007) / New York Central (ftUS)";
-projections[ 1617 ][ 0 ] =  "3625";		projections[ 1617 ][ 1 ] =  "NAD83(NSRS2007) / New York East";
-projections[ 1618 ][ 0 ] =  "3626";		projections[ 1618 ][ 1 ] =  "NAD83(NSRS2007) / New York East (ftUS)";
-projections[ 1619 ][ 0 ] =  "3627";		projections[ 1619 ][ 1 ] =  "NAD83(NSRS2007) / New York Long Island";
-projections[ 1620 ][ 0 ] =  "3628";		projections[ 1620 ][ 1 ] =  "NAD83(NSRS2007) / New York Long Island (ftUS)";
-projections[ 1621 ][ 0 ] =  "3629";		projections[ 1621 ][ 1 ] =  "NAD83(NSRS2007) / New York West";
-projections[ 1622 ][ 0 ] =  "3630";		projections[ 1622 ][ 1 ] =  "NAD83(NSRS2007) / New York West (ftUS)";
-projections[ 1623 ][ 0 ] =  "3631";		projections[ 1623 ][ 1 ] =  "NAD83(NSRS2007) / North Carolina";
-projections[ 1624 ][ 0 ] =  "3632";		projections[ 1624 ][ 1 ] =  "NAD83(NSRS2007) / North Carolina (ftUS)";
-projections[ 1625 ][ 0 ] =  "3633";		projections[ 1625 ][ 1 ] =  "NAD83(NSRS2007) / North Dakota North";
-projections[ 1626 ][ 0 ] =  "3634";		projections[ 1626 ][ 1 ] =  "NAD83(NSRS2007) / North Dakota North (ft)";
-projections[ 1627 ][ 0 ] =  "3635";		projections[ 1627 ][ 1 ] =  "NAD83(NSRS2007) / North Dakota South";
-projections[ 1628 ][ 0 ] =  "3636";		projections[ 1628 ][ 1 ] =  "NAD83(NSRS2007) / North Dakota South (ft)";
-projections[ 1629 ][ 0 ] =  "3637";		projections[ 1629 ][ 1 ] =  "NAD83(NSRS2007) / Ohio North";
-projections[ 1630 ][ 0 ] =  "3638";		projections[ 1630 ][ 1 ] =  "NAD83(NSRS2007) / Ohio South";
-projections[ 1631 ][ 0 ] =  "3639";		projections[ 1631 ][ 1 ] =  "NAD83(NSRS2007) / Oklahoma North";
-projections[ 1632 ][ 0 ] =  "3640";		projections[ 1632 ][ 1 ] =  "NAD83(NSRS2007) / Oklahoma North (ftUS)";
-projections[ 1633 ][ 0 ] =  "3641";		projections[ 1633 ][ 1 ] =  "NAD83(NSRS2007) / Oklahoma South";
-projections[ 1634 ][ 0 ] =  "3642";		projections[ 1634 ][ 1 ] =  "NAD83(NSRS2007) / Oklahoma South (ftUS)";
-projections[ 1635 ][ 0 ] =  "3643";		projections[ 1635 ][ 1 ] =  "NAD83(NSRS2007) / Oregon Lambert";
-projections[ 1636 ][ 0 ] =  "3644";		projections[ 1636 ][ 1 ] =  "NAD83(NSRS2007) / Oregon Lambert (ft)";
-projections[ 1637 ][ 0 ] =  "3645";		projections[ 1637 ][ 1 ] =  "NAD83(NSRS2007) / Oregon North";
-projections[ 1638 ][ 0 ] =  "3646";		projections[ 1638 ][ 1 ] =  "NAD83(NSRS2007) / Oregon North (ft)";
-projections[ 1639 ][ 0 ] =  "3647";		projections[ 1639 ][ 1 ] =  "NAD83(NSRS2007) / Oregon South";
-projections[ 1640 ][ 0 ] =  "3648";		projections[ 1640 ][ 1 ] =  "NAD83(NSRS2007) / Oregon South (ft)";
-projections[ 1641 ][ 0 ] =  "3649";		projections[ 1641 ][ 1 ] =  "NAD83(NSRS2007) / Pennsylvania North";
-projections[ 1642 ][ 0 ] =  "3650";		projections[ 1642 ][ 1 ] =  "NAD83(NSRS2007) / Pennsylvania North (ftUS)";
-projections[ 1643 ][ 0 ] =  "3651";		projections[ 1643 ][ 1 ] =  "NAD83(NSRS2007) / Pennsylvania South";
-projections[ 1644 ][ 0 ] =  "3652";		projections[ 1644 ][ 1 ] =  "NAD83(NSRS2007) / Pennsylvania South (ftUS)";
-projections[ 1645 ][ 0 ] =  "3653";		projections[ 1645 ][ 1 ] =  "NAD83(NSRS2007) / Rhode Island";
-projections[ 1646 ][ 0 ] =  "3654";		projections[ 1646 ][ 1 ] =  "NAD83(NSRS2007) / Rhode Island (ftUS)";
-projections[ 1647 ][ 0 ] =  "3655";		projections[ 1647 ][ 1 ] =  "NAD83(NSRS2007) / South Carolina";
-projections[ 1648 ][ 0 ] =  "3656";		projections[ 1648 ][ 1 ] =  "NAD83(NSRS2007) / South Carolina (ft)";
-projections[ 1649 ][ 0 ] =  "3657";		projections[ 1649 ][ 1 ] =  "NAD83(NSRS2007) / South Dakota North";
-projections[ 1650 ][ 0 ] =  "3658";		projections[ 1650 ][ 1 ] =  "NAD83(NSRS2007) / South Dakota North (ftUS)";
-projections[ 1651 ][ 0 ] =  "3659";		projections[ 1651 ][ 1 ] =  "NAD83(NSRS2007) / South Dakota South";
-projections[ 1652 ][ 0 ] =  "3660";		projections[ 1652 ][ 1 ] =  "NAD83(NSRS2007) / South Dakota South (ftUS)";
-projections[ 1653 ][ 0 ] =  "3661";		projections[ 1653 ][ 1 ] =  "NAD83(NSRS2007) / Tennessee";
-projections[ 1654 ][ 0 ] =  "3662";		projections[ 1654 ][ 1 ] =  "NAD83(NSRS2007) / Tennessee (ftUS)";
-projections[ 1655 ][ 0 ] =  "3663";		projections[ 1655 ][ 1 ] =  "NAD83(NSRS2007) / Texas Central";
-projections[ 1656 ][ 0 ] =  "3664";		projections[ 1656 ][ 1 ] =  "NAD83(NSRS2007) / Texas Central (ftUS)";
-projections[ 1657 ][ 0 ] =  "3665";		projections[ 1657 ][ 1 ] =  "NAD83(NSRS2007) / Texas Centric Albers Equal Area";
-projections[ 1658 ][ 0 ] =  "3666";		projections[ 1658 ][ 1 ] =  "NAD83(NSRS2007) / Texas Centric Lambert Conformal";
-projections[ 1659 ][ 0 ] =  "3667";		projections[ 1659 ][ 1 ] =  "NAD83(NSRS2007) / Texas North";
-projections[ 1660 ][ 0 ] =  "3668";		projections[ 1660 ][ 1 ] =  "NAD83(NSRS2007) / Texas North (ftUS)";
-projections[ 1661 ][ 0 ] =  "3669";		projections[ 1661 ][ 1 ] =  "NAD83(NSRS2007) / Texas North Central";
-projections[ 1662 ][ 0 ] =  "3670";		projections[ 1662 ][ 1 ] =  "NAD83(NSRS2007) / Texas North Central (ftUS)";
-projections[ 1663 ][ 0 ] =  "3671";		projections[ 1663 ][ 1 ] =  "NAD83(NSRS2007) / Texas South";
-projections[ 1664 ][ 0 ] =  "3672";		projections[ 1664 ][ 1 ] =  "NAD83(NSRS2007) / Texas South (ftUS)";
-projections[ 1665 ][ 0 ] =  "3673";		projections[ 1665 ][ 1 ] =  "NAD83(NSRS2007) / Texas South Central";
-projections[ 1666 ][ 0 ] =  "3674";		projections[ 1666 ][ 1 ] =  "NAD83(NSRS2007) / Texas South Central (ftUS)";
-projections[ 1667 ][ 0 ] =  "3675";		projections[ 1667 ][ 1 ] =  "NAD83(NSRS2007) / Utah Central";
-projections[ 1668 ][ 0 ] =  "3676";		projections[ 1668 ][ 1 ] =  "NAD83(NSRS2007) / Utah Central (ft)";
-projections[ 1669 ][ 0 ] =  "3677";		projections[ 1669 ][ 1 ] =  "NAD83(NSRS2007) / Utah Central (ftUS)";
-projections[ 1670 ][ 0 ] =  "3678";		projections[ 1670 ][ 1 ] =  "NAD83(NSRS2007) / Utah North";
-projections[ 1671 ][ 0 ] =  "3679";		projections[ 1671 ][ 1 ] =  "NAD83(NSRS2007) / Utah North (ft)";
-projections[ 1672 ][ 0 ] =  "3680";		projections[ 1672 ][ 1 ] =  "NAD83(NSRS2007) / Utah North (ftUS)";
-projections[ 1673 ][ 0 ] =  "3681";		projections[ 1673 ][ 1 ] =  "NAD83(NSRS2007) / Utah South";
-projections[ 1674 ][ 0 ] =  "3682";		projections[ 1674 ][ 1 ] =  "NAD83(NSRS2007) / Utah South (ft)";
-projections[ 1675 ][ 0 ] =  "3683";		projections[ 1675 ][ 1 ] =  "NAD83(NSRS2007) / Utah South (ftUS)";
-projections[ 1676 ][ 0 ] =  "3684";		projections[ 1676 ][ 1 ] =  "NAD83(NSRS2007) / Vermont";
-projections[ 1677 ][ 0 ] =  "3685";		projections[ 1677 ][ 1 ] =  "NAD83(NSRS2007) / Virginia North";
-projections[ 1678 ][ 0 ] =  "3686";		projections[ 1678 ][ 1 ] =  "NAD83(NSRS2007) / Virginia North (ftUS)";
-projections[ 1679 ][ 0 ] =  "3687";		projections[ 1679 ][ 1 ] =  "NAD83(NSRS2007) / Virginia South";
-projections[ 1680 ][ 0 ] =  "3688";		projections[ 1680 ][ 1 ] =  "NAD83(NSRS2007) / Virginia South (ftUS)";
-projections[ 1681 ][ 0 ] =  "3689";		projections[ 1681 ][ 1 ] =  "NAD83(NSRS2007) / Washington North";
-projections[ 1682 ][ 0 ] =  "3690";		projections[ 1682 ][ 1 ] =  "NAD83(NSRS2007) / Washington North (ftUS)";
-projections[ 1683 ][ 0 ] =  "3691";		projections[ 1683 ][ 1 ] =  "NAD83(NSRS2007) / Washington South";
-projections[ 1684 ][ 0 ] =  "3692";		projections[ 1684 ][ 1 ] =  "NAD83(NSRS2007) / Washington South (ftUS)";
-projections[ 1685 ][ 0 ] =  "3693";		projections[ 1685 ][ 1 ] =  "NAD83(NSRS2007) / West Virginia North";
-projections[ 1686 ][ 0 ] =  "3694";		projections[ 1686 ][ 1 ] =  "NAD83(NSRS2007) / West Virginia South";
-projections[ 1687 ][ 0 ] =  "3695";		projections[ 1687 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin Central";
-projections[ 1688 ][ 0 ] =  "3696";		projections[ 1688 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin Central (ftUS)";
-projections[ 1689 ][ 0 ] =  "3697";		projections[ 1689 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin North";
-projections[ 1690 ][ 0 ] =  "3698";		projections[ 1690 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin North (ftUS)";
-projections[ 1691 ][ 0 ] =  "3699";		projections[ 1691 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin South";
-projections[ 1692 ][ 0 ] =  "3700";		projections[ 1692 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin South (ftUS)";
-projections[ 1693 ][ 0 ] =  "3701";		projections[ 1693 ][ 1 ] =  "NAD83(NSRS2007) / Wisconsin Transverse Mercator";
-projections[ 1694 ][ 0 ] =  "3702";		projections[ 1694 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming East";
-projections[ 1695 ][ 0 ] =  "3703";		projections[ 1695 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming East Central";
-projections[ 1696 ][ 0 ] =  "3704";		projections[ 1696 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming West Central";
-projections[ 1697 ][ 0 ] =  "3705";		projections[ 1697 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming West";
-projections[ 1698 ][ 0 ] =  "3706";		projections[ 1698 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 59N";
-projections[ 1699 ][ 0 ] =  "3707";		projections[ 1699 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 60N";
-projections[ 1700 ][ 0 ] =  "3708";		projections[ 1700 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 1N";
-projections[ 1701 ][ 0 ] =  "3709";		projections[ 1701 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 2N";
-projections[ 1702 ][ 0 ] =  "3710";		projections[ 1702 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 3N";
-projections[ 1703 ][ 0 ] =  "3711";		projections[ 1703 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 4N";
-projections[ 1704 ][ 0 ] =  "3712";		projections[ 1704 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 5N";
-projections[ 1705 ][ 0 ] =  "3713";		projections[ 1705 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 6N";
-projections[ 1706 ][ 0 ] =  "3714";		projections[ 1706 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 7N";
-projections[ 1707 ][ 0 ] =  "3715";		projections[ 1707 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 8N";
-projections[ 1708 ][ 0 ] =  "3716";		projections[ 1708 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 9N";
-projections[ 1709 ][ 0 ] =  "3717";		projections[ 1709 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 10N";
-projections[ 1710 ][ 0 ] =  "3718";		projections[ 1710 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 11N";
-projections[ 1711 ][ 0 ] =  "3719";		projections[ 1711 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 12N";
-projections[ 1712 ][ 0 ] =  "3720";		projections[ 1712 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 13N";
-projections[ 1713 ][ 0 ] =  "3721";		projections[ 1713 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 14N";
-projections[ 1714 ][ 0 ] =  "3722";		projections[ 1714 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 15N";
-projections[ 1715 ][ 0 ] =  "3723";		projections[ 1715 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 16N";
-projections[ 1716 ][ 0 ] =  "3724";		projections[ 1716 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 17N";
-projections[ 1717 ][ 0 ] =  "3725";		projections[ 1717 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 18N";
-projections[ 1718 ][ 0 ] =  "3726";		projections[ 1718 ][ 1 ] =  "NAD83(NSRS2007) / UTM zone 19N";
-projections[ 1719 ][ 0 ] =  "3727";		projections[ 1719 ][ 1 ] =  "Reunion 1947 / TM Reunion";
-projections[ 1720 ][ 0 ] =  "3728";		projections[ 1720 ][ 1 ] =  "NAD83(NSRS2007) / Ohio North (ftUS)";
-projections[ 1721 ][ 0 ] =  "3729";		projections[ 1721 ][ 1 ] =  "NAD83(NSRS2007) / Ohio South (ftUS)";
-projections[ 1722 ][ 0 ] =  "3730";		projections[ 1722 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming East (ftUS)";
-projections[ 1723 ][ 0 ] =  "3731";		projections[ 1723 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming East Central (ftUS)";
-projections[ 1724 ][ 0 ] =  "3732";		projections[ 1724 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming West Central (ftUS)";
-projections[ 1725 ][ 0 ] =  "3733";		projections[ 1725 ][ 1 ] =  "NAD83(NSRS2007) / Wyoming West (ftUS)";
-projections[ 1726 ][ 0 ] =  "3734";		projections[ 1726 ][ 1 ] =  "NAD83 / Ohio North (ftUS)";
-projections[ 1727 ][ 0 ] =  "3735";		projections[ 1727 ][ 1 ] =  "NAD83 / Ohio South (ftUS)";
-projections[ 1728 ][ 0 ] =  "3736";		projections[ 1728 ][ 1 ] =  "NAD83 / Wyoming East (ftUS)";
-projections[ 1729 ][ 0 ] =  "3737";		projections[ 1729 ][ 1 ] =  "NAD83 / Wyoming East Central (ftUS)";
-projections[ 1730 ][ 0 ] =  "3738";		projections[ 1730 ][ 1 ] =  "NAD83 / Wyoming West Central (ftUS)";
-projections[ 1731 ][ 0 ] =  "3739";		projections[ 1731 ][ 1 ] =  "NAD83 / Wyoming West (ftUS)";
-projections[ 1732 ][ 0 ] =  "3740";		projections[ 1732 ][ 1 ] =  "NAD83(HARN) / UTM zone 10N";
-projections[ 1733 ][ 0 ] =  "3741";		projections[ 1733 ][ 1 ] =  "NAD83(HARN) / UTM zone 11N";
-projections[ 1734 ][ 0 ] =  "3742";		projections[ 1734 ][ 1 ] =  "NAD83(HARN) / UTM zone 12N";
-projections[ 1735 ][ 0 ] =  "3743";		projections[ 1735 ][ 1 ] =  "NAD83(HARN) / UTM zone 13N";
-projections[ 1736 ][ 0 ] =  "3744";		projections[ 1736 ][ 1 ] =  "NAD83(HARN) / UTM zone 14N";
-projections[ 1737 ][ 0 ] =  "3745";		projections[ 1737 ][ 1 ] =  "NAD83(HARN) / UTM zone 15N";
-projections[ 1738 ][ 0 ] =  "3746";		projections[ 1738 ][ 1 ] =  "NAD83(HARN) / UTM zone 16N";
-projections[ 1739 ][ 0 ] =  "3747";		projections[ 1739 ][ 1 ] =  "NAD83(HARN) / UTM zone 17N";
-projections[ 1740 ][ 0 ] =  "3748";		projections[ 1740 ][ 1 ] =  "NAD83(HARN) / UTM zone 18N";
-projections[ 1741 ][ 0 ] =  "3749";		projections[ 1741 ][ 1 ] =  "NAD83(HARN) / UTM zone 19N";
-projections[ 1742 ][ 0 ] =  "3750";		projections[ 1742 ][ 1 ] =  "NAD83(HARN) / UTM zone 4N";
-projections[ 1743 ][ 0 ] =  "3751";		projections[ 1743 ][ 1 ] =  "NAD83(HARN) / UTM zone 5N";
-projections[ 1744 ][ 0 ] =  "3752";		projections[ 1744 ][ 1 ] =  "WGS 84 / Mercator 41";
-projections[ 1745 ][ 0 ] =  "3753";		projections[ 1745 ][ 1 ] =  "NAD83(HARN) / Ohio North (ftUS)";
-projections[ 1746 ][ 0 ] =  "3754";		projections[ 1746 ][ 1 ] =  "NAD83(HARN) / Ohio South (ftUS)";
-projections[ 1747 ][ 0 ] =  "3755";		projections[ 1747 ][ 1 ] =  "NAD83(HARN) / Wyoming East (ftUS)";
-projections[ 1748 ][ 0 ] =  "3756";		projections[ 1748 ][ 1 ] =  "NAD83(HARN) / Wyoming East Central (ftUS)";
-projections[ 1749 ][ 0 ] =  "3757";		projections[ 1749 ][ 1 ] =  "NAD83(HARN) / Wyoming West Central (ftUS)";
-projections[ 1750 ][ 0 ] =  "3758";		projections[ 1750 ][ 1 ] =  "NAD83(HARN) / Wyoming West (ftUS)";
-projections[ 1751 ][ 0 ] =  "3759";		projections[ 1751 ][ 1 ] =  "NAD83 / Hawaii zone 3 (ftUS)";
-projections[ 1752 ][ 0 ] =  "3760";		projections[ 1752 ][ 1 ] =  "NAD83(HARN) / Hawaii zone 3 (ftUS)";
-projections[ 1753 ][ 0 ] =  "3761";		projections[ 1753 ][ 1 ] =  "NAD83(CSRS) / UTM zone 22N";
-projections[ 1754 ][ 0 ] =  "3762";		projections[ 1754 ][ 1 ] =  "WGS 84 / South Georgia Lambert";
-projections[ 1755 ][ 0 ] =  "3920";		projections[ 1755 ][ 1 ] =  "Puerto Rico / UTM zone 20N";
-projections[ 1756 ][ 0 ] =  "3991";		projections[ 1756 ][ 1 ] =  "Puerto Rico State Plane CS of 1927";
-projections[ 1757 ][ 0 ] =  "3992";		projections[ 1757 ][ 1 ] =  "Puerto Rico / St. Croix";
-projections[ 1758 ][ 0 ] =  "3993";		projections[ 1758 ][ 1 ] =  "Guam 1963 / Guam SPCS";
-projections[ 1759 ][ 0 ] =  "4001";		projections[ 1759 ][ 1 ] =  "Airy 1830 ellipsoid";
-projections[ 1760 ][ 0 ] =  "4002";		projections[ 1760 ][ 1 ] =  "Airy Modified 1849 ellipsoid";
-projections[ 1761 ][ 0 ] =  "4003";		projections[ 1761 ][ 1 ] =  "Australian National Spheroid";
-projections[ 1762 ][ 0 ] =  "4004";		projections[ 1762 ][ 1 ] =  "Bessel 1841 ellipsoid";
-projections[ 1763 ][ 0 ] =  "4005";		projections[ 1763 ][ 1 ] =  "Bessel Modified ellipsoid";
-projections[ 1764 ][ 0 ] =  "4006";		projections[ 1764 ][ 1 ] =  "Bessel Namibia ellipsoid";
-projections[ 1765 ][ 0 ] =  "4007";		projections[ 1765 ][ 1 ] =  "Clarke 1858 ellipsoid";
-projections[ 1766 ][ 0 ] =  "4008";		projections[ 1766 ][ 1 ] =  "Clarke 1866 ellipsoid";
-projections[ 1767 ][ 0 ] =  "4009";		projections[ 1767 ][ 1 ] =  "Clarke 1866 Michigan ellipsoid";
-projections[ 1768 ][ 0 ] =  "4010";		projections[ 1768 ][ 1 ] =  "Clarke 1880 (Benoit) ellipsoid";
-projections[ 1769 ][ 0 ] =  "4011";		projections[ 1769 ][ 1 ] =  "Clarke 1880 (IGN) ellipsoid";
-projections[ 1770 ][ 0 ] =  "4012";		projections[ 1770 ][ 1 ] =  "Clarke 1880 (RGS) ellipsoid";
-projections[ 1771 ][ 0 ] =  "4013";		projections[ 1771 ][ 1 ] =  "Clarke 1880 (Arc) ellipsoid";
-projections[ 1772 ][ 0 ] =  "4014";		projections[ 1772 ][ 1 ] =  "Clarke 1880 (SGA 1922) ellipsoid";
-projections[ 1773 ][ 0 ] =  "4015";		projections[ 1773 ][ 1 ] =  "Everest 1830 (1937 Adjustment) ellipsoid";
-projections[ 1774 ][ 0 ] =  "4016";		projections[ 1774 ][ 1 ] =  "Everest 1830 (1967 Definition) ellipsoid";
-projections[ 1775 ][ 0 ] =  "4018";		projections[ 1775 ][ 1 ] =  "Everest 1830 Modified ellipsoid";
-projections[ 1776 ][ 0 ] =  "4019";		projections[ 1776 ][ 1 ] =  "GRS 1980 ellipsoid";
-projections[ 1777 ][ 0 ] =  "4020";		projections[ 1777 ][ 1 ] =  "Helmert 1906 ellipsoid";
-projections[ 1778 ][ 0 ] =  "4021";		projections[ 1778 ][ 1 ] =  "Indonesian National Spheroid";
-projections[ 1779 ][ 0 ] =  "4022";		projections[ 1779 ][ 1 ] =  "International 1924 ellipsoid";
-projections[ 1780 ][ 0 ] =  "4024";		projections[ 1780 ][ 1 ] =  "Krassowsky 1940 ellipsoid";
-projections[ 1781 ][ 0 ] =  "4025";		projections[ 1781 ][ 1 ] =  "NWL 9D ellipsoid";
-projections[ 1782 ][ 0 ] =  "4027";		projections[ 1782 ][ 1 ] =  "Plessis 1817 ellipsoid";
-projections[ 1783 ][ 0 ] =  "4028";		projections[ 1783 ][ 1 ] =  "Struve 1860 ellipsoid";
-projections[ 1784 ][ 0 ] =  "4029";		projections[ 1784 ][ 1 ] =  "War Office ellipsoid";
-projections[ 1785 ][ 0 ] =  "4030";		projections[ 1785 ][ 1 ] =  "WGS 84 ellipsoid";
-projections[ 1786 ][ 0 ] =  "4031";		projections[ 1786 ][ 1 ] =  "GEM 10C ellipsoid";
-projections[ 1787 ][ 0 ] =  "4032";		projections[ 1787 ][ 1 ] =  "OSU86F ellipsoid";
-projections[ 1788 ][ 0 ] =  "4033";		projections[ 1788 ][ 1 ] =  "OSU91A ellipsoid";
-projections[ 1789 ][ 0 ] =  "4034";		projections[ 1789 ][ 1 ] =  "Clarke 1880 ellipsoid";
-projections[ 1790 ][ 0 ] =  "4035";		projections[ 1790 ][ 1 ] =  "Authalic Sphere";
-projections[ 1791 ][ 0 ] =  "4036";		projections[ 1791 ][ 1 ] =  "GRS 1967 ellipsoid";
-projections[ 1792 ][ 0 ] =  "4041";		projections[ 1792 ][ 1 ] =  "Average Terrestrial System 1977 ellipsoid";
-projections[ 1793 ][ 0 ] =  "4042";		projections[ 1793 ][ 1 ] =  "Everest (1830 Definition) ellipsoid";
-projections[ 1794 ][ 0 ] =  "4043";		projections[ 1794 ][ 1 ] =  "WGS 72 ellipsoid";
-projections[ 1795 ][ 0 ] =  "4044";		projections[ 1795 ][ 1 ] =  "Everest 1830 (1962 Definition) ellipsoid";
-projections[ 1796 ][ 0 ] =  "4045";		projections[ 1796 ][ 1 ] =  "Everest 1830 (1975 Definition) ellipsoid";
-projections[ 1797 ][ 0 ] =  "4047";		projections[ 1797 ][ 1 ] =  "GRS 1980 Authalic Sphere";
-projections[ 1798 ][ 0 ] =  "4052";		projections[ 1798 ][ 1 ] =  "Clarke 1866 Authalic Sphere";
-projections[ 1799 ][ 0 ] =  "4053";		projections[ 1799 ][ 1 ] =  "International 1924 Authalic Sphere";
-projections[ 1800 ][ 0 ] =  "4054";		projections[ 1800 ][ 1 ] =  "Hughes 1980 ellipsoid";
-projections[ 1801 ][ 0 ] =  "4120";		projections[ 1801 ][ 1 ] =  "Greek";
-projections[ 1802 ][ 0 ] =  "4121";		projections[ 1802 ][ 1 ] =  "GGRS87";
-projections[ 1803 ][ 0 ] =  "4122";		projections[ 1803 ][ 1 ] =  "ATS77";
-projections[ 1804 ][ 0 ] =  "4123";		projections[ 1804 ][ 1 ] =  "KKJ";
-projections[ 1805 ][ 0 ] =  "4124";		projections[ 1805 ][ 1 ] =  "RT90";
-projections[ 1806 ][ 0 ] =  "4125";		projections[ 1806 ][ 1 ] =  "Samboja";
-projections[ 1807 ][ 0 ] =  "4126";		projections[ 1807 ][ 1 ] =  "LKS94 (ETRS89)";
-projections[ 1808 ][ 0 ] =  "4127";		projections[ 1808 ][ 1 ] =  "Tete";
-projections[ 1809 ][ 0 ] =  "4128";		projections[ 1809 ][ 1 ] =  "Madzansua";
-projections[ 1810 ][ 0 ] =  "4129";		projections[ 1810 ][ 1 ] =  "Observatario";
-projections[ 1811 ][ 0 ] =  "4130";		projections[ 1811 ][ 1 ] =  "Moznet";
-projections[ 1812 ][ 0 ] =  "4131";		projections[ 1812 ][ 1 ] =  "Indian 1960";
-projections[ 1813 ][ 0 ] =  "4132";		projections[ 1813 ][ 1 ] =  "FD58";
-projections[ 1814 ][ 0 ] =  "4133";		projections[ 1814 ][ 1 ] =  "EST92";
-projections[ 1815 ][ 0 ] =  "4134";		projections[ 1815 ][ 1 ] =  "PDO Survey Datum 1993";
-projections[ 1816 ][ 0 ] =  "4135";		projections[ 1816 ][ 1 ] =  "Old Hawaiian";
-projections[ 1817 ][ 0 ] =  "4136";		projections[ 1817 ][ 1 ] =  "St. Lawrence Island";
-projections[ 1818 ][ 0 ] =  "4137";		projections[ 1818 ][ 1 ] =  "St. Paul Island";
-projections[ 1819 ][ 0 ] =  "4138";		projections[ 1819 ][ 1 ] =  "St. George Island";
-projections[ 1820 ][ 0 ] =  "4139";		projections[ 1820 ][ 1 ] =  "Puerto Rico";
-projections[ 1821 ][ 0 ] =  "4140";		projections[ 1821 ][ 1 ] =  "NAD83(CSRS98)";
-projections[ 1822 ][ 0 ] =  "4141";		projections[ 1822 ][ 1 ] =  "Israel";
-projections[ 1823 ][ 0 ] =  "4142";		projections[ 1823 ][ 1 ] =  "Locodjo 1965";
-projections[ 1824 ][ 0 ] =  "4143";		projections[ 1824 ][ 1 ] =  "Abidjan 1987";
-projections[ 1825 ][ 0 ] =  "4144";		projections[ 1825 ][ 1 ] =  "Kalianpur 1937";
-projections[ 1826 ][ 0 ] =  "4145";		projections[ 1826 ][ 1 ] =  "Kalianpur 1962";
-projections[ 1827 ][ 0 ] =  "4146";		projections[ 1827 ][ 1 ] =  "Kalianpur 1975";
-projections[ 1828 ][ 0 ] =  "4147";		projections[ 1828 ][ 1 ] =  "Hanoi 1972";
-projections[ 1829 ][ 0 ] =  "4148";		projections[ 1829 ][ 1 ] =  "Hartebeesthoek94";
-projections[ 1830 ][ 0 ] =  "4149";		projections[ 1830 ][ 1 ] =  "CH1903";
-projections[ 1831 ][ 0 ] =  "4150";		projections[ 1831 ][ 1 ] =  "CH1903+";
-projections[ 1832 ][ 0 ] =  "4151";		projections[ 1832 ][ 1 ] =  "CHTRF95";
-projections[ 1833 ][ 0 ] =  "4152";		projections[ 1833 ][ 1 ] =  "NAD83(HARN)";
-projections[ 1834 ][ 0 ] =  "4153";		projections[ 1834 ][ 1 ] =  "Rassadiran";
-projections[ 1835 ][ 0 ] =  "4154";		projections[ 1835 ][ 1 ] =  "ED50(ED77)";
-projections[ 1836 ][ 0 ] =  "4155";		projections[ 1836 ][ 1 ] =  "Dabola 1981";
-projections[ 1837 ][ 0 ] =  "4156";		projections[ 1837 ][ 1 ] =  "S-JTSK";
-projections[ 1838 ][ 0 ] =  "4157";		projections[ 1838 ][ 1 ] =  "Mount Dillon";
-projections[ 1839 ][ 0 ] =  "4158";		projections[ 1839 ][ 1 ] =  "Naparima 1955";
-projections[ 1840 ][ 0 ] =  "4159";		projections[ 1840 ][ 1 ] =  "ELD79";
-projections[ 1841 ][ 0 ] =  "4160";		projections[ 1841 ][ 1 ] =  "Chos Malal 1914";
-projections[ 1842 ][ 0 ] =  "4161";		projections[ 1842 ][ 1 ] =  "Pampa del Castillo";
-projections[ 1843 ][ 0 ] =  "4162";		projections[ 1843 ][ 1 ] =  "Korean 1985";
-projections[ 1844 ][ 0 ] =  "4163";		projections[ 1844 ][ 1 ] =  "Yemen NGN96";
-projections[ 1845 ][ 0 ] =  "4164";		projections[ 1845 ][ 1 ] =  "South Yemen";
-projections[ 1846 ][ 0 ] =  "4165";		projections[ 1846 ][ 1 ] =  "Bissau";
-projections[ 1847 ][ 0 ] =  "4166";		projections[ 1847 ][ 1 ] =  "Korean 1995";
-projections[ 1848 ][ 0 ] =  "4167";		projections[ 1848 ][ 1 ] =  "NZGD2000";
-projections[ 1849 ][ 0 ] =  "4168";		projections[ 1849 ][ 1 ] =  "Accra";
-projections[ 1850 ][ 0 ] =  "4169";		projections[ 1850 ][ 1 ] =  "American Samoa 1962";
-projections[ 1851 ][ 0 ] =  "4170";		projections[ 1851 ][ 1 ] =  "SIRGAS";
-projections[ 1852 ][ 0 ] =  "4171";		projections[ 1852 ][ 1 ] =  "RGF93";
-projections[ 1853 ][ 0 ] =  "4172";		projections[ 1853 ][ 1 ] =  "POSGAR";
-projections[ 1854 ][ 0 ] =  "4173";		projections[ 1854 ][ 1 ] =  "IRENET95";
-projections[ 1855 ][ 0 ] =  "4174";		projections[ 1855 ][ 1 ] =  "Sierra Leone 1924";
-projections[ 1856 ][ 0 ] =  "4175";		projections[ 1856 ][ 1 ] =  "Sierra Leone 1968";
-projections[ 1857 ][ 0 ] =  "4176";		projections[ 1857 ][ 1 ] =  "Australian Antarctic";
-projections[ 1858 ][ 0 ] =  "4178";		projections[ 1858 ][ 1 ] =  "Pulkovo 1942(83)";
-projections[ 1859 ][ 0 ] =  "4179";		projections[ 1859 ][ 1 ] =  "Pulkovo 1942(58)";
-projections[ 1860 ][ 0 ] =  "4180";		projections[ 1860 ][ 1 ] =  "EST97";
-projections[ 1861 ][ 0 ] =  "4181";		projections[ 1861 ][ 1 ] =  "Luxembourg 1930";
-projections[ 1862 ][ 0 ] =  "4182";		projections[ 1862 ][ 1 ] =  "Azores Occidental 1939";
-projections[ 1863 ][ 0 ] =  "4183";		projections[ 1863 ][ 1 ] =  "Azores Central 1948";
-projections[ 1864 ][ 0 ] =  "4184";		projections[ 1864 ][ 1 ] =  "Azores Oriental 1940";
-projections[ 1865 ][ 0 ] =  "4185";		projections[ 1865 ][ 1 ] =  "Madeira 1936";
-projections[ 1866 ][ 0 ] =  "4188";		projections[ 1866 ][ 1 ] =  "OSNI 1952";
-projections[ 1867 ][ 0 ] =  "4189";		projections[ 1867 ][ 1 ] =  "REGVEN";
-projections[ 1868 ][ 0 ] =  "4190";		projections[ 1868 ][ 1 ] =  "POSGAR 98";
-projections[ 1869 ][ 0 ] =  "4191";		projections[ 1869 ][ 1 ] =  "Albanian 1987";
-projections[ 1870 ][ 0 ] =  "4192";		projections[ 1870 ][ 1 ] =  "Douala 1948";
-projections[ 1871 ][ 0 ] =  "4193";		projections[ 1871 ][ 1 ] =  "Manoca 1962";
-projections[ 1872 ][ 0 ] =  "4194";		projections[ 1872 ][ 1 ] =  "Qornoq 1927";
-projections[ 1873 ][ 0 ] =  "4195";		projections[ 1873 ][ 1 ] =  "Scoresbysund 1952";
-projections[ 1874 ][ 0 ] =  "4196";		projections[ 1874 ][ 1 ] =  "Ammassalik 1958";
-projections[ 1875 ][ 0 ] =  "4197";		projections[ 1875 ][ 1 ] =  "Garoua";
-projections[ 1876 ][ 0 ] =  "4198";		projections[ 1876 ][ 1 ] =  "Kousseri";
-projections[ 1877 ][ 0 ] =  "4199";		projections[ 1877 ][ 1 ] =  "Egypt 1930";
-projections[ 1878 ][ 0 ] =  "4200";		projections[ 1878 ][ 1 ] =  "Pulkovo 1995";
-projections[ 1879 ][ 0 ] =  "4201";		projections[ 1879 ][ 1 ] =  "Adindan";
-projections[ 1880 ][ 0 ] =  "4202";		projections[ 1880 ][ 1 ] =  "AGD66";
-projections[ 1881 ][ 0 ] =  "4203";		projections[ 1881 ][ 1 ] =  "AGD84";
-projections[ 1882 ][ 0 ] =  "4204";		projections[ 1882 ][ 1 ] =  "Ain el Abd";
-projections[ 1883 ][ 0 ] =  "4205";		projections[ 1883 ][ 1 ] =  "Afgooye";
-projections[ 1884 ][ 0 ] =  "4206";		projections[ 1884 ][ 1 ] =  "Agadez";
-projections[ 1885 ][ 0 ] =  "4207";		projections[ 1885 ][ 1 ] =  "Lisbon";
-projections[ 1886 ][ 0 ] =  "4208";		projections[ 1886 ][ 1 ] =  "Aratu";
-projections[ 1887 ][ 0 ] =  "4209";		projections[ 1887 ][ 1 ] =  "Arc 1950";
-projections[ 1888 ][ 0 ] =  "4210";		projections[ 1888 ][ 1 ] =  "Arc 1960";
-projections[ 1889 ][ 0 ] =  "4211";		projections[ 1889 ][ 1 ] =  "Batavia";
-projections[ 1890 ][ 0 ] =  "4212";		projections[ 1890 ][ 1 ] =  "Barbados 1938";
-projections[ 1891 ][ 0 ] =  "4213";		projections[ 1891 ][ 1 ] =  "Beduaram";
-projections[ 1892 ][ 0 ] =  "4214";		projections[ 1892 ][ 1 ] =  "Beijing 1954";
-projections[ 1893 ][ 0 ] =  "4215";		projections[ 1893 ][ 1 ] =  "Belge 1950";
-projections[ 1894 ][ 0 ] =  "4216";		projections[ 1894 ][ 1 ] =  "Bermuda 1957";
-projections[ 1895 ][ 0 ] =  "4218";		projections[ 1895 ][ 1 ] =  "Bogota 1975";
-projections[ 1896 ][ 0 ] =  "4219";		projections[ 1896 ][ 1 ] =  "Bukit Rimpah";
-projections[ 1897 ][ 0 ] =  "4220";		projections[ 1897 ][ 1 ] =  "Camacupa";
-projections[ 1898 ][ 0 ] =  "4221";		projections[ 1898 ][ 1 ] =  "Campo Inchauspe";
-projections[ 1899 ][ 0 ] =  "4222";		projections[ 1899 ][ 1 ] =  "Cape";
-projections[ 1900 ][ 0 ] =  "4223";		projections[ 1900 ][ 1 ] =  "Carthage";
-projections[ 1901 ][ 0 ] =  "4224";		projections[ 1901 ][ 1 ] =  "Chua";
-projections[ 1902 ][ 0 ] =  "4225";		projections[ 1902 ][ 1 ] =  "Corrego Alegre";
-projections[ 1903 ][ 0 ] =  "4226";		projections[ 1903 ][ 1 ] =  "Cote d'Ivoire";
-projections[ 1904 ][ 0 ] =  "4227";		projections[ 1904 ][ 1 ] =  "Deir ez Zor";
-projections[ 1905 ][ 0 ] =  "4228";		projections[ 1905 ][ 1 ] =  "Douala";
-projections[ 1906 ][ 0 ] =  "4229";		projections[ 1906 ][ 1 ] =  "Egypt 1907";
-projections[ 1907 ][ 0 ] =  "4230";		projections[ 1907 ][ 1 ] =  "ED50";
-projections[ 1908 ][ 0 ] =  "4231";		projections[ 1908 ][ 1 ] =  "ED87";
-projections[ 1909 ][ 0 ] =  "4232";		projections[ 1909 ][ 1 ] =  "Fahud";
-projections[ 1910 ][ 0 ] =  "4233";		projections[ 1910 ][ 1 ] =  "Gandajika 1970";
-projections[ 1911 ][ 0 ] =  "4234";		projections[ 1911 ][ 1 ] =  "Garoua";
-projections[ 1912 ][ 0 ] =  "4235";		projections[ 1912 ][ 1 ] =  "Guyane Francaise";
-projections[ 1913 ][ 0 ] =  "4236";		projections[ 1913 ][ 1 ] =  "Hu Tzu Shan";
-projections[ 1914 ][ 0 ] =  "4237";		projections[ 1914 ][ 1 ] =  "HD72";
-projections[ 1915 ][ 0 ] =  "4238";		projections[ 1915 ][ 1 ] =  "ID74";
-projections[ 1916 ][ 0 ] =  "4239";		projections[ 1916 ][ 1 ] =  "Indian 1954";
-projections[ 1917 ][ 0 ] =  "4240";		projections[ 1917 ][ 1 ] =  "Indian 1975";
-projections[ 1918 ][ 0 ] =  "4241";		projections[ 1918 ][ 1 ] =  "Jamaica 1875";
-projections[ 1919 ][ 0 ] =  "4242";		projections[ 1919 ][ 1 ] =  "JAD69";
-projections[ 1920 ][ 0 ] =  "4243";		projections[ 1920 ][ 1 ] =  "Kalianpur 1880";
-projections[ 1921 ][ 0 ] =  "4244";		projections[ 1921 ][ 1 ] =  "Kandawala";
-projections[ 1922 ][ 0 ] =  "4245";		projections[ 1922 ][ 1 ] =  "Kertau 1968";
-projections[ 1923 ][ 0 ] =  "4246";		projections[ 1923 ][ 1 ] =  "KOC";
-projections[ 1924 ][ 0 ] =  "4247";		projections[ 1924 ][ 1 ] =  "La Canoa";
-projections[ 1925 ][ 0 ] =  "4248";		projections[ 1925 ][ 1 ] =  "PSAD56";
-projections[ 1926 ][ 0 ] =  "4249";		projections[ 1926 ][ 1 ] =  "Lake";
-projections[ 1927 ][ 0 ] =  "4250";		projections[ 1927 ][ 1 ] =  "Leigon";
-projections[ 1928 ][ 0 ] =  "4251";		projections[ 1928 ][ 1 ] =  "Liberia 1964";
-projections[ 1929 ][ 0 ] =  "4252";		projections[ 1929 ][ 1 ] =  "Lome";
-projections[ 1930 ][ 0 ] =  "4253";		projections[ 1930 ][ 1 ] =  "Luzon 1911";
-projections[ 1931 ][ 0 ] =  "4254";		projections[ 1931 ][ 1 ] =  "Hito XVIII 1963";
-projections[ 1932 ][ 0 ] =  "4255";		projections[ 1932 ][ 1 ] =  "Herat North";
-projections[ 1933 ][ 0 ] =  "4256";		projections[ 1933 ][ 1 ] =  "Mahe 1971";
-projections[ 1934 ][ 0 ] =  "4257";		projections[ 1934 ][ 1 ] =  "Makassar";
-projections[ 1935 ][ 0 ] =  "4258";		projections[ 1935 ][ 1 ] =  "ETRS89";
-projections[ 1936 ][ 0 ] =  "4259";		projections[ 1936 ][ 1 ] =  "Malongo 1987";
-projections[ 1937 ][ 0 ] =  "4260";		projections[ 1937 ][ 1 ] =  "Manoca";
-projections[ 1938 ][ 0 ] =  "4261";		projections[ 1938 ][ 1 ] =  "Merchich";
-projections[ 1939 ][ 0 ] =  "4262";		projections[ 1939 ][ 1 ] =  "Massawa";
-projections[ 1940 ][ 0 ] =  "4263";		projections[ 1940 ][ 1 ] =  "Minna";
-projections[ 1941 ][ 0 ] =  "4264";		projections[ 1941 ][ 1 ] =  "Mhast";
-projections[ 1942 ][ 0 ] =  "4265";		projections[ 1942 ][ 1 ] =  "Monte Mario";
-projections[ 1943 ][ 0 ] =  "4266";		projections[ 1943 ][ 1 ] =  "M'poraloko";
-projections[ 1944 ][ 0 ] =  "4267";		projections[ 1944 ][ 1 ] =  "NAD27";
-projections[ 1945 ][ 0 ] =  "4268";		projections[ 1945 ][ 1 ] =  "NAD27 Michigan";
-projections[ 1946 ][ 0 ] =  "4269";		projections[ 1946 ][ 1 ] =  "NAD83";
-projections[ 1947 ][ 0 ] =  "4270";		projections[ 1947 ][ 1 ] =  "Nahrwan 1967";
-projections[ 1948 ][ 0 ] =  "4271";		projections[ 1948 ][ 1 ] =  "Naparima 1972";
-projections[ 1949 ][ 0 ] =  "4272";		projections[ 1949 ][ 1 ] =  "NZGD49";
-projections[ 1950 ][ 0 ] =  "4273";		projections[ 1950 ][ 1 ] =  "NGO 1948";
-projections[ 1951 ][ 0 ] =  "4274";		projections[ 1951 ][ 1 ] =  "Datum 73";
-projections[ 1952 ][ 0 ] =  "4275";		projections[ 1952 ][ 1 ] =  "NTF";
-projections[ 1953 ][ 0 ] =  "4276";		projections[ 1953 ][ 1 ] =  "NSWC 9Z-2";
-projections[ 1954 ][ 0 ] =  "4277";		projections[ 1954 ][ 1 ] =  "OSGB 1936";
-projections[ 1955 ][ 0 ] =  "4278";		projections[ 1955 ][ 1 ] =  "OSGB70";
-projections[ 1956 ][ 0 ] =  "4279";		projections[ 1956 ][ 1 ] =  "OS(SN)80";
-projections[ 1957 ][ 0 ] =  "4280";		projections[ 1957 ][ 1 ] =  "Padang";
-projections[ 1958 ][ 0 ] =  "4281";		projections[ 1958 ][ 1 ] =  "Palestine 1923";
-projections[ 1959 ][ 0 ] =  "4282";		projections[ 1959 ][ 1 ] =  "Pointe Noire";
-projections[ 1960 ][ 0 ] =  "4283";		projections[ 1960 ][ 1 ] =  "GDA94";
-projections[ 1961 ][ 0 ] =  "4284";		projections[ 1961 ][ 1 ] =  "Pulkovo 1942";
-projections[ 1962 ][ 0 ] =  "4285";		projections[ 1962 ][ 1 ] =  "Qatar 1974";
-projections[ 1963 ][ 0 ] =  "4286";		projections[ 1963 ][ 1 ] =  "Qatar 1948";
-projections[ 1964 ][ 0 ] =  "4287";		projections[ 1964 ][ 1 ] =  "Qornoq";
-projections[ 1965 ][ 0 ] =  "4288";		projections[ 1965 ][ 1 ] =  "Loma Quintana";
-projections[ 1966 ][ 0 ] =  "4289";		projections[ 1966 ][ 1 ] =  "Amersfoort";
-projections[ 1967 ][ 0 ] =  "4291";		projections[ 1967 ][ 1 ] =  "SAD69";
-projections[ 1968 ][ 0 ] =  "4292";		projections[ 1968 ][ 1 ] =  "Sapper Hill 1943";
-projections[ 1969 ][ 0 ] =  "4293";		projections[ 1969 ][ 1 ] =  "Schwarzeck";
-projections[ 1970 ][ 0 ] =  "4294";		projections[ 1970 ][ 1 ] =  "Segora";
-projections[ 1971 ][ 0 ] =  "4295";		projections[ 1971 ][ 1 ] =  "Serindung";
-projections[ 1972 ][ 0 ] =  "4296";		projections[ 1972 ][ 1 ] =  "Sudan";
-projections[ 1973 ][ 0 ] =  "4297";		projections[ 1973 ][ 1 ] =  "Tananarive";
-projections[ 1974 ][ 0 ] =  "4298";		projections[ 1974 ][ 1 ] =  "Timbalai 1948";
-projections[ 1975 ][ 0 ] =  "4299";		projections[ 1975 ][ 1 ] =  "TM65";
-projections[ 1976 ][ 0 ] =  "4300";		projections[ 1976 ][ 1 ] =  "TM75";
-projections[ 1977 ][ 0 ] =  "4301";		projections[ 1977 ][ 1 ] =  "Tokyo";
-projections[ 1978 ][ 0 ] =  "4302";		projections[ 1978 ][ 1 ] =  "Trinidad 1903";
-projections[ 1979 ][ 0 ] =  "4303";		projections[ 1979 ][ 1 ] =  "TC(1948)";
-projections[ 1980 ][ 0 ] =  "4304";		projections[ 1980 ][ 1 ] =  "Voirol 1875";
-projections[ 1981 ][ 0 ] =  "4306";		projections[ 1981 ][ 1 ] =  "Bern 1938";
-projections[ 1982 ][ 0 ] =  "4307";		projections[ 1982 ][ 1 ] =  "Nord Sahara 1959";
-projections[ 1983 ][ 0 ] =  "4308";		projections[ 1983 ][ 1 ] =  "RT38";
-projections[ 1984 ][ 0 ] =  "4309";		projections[ 1984 ][ 1 ] =  "Yacare";
-projections[ 1985 ][ 0 ] =  "4310";		projections[ 1985 ][ 1 ] =  "Yoff";
-projections[ 1986 ][ 0 ] =  "4311";		projections[ 1986 ][ 1 ] =  "Zanderij";
-projections[ 1987 ][ 0 ] =  "4312";		projections[ 1987 ][ 1 ] =  "MGI";
-projections[ 1988 ][ 0 ] =  "4313";		projections[ 1988 ][ 1 ] =  "Belge 1972";
-projections[ 1989 ][ 0 ] =  "4314";		projections[ 1989 ][ 1 ] =  "DHDN";
-projections[ 1990 ][ 0 ] =  "4315";		projections[ 1990 ][ 1 ] =  "Conakry 1905";
-projections[ 1991 ][ 0 ] =  "4316";		projections[ 1991 ][ 1 ] =  "Dealul Piscului 1933";
-projections[ 1992 ][ 0 ] =  "4317";		projections[ 1992 ][ 1 ] =  "Dealul Piscului 1970";
-projections[ 1993 ][ 0 ] =  "4318";		projections[ 1993 ][ 1 ] =  "NGN";
-projections[ 1994 ][ 0 ] =  "4319";		projections[ 1994 ][ 1 ] =  "KUDAMS";
-projections[ 1995 ][ 0 ] =  "4322";		projections[ 1995 ][ 1 ] =  "WGS 72";
-projections[ 1996 ][ 0 ] =  "4324";		projections[ 1996 ][ 1 ] =  "WGS 72BE";
-projections[ 1997 ][ 0 ] =  "4326";		projections[ 1997 ][ 1 ] =  "WGS 84";
-projections[ 1998 ][ 0 ] =  "4600";		projections[ 1998 ][ 1 ] =  "Anguilla 1957";
-projections[ 1999 ][ 0 ] =  "4601";		projections[ 1999 ][ 1 ] =  "Antigua 1943";
-projections[ 2000 ][ 0 ] =  "4602";		projections[ 2000 ][ 1 ] =  "Dominica 1945";
-projections[ 2001 ][ 0 ] =  "4603";		projections[ 2001 ][ 1 ] =  "Grenada 1953";
-projections[ 2002 ][ 0 ] =  "4604";		projections[ 2002 ][ 1 ] =  "Montserrat 1958";
-projections[ 2003 ][ 0 ] =  "4605";		projections[ 2003 ][ 1 ] =  "St. Kitts 1955";
-projections[ 2004 ][ 0 ] =  "4606";		projections[ 2004 ][ 1 ] =  "St. Lucia 1955";
-projections[ 2005 ][ 0 ] =  "4607";		projections[ 2005 ][ 1 ] =  "St. Vincent 1945";
-projections[ 2006 ][ 0 ] =  "4608";		projections[ 2006 ][ 1 ] =  "NAD27(76)";
-projections[ 2007 ][ 0 ] =  "4609";		projections[ 2007 ][ 1 ] =  "NAD27(CGQ77)";
-projections[ 2008 ][ 0 ] =  "4610";		projections[ 2008 ][ 1 ] =  "Xian 1980";
-projections[ 2009 ][ 0 ] =  "4611";		projections[ 2009 ][ 1 ] =  "Hong Kong 1980";
-projections[ 2010 ][ 0 ] =  "4612";		projections[ 2010 ][ 1 ] =  "JGD2000";
-projections[ 2011 ][ 0 ] =  "4613";		projections[ 2011 ][ 1 ] =  "Segara";
-projections[ 2012 ][ 0 ] =  "4614";		projections[ 2012 ][ 1 ] =  "QND95";
-projections[ 2013 ][ 0 ] =  "4615";		projections[ 2013 ][ 1 ] =  "Porto Santo";
-projections[ 2014 ][ 0 ] =  "4616";		projections[ 2014 ][ 1 ] =  "Selvagem Grande";
-projections[ 2015 ][ 0 ] =  "4617";		projections[ 2015 ][ 1 ] =  "NAD83(CSRS)";
-projections[ 2016 ][ 0 ] =  "4618";		projections[ 2016 ][ 1 ] =  "SAD69";
-projections[ 2017 ][ 0 ] =  "4619";		projections[ 2017 ][ 1 ] =  "SWEREF99";
-projections[ 2018 ][ 0 ] =  "4620";		projections[ 2018 ][ 1 ] =  "Point 58";
-projections[ 2019 ][ 0 ] =  "4621";		projections[ 2019 ][ 1 ] =  "Fort Marigot";
-projections[ 2020 ][ 0 ] =  "4622";		projections[ 2020 ][ 1 ] =  "Guadeloupe 1948";
-projections[ 2021 ][ 0 ] =  "4623";		projections[ 2021 ][ 1 ] =  "CSG67";
-projections[ 2022 ][ 0 ] =  "4624";		projections[ 2022 ][ 1 ] =  "RGFG95";
-projections[ 2023 ][ 0 ] =  "4625";		projections[ 2023 ][ 1 ] =  "Martinique 1938";
-projections[ 2024 ][ 0 ] =  "4626";		projections[ 2024 ][ 1 ] =  "Reunion 1947";
-projections[ 2025 ][ 0 ] =  "4627";		projections[ 2025 ][ 1 ] =  "RGR92";
-projections[ 2026 ][ 0 ] =  "4628";		projections[ 2026 ][ 1 ] =  "Tahiti 52";
-projections[ 2027 ][ 0 ] =  "4629";		projections[ 2027 ][ 1 ] =  "Tahaa 54";
-projections[ 2028 ][ 0 ] =  "4630";		projections[ 2028 ][ 1 ] =  "IGN72 Nuku Hiva";
-projections[ 2029 ][ 0 ] =  "4631";		projections[ 2029 ][ 1 ] =  "K0 1949";
-projections[ 2030 ][ 0 ] =  "4632";		projections[ 2030 ][ 1 ] =  "Combani 1950";
-projections[ 2031 ][ 0 ] =  "4633";		projections[ 2031 ][ 1 ] =  "IGN56 Lifou";
-projections[ 2032 ][ 0 ] =  "4634";		projections[ 2032 ][ 1 ] =  "IGN72 Grand Terre";
-projections[ 2033 ][ 0 ] =  "4635";		projections[ 2033 ][ 1 ] =  "ST87 Ouvea";
-projections[ 2034 ][ 0 ] =  "4636";		projections[ 2034 ][ 1 ] =  "Petrels 1972";
-projections[ 2035 ][ 0 ] =  "4637";		projections[ 2035 ][ 1 ] =  "Perroud 1950";
-projections[ 2036 ][ 0 ] =  "4638";		projections[ 2036 ][ 1 ] =  "Saint Pierre et Miquelon 1950";
-projections[ 2037 ][ 0 ] =  "4639";		projections[ 2037 ][ 1 ] =  "MOP78";
-projections[ 2038 ][ 0 ] =  "4640";		projections[ 2038 ][ 1 ] =  "RRAF 1991";
-projections[ 2039 ][ 0 ] =  "4641";		projections[ 2039 ][ 1 ] =  "IGN53 Mare";
-projections[ 2040 ][ 0 ] =  "4642";		projections[ 2040 ][ 1 ] =  "ST84 Ile des Pins";
-projections[ 2041 ][ 0 ] =  "4643";		projections[ 2041 ][ 1 ] =  "ST71 Belep";
-projections[ 2042 ][ 0 ] =  "4644";		projections[ 2042 ][ 1 ] =  "NEA74 Noumea";
-projections[ 2043 ][ 0 ] =  "4645";		projections[ 2043 ][ 1 ] =  "RGNC 1991";
-projections[ 2044 ][ 0 ] =  "4646";		projections[ 2044 ][ 1 ] =  "Grand Comoros";
-projections[ 2045 ][ 0 ] =  "4657";		projections[ 2045 ][ 1 ] =  "Reykjavik 1900";
-projections[ 2046 ][ 0 ] =  "4658";		projections[ 2046 ][ 1 ] =  "Hjorsey 1955";
-projections[ 2047 ][ 0 ] =  "4659";		projections[ 2047 ][ 1 ] =  "ISN93";
-projections[ 2048 ][ 0 ] =  "4660";		projections[ 2048 ][ 1 ] =  "Helle 1954";
-projections[ 2049 ][ 0 ] =  "4661";		projections[ 2049 ][ 1 ] =  "LKS92";
-projections[ 2050 ][ 0 ] =  "4662";		projections[ 2050 ][ 1 ] =  "IGN72 Grande Terre";
-projections[ 2051 ][ 0 ] =  "4663";		projections[ 2051 ][ 1 ] =  "Porto Santo 1995";
-projections[ 2052 ][ 0 ] =  "4664";		projections[ 2052 ][ 1 ] =  "Azores Oriental 1995";
-projections[ 2053 ][ 0 ] =  "4665";		projections[ 2053 ][ 1 ] =  "Azores Central 1995";
-projections[ 2054 ][ 0 ] =  "4666";		projections[ 2054 ][ 1 ] =  "Lisbon 1890";
-projections[ 2055 ][ 0 ] =  "4667";		projections[ 2055 ][ 1 ] =  "IKBD-92";
-projections[ 2056 ][ 0 ] =  "4668";		projections[ 2056 ][ 1 ] =  "ED79";
-projections[ 2057 ][ 0 ] =  "4669";		projections[ 2057 ][ 1 ] =  "LKS94";
-projections[ 2058 ][ 0 ] =  "4670";		projections[ 2058 ][ 1 ] =  "IGM95";
-projections[ 2059 ][ 0 ] =  "4671";		projections[ 2059 ][ 1 ] =  "Voirol 1879";
-projections[ 2060 ][ 0 ] =  "4672";		projections[ 2060 ][ 1 ] =  "CI1971";
-projections[ 2061 ][ 0 ] =  "4673";		projections[ 2061 ][ 1 ] =  "CI1979";
-projections[ 2062 ][ 0 ] =  "4674";		projections[ 2062 ][ 1 ] =  "SIRGAS 2000";
-projections[ 2063 ][ 0 ] =  "4675";		projections[ 2063 ][ 1 ] =  "Guam 1963";
-projections[ 2064 ][ 0 ] =  "4676";		projections[ 2064 ][ 1 ] =  "Vientiane 1982";
-projections[ 2065 ][ 0 ] =  "4677";		projections[ 2065 ][ 1 ] =  "Lao 1993";
-projections[ 2066 ][ 0 ] =  "4678";		projections[ 2066 ][ 1 ] =  "Lao 1997";
-projections[ 2067 ][ 0 ] =  "4679";		projections[ 2067 ][ 1 ] =  "Jouik 1961";
-projections[ 2068 ][ 0 ] =  "4680";		projections[ 2068 ][ 1 ] =  "Nouakchott 1965";
-projections[ 2069 ][ 0 ] =  "4681";		projections[ 2069 ][ 1 ] =  "Mauritania 1999";
-projections[ 2070 ][ 0 ] =  "4682";		projections[ 2070 ][ 1 ] =  "Gulshan 303";
-projections[ 2071 ][ 0 ] =  "4683";		projections[ 2071 ][ 1 ] =  "PRS92";
-projections[ 2072 ][ 0 ] =  "4684";		projections[ 2072 ][ 1 ] =  "Gan 1970";
-projections[ 2073 ][ 0 ] =  "4685";		projections[ 2073 ][ 1 ] =  "Gandajika";
-projections[ 2074 ][ 0 ] =  "4686";		projections[ 2074 ][ 1 ] =  "MAGNA-SIRGAS";
-projections[ 2075 ][ 0 ] =  "4687";		projections[ 2075 ][ 1 ] =  "RGPF";
-projections[ 2076 ][ 0 ] =  "4688";		projections[ 2076 ][ 1 ] =  "Fatu Iva 72";
-projections[ 2077 ][ 0 ] =  "4689";		projections[ 2077 ][ 1 ] =  "IGN63 Hiva Oa";
-projections[ 2078 ][ 0 ] =  "4690";		projections[ 2078 ][ 1 ] =  "Tahiti 79";
-projections[ 2079 ][ 0 ] =  "4691";		projections[ 2079 ][ 1 ] =  "Moorea 87";
-projections[ 2080 ][ 0 ] =  "4692";		projections[ 2080 ][ 1 ] =  "Maupiti 83";
-projections[ 2081 ][ 0 ] =  "4693";		projections[ 2081 ][ 1 ] =  "Nakhl-e Ghanem";
-projections[ 2082 ][ 0 ] =  "4694";		projections[ 2082 ][ 1 ] =  "POSGAR 94";
-projections[ 2083 ][ 0 ] =  "4695";		projections[ 2083 ][ 1 ] =  "Katanga 1955";
-projections[ 2084 ][ 0 ] =  "4696";		projections[ 2084 ][ 1 ] =  "Kasai 1953";
-projections[ 2085 ][ 0 ] =  "4697";		projections[ 2085 ][ 1 ] =  "IGC 1962 6th Parallel South";
-projections[ 2086 ][ 0 ] =  "4698";		projections[ 2086 ][ 1 ] =  "IGN 1962 Kerguelen";
-projections[ 2087 ][ 0 ] =  "4699";		projections[ 2087 ][ 1 ] =  "Le Pouce 1934";
-projections[ 2088 ][ 0 ] =  "4700";		projections[ 2088 ][ 1 ] =  "IGN Astro 1960";
-projections[ 2089 ][ 0 ] =  "4701";		projections[ 2089 ][ 1 ] =  "IGCB 1955";
-projections[ 2090 ][ 0 ] =  "4702";		projections[ 2090 ][ 1 ] =  "Mauritania 1999";
-projections[ 2091 ][ 0 ] =  "4703";		projections[ 2091 ][ 1 ] =  "Mhast 1951";
-projections[ 2092 ][ 0 ] =  "4704";		projections[ 2092 ][ 1 ] =  "Mhast (onshore)";
-projections[ 2093 ][ 0 ] =  "4705";		projections[ 2093 ][ 1 ] =  "Mhast (offshore)";
-projections[ 2094 ][ 0 ] =  "4706";		projections[ 2094 ][ 1 ] =  "Egypt Gulf of Suez S-650 TL";
-projections[ 2095 ][ 0 ] =  "4707";		projections[ 2095 ][ 1 ] =  "Tern Island 1961";
-projections[ 2096 ][ 0 ] =  "4708";		projections[ 2096 ][ 1 ] =  "Cocos Islands 1965";
-projections[ 2097 ][ 0 ] =  "4709";		projections[ 2097 ][ 1 ] =  "Iwo Jima 1945";
-projections[ 2098 ][ 0 ] =  "4710";		projections[ 2098 ][ 1 ] =  "St. Helena 1971";
-projections[ 2099 ][ 0 ] =  "4711";		projections[ 2099 ][ 1 ] =  "Marcus Island 1952";
-projections[ 2100 ][ 0 ] =  "4712";		projections[ 2100 ][ 1 ] =  "Ascension Island 1958";
-projections[ 2101 ][ 0 ] =  "4713";		projections[ 2101 ][ 1 ] =  "Ayabelle Lighthouse";
-projections[ 2102 ][ 0 ] =  "4714";		projections[ 2102 ][ 1 ] =  "Bellevue";
-projections[ 2103 ][ 0 ] =  "4715";		projections[ 2103 ][ 1 ] =  "Camp Area Astro";
-projections[ 2104 ][ 0 ] =  "4716";		projections[ 2104 ][ 1 ] =  "Phoenix Islands 1966";
-projections[ 2105 ][ 0 ] =  "4717";		projections[ 2105 ][ 1 ] =  "Cape Canaveral";
-projections[ 2106 ][ 0 ] =  "4718";		projections[ 2106 ][ 1 ] =  "Solomon 1968";
-projections[ 2107 ][ 0 ] =  "4719";		projections[ 2107 ][ 1 ] =  "Easter Island 1967";
-projections[ 2108 ][ 0 ] =  "4720";		projections[ 2108 ][ 1 ] =  "Fiji 1986";
-projections[ 2109 ][ 0 ] =  "4721";		projections[ 2109 ][ 1 ] =  "Fiji 1956";
-projections[ 2110 ][ 0 ] =  "4722";		projections[ 2110 ][ 1 ] =  "South Georgia 1968";
-projections[ 2111 ][ 0 ] =  "4723";		projections[ 2111 ][ 1 ] =  "Grand Cayman 1959";
-projections[ 2112 ][ 0 ] =  "4724";		projections[ 2112 ][ 1 ] =  "Diego Garcia 1969";
-projections[ 2113 ][ 0 ] =  "4725";		projections[ 2113 ][ 1 ] =  "Johnston Island 1961";
-projections[ 2114 ][ 0 ] =  "4726";		projections[ 2114 ][ 1 ] =  "Little Cayman 1961";
-projections[ 2115 ][ 0 ] =  "4727";		projections[ 2115 ][ 1 ] =  "Midway 1961";
-projections[ 2116 ][ 0 ] =  "4728";		projections[ 2116 ][ 1 ] =  "Pico de la Nieves";
-projections[ 2117 ][ 0 ] =  "4729";		projections[ 2117 ][ 1 ] =  "Pitcairn 1967";
-projections[ 2118 ][ 0 ] =  "4730";		projections[ 2118 ][ 1 ] =  "Santo 1965";
-projections[ 2119 ][ 0 ] =  "4731";		projections[ 2119 ][ 1 ] =  "Viti Levu 1916";
-projections[ 2120 ][ 0 ] =  "4732";		projections[ 2120 ][ 1 ] =  "Marshall Islands 1960";
-projections[ 2121 ][ 0 ] =  "4733";		projections[ 2121 ][ 1 ] =  "Wake Island 1952";
-projections[ 2122 ][ 0 ] =  "4734";		projections[ 2122 ][ 1 ] =  "Tristan 1968";
-projections[ 2123 ][ 0 ] =  "4735";		projections[ 2123 ][ 1 ] =  "Kusaie 1951";
-projections[ 2124 ][ 0 ] =  "4736";		projections[ 2124 ][ 1 ] =  "Deception Island";
-projections[ 2125 ][ 0 ] =  "4737";		projections[ 2125 ][ 1 ] =  "Korea 2000";
-projections[ 2126 ][ 0 ] =  "4738";		projections[ 2126 ][ 1 ] =  "Hong Kong 1963";
-projections[ 2127 ][ 0 ] =  "4739";		projections[ 2127 ][ 1 ] =  "Hong Kong 1963(67)";
-projections[ 2128 ][ 0 ] =  "4740";		projections[ 2128 ][ 1 ] =  "PZ-90";
-projections[ 2129 ][ 0 ] =  "4741";		projections[ 2129 ][ 1 ] =  "FD54";
-projections[ 2130 ][ 0 ] =  "4742";		projections[ 2130 ][ 1 ] =  "GDM2000";
-projections[ 2131 ][ 0 ] =  "4743";		projections[ 2131 ][ 1 ] =  "Karbala 1979 (Polservice)";
-projections[ 2132 ][ 0 ] =  "4744";		projections[ 2132 ][ 1 ] =  "Nahrwan 1934";
-projections[ 2133 ][ 0 ] =  "4745";		projections[ 2133 ][ 1 ] =  "RD/83";
-projections[ 2134 ][ 0 ] =  "4746";		projections[ 2134 ][ 1 ] =  "PD/83";
-projections[ 2135 ][ 0 ] =  "4747";		projections[ 2135 ][ 1 ] =  "GR96";
-projections[ 2136 ][ 0 ] =  "4748";		projections[ 2136 ][ 1 ] =  "Vanua Levu 1915";
-projections[ 2137 ][ 0 ] =  "4749";		projections[ 2137 ][ 1 ] =  "RGNC91-93";
-projections[ 2138 ][ 0 ] =  "4750";		projections[ 2138 ][ 1 ] =  "ST87 Ouvea";
-projections[ 2139 ][ 0 ] =  "4751";		projections[ 2139 ][ 1 ] =  "Kertau (RSO)";
-projections[ 2140 ][ 0 ] =  "4752";		projections[ 2140 ][ 1 ] =  "Viti Levu 1912";
-projections[ 2141 ][ 0 ] =  "4753";		projections[ 2141 ][ 1 ] =  "fk89";
-projections[ 2142 ][ 0 ] =  "4754";		projections[ 2142 ][ 1 ] =  "LGD2006";
-projections[ 2143 ][ 0 ] =  "4755";		projections[ 2143 ][ 1 ] =  "DGN95";
-projections[ 2144 ][ 0 ] =  "4756";		projections[ 2144 ][ 1 ] =  "VN-2000";
-projections[ 2145 ][ 0 ] =  "4757";		projections[ 2145 ][ 1 ] =  "SVY21";
-projections[ 2146 ][ 0 ] =  "4758";		projections[ 2146 ][ 1 ] =  "JAD2001";
-projections[ 2147 ][ 0 ] =  "4759";		projections[ 2147 ][ 1 ] =  "NAD83(NSRS2007)";
-projections[ 2148 ][ 0 ] =  "4760";		projections[ 2148 ][ 1 ] =  "WGS 66";
-projections[ 2149 ][ 0 ] =  "4801";		projections[ 2149 ][ 1 ] =  "Bern 1898 (Bern)";
-projections[ 2150 ][ 0 ] =  "4802";		projections[ 2150 ][ 1 ] =  "Bogota 1975 (Bogota)";
-projections[ 2151 ][ 0 ] =  "4803";		projections[ 2151 ][ 1 ] =  "Lisbon (Lisbon)";
-projections[ 2152 ][ 0 ] =  "4804";		projections[ 2152 ][ 1 ] =  "Makassar (Jakarta)";
-projections[ 2153 ][ 0 ] =  "4805";		projections[ 2153 ][ 1 ] =  "MGI (Ferro)";
-projections[ 2154 ][ 0 ] =  "4806";		projections[ 2154 ][ 1 ] =  "Monte Mario (Rome)";
-projections[ 2155 ][ 0 ] =  "4807";		projections[ 2155 ][ 1 ] =  "NTF (Paris)";
-projections[ 2156 ][ 0 ] =  "4808";		projections[ 2156 ][ 1 ] =  "Padang (Jakarta)";
-projections[ 2157 ][ 0 ] =  "4809";		projections[ 2157 ][ 1 ] =  "Belge 1950 (Brussels)";
-projections[ 2158 ][ 0 ] =  "4810";		projections[ 2158 ][ 1 ] =  "Tananarive (Paris)";
-projections[ 2159 ][ 0 ] =  "4811";		projections[ 2159 ][ 1 ] =  "Voirol 1875 (Paris)";
-projections[ 2160 ][ 0 ] =  "4813";		projections[ 2160 ][ 1 ] =  "Batavia (Jakarta)";
-projections[ 2161 ][ 0 ] =  "4814";		projections[ 2161 ][ 1 ] =  "RT38 (Stockholm)";
-projections[ 2162 ][ 0 ] =  "4815";		projections[ 2162 ][ 1 ] =  "Greek (Athens)";
-projections[ 2163 ][ 0 ] =  "4816";		projections[ 2163 ][ 1 ] =  "Carthage (Paris)";
-projections[ 2164 ][ 0 ] =  "4817";		projections[ 2164 ][ 1 ] =  "NGO 1948 (Oslo)";
-projections[ 2165 ][ 0 ] =  "4818";		projections[ 2165 ][ 1 ] =  "S-JTSK (Ferro)";
-projections[ 2166 ][ 0 ] =  "4819";		projections[ 2166 ][ 1 ] =  "Nord Sahara 1959 (Paris)";
-projections[ 2167 ][ 0 ] =  "4820";		projections[ 2167 ][ 1 ] =  "Segara (Jakarta)";
-projections[ 2168 ][ 0 ] =  "4821";		projections[ 2168 ][ 1 ] =  "Voirol 1879 (Paris)";
-projections[ 2169 ][ 0 ] =  "4901";		projections[ 2169 ][ 1 ] =  "ATF (Paris)";
-projections[ 2170 ][ 0 ] =  "4902";		projections[ 2170 ][ 1 ] =  "NDG (Paris)";
-projections[ 2171 ][ 0 ] =  "4903";		projections[ 2171 ][ 1 ] =  "Madrid 1870 (Madrid)";
-projections[ 2172 ][ 0 ] =  "4904";		projections[ 2172 ][ 1 ] =  "Lisbon 1890 (Lisbon)";
-projections[ 2173 ][ 0 ] =  "20004";	projections[ 2173 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 4";
-projections[ 2174 ][ 0 ] =  "20005";	projections[ 2174 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 5";
-projections[ 2175 ][ 0 ] =  "20006";	projections[ 2175 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 6";
-projections[ 2176 ][ 0 ] =  "20007";	projections[ 2176 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 7";
-projections[ 2177 ][ 0 ] =  "20008";	projections[ 2177 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 8";
-projections[ 2178 ][ 0 ] =  "20009";	projections[ 2178 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 9";
-projections[ 2179 ][ 0 ] =  "20010";	projections[ 2179 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 10";
-projections[ 2180 ][ 0 ] =  "20011";	projections[ 2180 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 11";
-projections[ 2181 ][ 0 ] =  "20012";	projections[ 2181 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 12";
-projections[ 2182 ][ 0 ] =  "20013";	projections[ 2182 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 13";
-projections[ 2183 ][ 0 ] =  "20014";	projections[ 2183 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 14";
-projections[ 2184 ][ 0 ] =  "20015";	projections[ 2184 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 15";
-projections[ 2185 ][ 0 ] =  "20016";	projections[ 2185 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 16";
-projections[ 2186 ][ 0 ] =  "20017";	projections[ 2186 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 17";
-projections[ 2187 ][ 0 ] =  "20018";	projections[ 2187 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 18";
-projections[ 2188 ][ 0 ] =  "20019";	projections[ 2188 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 19";
-projections[ 2189 ][ 0 ] =  "20020";	projections[ 2189 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 20";
-projections[ 2190 ][ 0 ] =  "20021";	projections[ 2190 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 21";
-projections[ 2191 ][ 0 ] =  "20022";	projections[ 2191 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 22";
-projections[ 2192 ][ 0 ] =  "20023";	projections[ 2192 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 23";
-projections[ 2193 ][ 0 ] =  "20024";	projections[ 2193 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 24";
-projections[ 2194 ][ 0 ] =  "20025";	projections[ 2194 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 25";
-projections[ 2195 ][ 0 ] =  "20026";	projections[ 2195 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 26";
-projections[ 2196 ][ 0 ] =  "20027";	projections[ 2196 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 27";
-projections[ 2197 ][ 0 ] =  "20028";	projections[ 2197 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 28";
-projections[ 2198 ][ 0 ] =  "20029";	projections[ 2198 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 29";
-projections[ 2199 ][ 0 ] =  "20030";	projections[ 2199 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 30";
-projections[ 2200 ][ 0 ] =  "20031";	projections[ 2200 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 31";
-projections[ 2201 ][ 0 ] =  "20032";	projections[ 2201 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger zone 32";
-projections[ 2202 ][ 0 ] =  "20064";	projections[ 2202 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 4N";
-projections[ 2203 ][ 0 ] =  "20065";	projections[ 2203 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 5N";
-projections[ 2204 ][ 0 ] =  "20066";	projections[ 2204 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 6N";
-projections[ 2205 ][ 0 ] =  "20067";	projections[ 2205 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 7N";
-projections[ 2206 ][ 0 ] =  "20068";	projections[ 2206 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 8N";
-projections[ 2207 ][ 0 ] =  "20069";	projections[ 2207 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 9N";
-projections[ 2208 ][ 0 ] =  "20070";	projections[ 2208 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 10N";
-projections[ 2209 ][ 0 ] =  "20071";	projections[ 2209 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 11N";
-projections[ 2210 ][ 0 ] =  "20072";	projections[ 2210 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 12N";
-projections[ 2211 ][ 0 ] =  "20073";	projections[ 2211 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 13N";
-projections[ 2212 ][ 0 ] =  "20074";	projections[ 2212 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 14N";
-projections[ 2213 ][ 0 ] =  "20075";	projections[ 2213 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 15N";
-projections[ 2214 ][ 0 ] =  "20076";	projections[ 2214 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 16N";
-projections[ 2215 ][ 0 ] =  "20077";	projections[ 2215 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 17N";
-projections[ 2216 ][ 0 ] =  "20078";	projections[ 2216 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 18N";
-projections[ 2217 ][ 0 ] =  "20079";	projections[ 2217 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 19N";
-projections[ 2218 ][ 0 ] =  "20080";	projections[ 2218 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 20N";
-projections[ 2219 ][ 0 ] =  "20081";	projections[ 2219 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 21N";
-projections[ 2220 ][ 0 ] =  "20082";	projections[ 2220 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 22N";
-projections[ 2221 ][ 0 ] =  "20083";	projections[ 2221 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 23N";
-projections[ 2222 ][ 0 ] =  "20084";	projections[ 2222 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 24N";
-projections[ 2223 ][ 0 ] =  "20085";	projections[ 2223 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 25N";
-projections[ 2224 ][ 0 ] =  "20086";	projections[ 2224 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 26N";
-projections[ 2225 ][ 0 ] =  "20087";	projections[ 2225 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 27N";
-projections[ 2226 ][ 0 ] =  "20088";	projections[ 2226 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 28N";
-projections[ 2227 ][ 0 ] =  "20089";	projections[ 2227 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 29N";
-projections[ 2228 ][ 0 ] =  "20090";	projections[ 2228 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 30N";
-projections[ 2229 ][ 0 ] =  "20091";	projections[ 2229 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 31N";
-projections[ 2230 ][ 0 ] =  "20092";	projections[ 2230 ][ 1 ] =  "Pulkovo 1995 / Gauss-Kruger 32N";
-projections[ 2231 ][ 0 ] =  "20135";	projections[ 2231 ][ 1 ] =  "Adindan / UTM zone 35N";
-projections[ 2232 ][ 0 ] =  "20136";	projections[ 2232 ][ 1 ] =  "Adindan / UTM zone 36N";
-projections[ 2233 ][ 0 ] =  "20137";	projections[ 2233 ][ 1 ] =  "Adindan / UTM zone 37N";
-projections[ 2234 ][ 0 ] =  "20138";	projections[ 2234 ][ 1 ] =  "Adindan / UTM zone 38N";
-projections[ 2235 ][ 0 ] =  "20248";	projections[ 2235 ][ 1 ] =  "AGD66 / AMG zone 48";
-projections[ 2236 ][ 0 ] =  "20249";	projections[ 2236 ][ 1 ] =  "AGD66 / AMG zone 49";
-projections[ 2237 ][ 0 ] =  "20250";	projections[ 2237 ][ 1 ] =  "AGD66 / AMG zone 50";
-projections[ 2238 ][ 0 ] =  "20251";	projections[ 2238 ][ 1 ] =  "AGD66 / AMG zone 51";
-projections[ 2239 ][ 0 ] =  "20252";	projections[ 2239 ][ 1 ] =  "AGD66 / AMG zone 52";
-projections[ 2240 ][ 0 ] =  "20253";	projections[ 2240 ][ 1 ] =  "AGD66 / AMG zone 53";
-projections[ 2241 ][ 0 ] =  "20254";	projections[ 2241 ][ 1 ] =  "AGD66 / AMG zone 54";
-projections[ 2242 ][ 0 ] =  "20255";	projections[ 2242 ][ 1 ] =  "AGD66 / AMG zone 55";
-projections[ 2243 ][ 0 ] =  "20256";	projections[ 2243 ][ 1 ] =  "AGD66 / AMG zone 56";
-projections[ 2244 ][ 0 ] =  "20257";	projections[ 2244 ][ 1 ] =  "AGD66 / AMG zone 57";
-projections[ 2245 ][ 0 ] =  "20258";	projections[ 2245 ][ 1 ] =  "AGD66 / AMG zone 58";
-projections[ 2246 ][ 0 ] =  "20348";	projections[ 2246 ][ 1 ] =  "AGD84 / AMG zone 48";
-projections[ 2247 ][ 0 ] =  "20349";	projections[ 2247 ][ 1 ] =  "AGD84 / AMG zone 49";
-projections[ 2248 ][ 0 ] =  "20350";	projections[ 2248 ][ 1 ] =  "AGD84 / AMG zone 50";
-projections[ 2249 ][ 0 ] =  "20351";	projections[ 2249 ][ 1 ] =  "AGD84 / AMG zone 51";
-projections[ 2250 ][ 0 ] =  "20352";	projections[ 2250 ][ 1 ] =  "AGD84 / AMG zone 52";
-projections[ 2251 ][ 0 ] =  "20353";	projections[ 2251 ][ 1 ] =  "AGD84 / AMG zone 53";
-projections[ 2252 ][ 0 ] =  "20354";	projections[ 2252 ][ 1 ] =  "AGD84 / AMG zone 54";
-projections[ 2253 ][ 0 ] =  "20355";	projections[ 2253 ][ 1 ] =  "AGD84 / AMG zone 55";
-projections[ 2254 ][ 0 ] =  "20356";	projections[ 2254 ][ 1 ] =  "AGD84 / AMG zone 56";
-projections[ 2255 ][ 0 ] =  "20357";	projections[ 2255 ][ 1 ] =  "AGD84 / AMG zone 57";
-projections[ 2256 ][ 0 ] =  "20358";	projections[ 2256 ][ 1 ] =  "AGD84 / AMG zone 58";
-projections[ 2257 ][ 0 ] =  "20436";	projections[ 2257 ][ 1 ] =  "Ain el Abd / UTM zone 36N";
-projections[ 2258 ][ 0 ] =  "20437";	projections[ 2258 ][ 1 ] =  "Ain el Abd / UTM zone 37N";
-projections[ 2259 ][ 0 ] =  "20438";	projections[ 2259 ][ 1 ] =  "Ain el Abd / UTM zone 38N";
-projections[ 2260 ][ 0 ] =  "20439";	projections[ 2260 ][ 1 ] =  "Ain el Abd / UTM zone 39N";
-projections[ 2261 ][ 0 ] =  "20440";	projections[ 2261 ][ 1 ] =  "Ain el Abd / UTM zone 40N";
-projections[ 2262 ][ 0 ] =  "20499";	projections[ 2262 ][ 1 ] =  "Ain el Abd / Bahrain Grid";
-projections[ 2263 ][ 0 ] =  "20538";	projections[ 2263 ][ 1 ] =  "Afgooye / UTM zone 38N";
-projections[ 2264 ][ 0 ] =  "20539";	projections[ 2264 ][ 1 ] =  "Afgooye / UTM zone 39N";
-projections[ 2265 ][ 0 ] =  "20790";	projections[ 2265 ][ 1 ] =  "Lisbon (Lisbon)/Portuguese National Grid";
-projections[ 2266 ][ 0 ] =  "20791";	projections[ 2266 ][ 1 ] =  "Lisbon (Lisbon)/Portuguese Grid";
-projections[ 2267 ][ 0 ] =  "20822";	projections[ 2267 ][ 1 ] =  "Aratu / UTM zone 22S";
-projections[ 2268 ][ 0 ] =  "20823";	projections[ 2268 ][ 1 ] =  "Aratu / UTM zone 23S";
-projections[ 2269 ][ 0 ] =  "20824";	projections[ 2269 ][ 1 ] =  "Aratu / UTM zone 24S";
-projections[ 2270 ][ 0 ] =  "20934";	projections[ 2270 ][ 1 ] =  "Arc 1950 / UTM zone 34S";
-projections[ 2271 ][ 0 ] =  "20935";	projections[ 2271 ][ 1 ] =  "Arc 1950 / UTM zone 35S";
-projections[ 2272 ][ 0 ] =  "20936";	projections[ 2272 ][ 1 ] =  "Arc 1950 / UTM zone 36S";
-projections[ 2273 ][ 0 ] =  "21035";	projections[ 2273 ][ 1 ] =  "Arc 1960 / UTM zone 35S";
-projections[ 2274 ][ 0 ] =  "21036";	projections[ 2274 ][ 1 ] =  "Arc 1960 / UTM zone 36S";
-projections[ 2275 ][ 0 ] =  "21037";	projections[ 2275 ][ 1 ] =  "Arc 1960 / UTM zone 37S";
-projections[ 2276 ][ 0 ] =  "21095";	projections[ 2276 ][ 1 ] =  "Arc 1960 / UTM zone 35N";
-projections[ 2277 ][ 0 ] =  "21096";	projections[ 2277 ][ 1 ] =  "Arc 1960 / UTM zone 36N";
-projections[ 2278 ][ 0 ] =  "21097";	projections[ 2278 ][ 1 ] =  "Arc 1960 / UTM zone 37N";
-projections[ 2279 ][ 0 ] =  "21100";	projections[ 2279 ][ 1 ] =  "Batavia (Jakarta) / NEIEZ";
-projections[ 2280 ][ 0 ] =  "21148";	projections[ 2280 ][ 1 ] =  "Batavia / UTM zone 48S";
-projections[ 2281 ][ 0 ] =  "21149";	projections[ 2281 ][ 1 ] =  "Batavia / UTM zone 49S";
-projections[ 2282 ][ 0 ] =  "21150";	projections[ 2282 ][ 1 ] =  "Batavia / UTM zone 50S";
-projections[ 2283 ][ 0 ] =  "21291";	projections[ 2283 ][ 1 ] =  "Barbados 1938 / British West Indies Grid";
-projections[ 2284 ][ 0 ] =  "21292";	projections[ 2284 ][ 1 ] =  "Barbados 1938 / Barbados National Grid";
-projections[ 2285 ][ 0 ] =  "21413";	projections[ 2285 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 13";
-projections[ 2286 ][ 0 ] =  "21414";	projections[ 2286 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 14";
-projections[ 2287 ][ 0 ] =  "21415";	projections[ 2287 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 15";
-projections[ 2288 ][ 0 ] =  "21416";	projections[ 2288 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 16";
-projections[ 2289 ][ 0 ] =  "21417";	projections[ 2289 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 17";
-projections[ 2290 ][ 0 ] =  "21418";	projections[ 2290 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 18";
-projections[ 2291 ][ 0 ] =  "21419";	projections[ 2291 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 19";
-projections[ 2292 ][ 0 ] =  "21420";	projections[ 2292 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 20";
-projections[ 2293 ][ 0 ] =  "21421";	projections[ 2293 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 21";
-projections[ 2294 ][ 0 ] =  "21422";	projections[ 2294 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 22";
-projections[ 2295 ][ 0 ] =  "21423";	projections[ 2295 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger zone 23";
-projections[ 2296 ][ 0 ] =  "21453";	projections[ 2296 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 75E";
-projections[ 2297 ][ 0 ] =  "21454";	projections[ 2297 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 81E";
-projections[ 2298 ][ 0 ] =  "21455";	projections[ 2298 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 87E";
-projections[ 2299 ][ 0 ] =  "21456";	projections[ 2299 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 93E";
-projections[ 2300 ][ 0 ] =  "21457";	projections[ 2300 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 99E";
-projections[ 2301 ][ 0 ] =  "21458";	projections[ 2301 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 105E";
-projections[ 2302 ][ 0 ] =  "21459";	projections[ 2302 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 111E";
-projections[ 2303 ][ 0 ] =  "21460";	projections[ 2303 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 117E";
-projections[ 2304 ][ 0 ] =  "21461";	projections[ 2304 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 123E";
-projections[ 2305 ][ 0 ] =  "21462";	projections[ 2305 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 129E";
-projections[ 2306 ][ 0 ] =  "21463";	projections[ 2306 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger CM 135E";
-projections[ 2307 ][ 0 ] =  "21473";	projections[ 2307 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 13N";
-projections[ 2308 ][ 0 ] =  "21474";	projections[ 2308 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 14N";
-projections[ 2309 ][ 0 ] =  "21475";	projections[ 2309 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 15N";
-projections[ 2310 ][ 0 ] =  "21476";	projections[ 2310 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 16N";
-projections[ 2311 ][ 0 ] =  "21477";	projections[ 2311 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 17N";
-projections[ 2312 ][ 0 ] =  "21478";	projections[ 2312 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 18N";
-projections[ 2313 ][ 0 ] =  "21479";	projections[ 2313 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 19N";
-projections[ 2314 ][ 0 ] =  "21480";	projections[ 2314 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 20N";
-projections[ 2315 ][ 0 ] =  "21481";	projections[ 2315 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 21N";
-projections[ 2316 ][ 0 ] =  "21482";	projections[ 2316 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 22N";
-projections[ 2317 ][ 0 ] =  "21483";	projections[ 2317 ][ 1 ] =  "Beijing 1954 / Gauss-Kruger 23N";
-projections[ 2318 ][ 0 ] =  "21500";	projections[ 2318 ][ 1 ] =  "Belge 1950 (Brussels) / Belge Lambert 50";
-projections[ 2319 ][ 0 ] =  "21780";	projections[ 2319 ][ 1 ] =  "Bern 1898 (Bern) / LV03C";
-projections[ 2320 ][ 0 ] =  "21781";	projections[ 2320 ][ 1 ] =  "CH1903 / LV03";
-projections[ 2321 ][ 0 ] =  "21817";	projections[ 2321 ][ 1 ] =  "Bogota 1975 / UTM zone 17N";
-projections[ 2322 ][ 0 ] =  "21818";	projections[ 2322 ][ 1 ] =  "Bogota 1975 / UTM zone 18N";
-projections[ 2323 ][ 0 ] =  "21891";	projections[ 2323 ][ 1 ] =  "Bogota 1975 / Colombia West zone";
-projections[ 2324 ][ 0 ] =  "21892";	projections[ 2324 ][ 1 ] =  "Bogota 1975 / Colombia Bogota zone";
-projections[ 2325 ][ 0 ] =  "21893";	projections[ 2325 ][ 1 ] =  "Bogota 1975 / Colombia East Central zone";
-projections[ 2326 ][ 0 ] =  "21894";	projections[ 2326 ][ 1 ] =  "Bogota 1975 / Colombia East";
-projections[ 2327 ][ 0 ] =  "21896";	projections[ 2327 ][ 1 ] =  "Bogota 1975 / Colombia West zone";
-projections[ 2328 ][ 0 ] =  "21897";	projections[ 2328 ][ 1 ] =  "Bogota 1975 / Colombia Bogota zone";
-projections[ 2329 ][ 0 ] =  "21898";	projections[ 2329 ][ 1 ] =  "Bogota 1975 / Colombia East Central zone";
-projections[ 2330 ][ 0 ] =  "21899";	projections[ 2330 ][ 1 ] =  "Bogota 1975 / Colombia East";
-projections[ 2331 ][ 0 ] =  "22032";	projections[ 2331 ][ 1 ] =  "Camacupa / UTM zone 32S";
-projections[ 2332 ][ 0 ] =  "22033";	projections[ 2332 ][ 1 ] =  "Camacupa / UTM zone 33S";
-projections[ 2333 ][ 0 ] =  "22091";	projections[ 2333 ][ 1 ] =  "Camacupa / TM 11.30 SE";
-projections[ 2334 ][ 0 ] =  "22092";	projections[ 2334 ][ 1 ] =  "Camacupa / TM 12 SE";
-projections[ 2335 ][ 0 ] =  "22171";	projections[ 2335 ][ 1 ] =  "POSGAR 98 / Argentina 1";
-projections[ 2336 ][ 0 ] =  "22172";	projections[ 2336 ][ 1 ] =  "POSGAR 98 / Argentina 2";
-projections[ 2337 ][ 0 ] =  "22173";	projections[ 2337 ][ 1 ] =  "POSGAR 98 / Argentina 3";
-projections[ 2338 ][ 0 ] =  "22174";	projections[ 2338 ][ 1 ] =  "POSGAR 98 / Argentina 4";
-projections[ 2339 ][ 0 ] =  "22175";	projections[ 2339 ][ 1 ] =  "POSGAR 98 / Argentina 5";
-projections[ 2340 ][ 0 ] =  "22176";	projections[ 2340 ][ 1 ] =  "POSGAR 98 / Argentina 6";
-projections[ 2341 ][ 0 ] =  "22177";	projections[ 2341 ][ 1 ] =  "POSGAR 98 / Argentina 7";
-projections[ 2342 ][ 0 ] =  "22181";	projections[ 2342 ][ 1 ] =  "POSGAR 94 / Argentina 1";
-projections[ 2343 ][ 0 ] =  "22182";	projections[ 2343 ][ 1 ] =  "POSGAR 94 / Argentina 2";
-projections[ 2344 ][ 0 ] =  "22183";	projections[ 2344 ][ 1 ] =  "POSGAR 94 / Argentina 3";
-projections[ 2345 ][ 0 ] =  "22184";	projections[ 2345 ][ 1 ] =  "POSGAR 94 / Argentina 4";
-projections[ 2346 ][ 0 ] =  "22185";	projections[ 2346 ][ 1 ] =  "POSGAR 94 / Argentina 5";
-projections[ 2347 ][ 0 ] =  "22186";	projections[ 2347 ][ 1 ] =  "POSGAR 94 / Argentina 6";
-projections[ 2348 ][ 0 ] =  "22187";	projections[ 2348 ][ 1 ] =  "POSGAR 94 / Argentina 7";
-projections[ 2349 ][ 0 ] =  "22191";	projections[ 2349 ][ 1 ] =  "Campo Inchauspe / Argentina 1";
-projections[ 2350 ][ 0 ] =  "22192";	projections[ 2350 ][ 1 ] =  "Campo Inchauspe / Argentina 2";
-projections[ 2351 ][ 0 ] =  "22193";	projections[ 2351 ][ 1 ] =  "Campo Inchauspe / Argentina 3";
-projections[ 2352 ][ 0 ] =  "22194";	projections[ 2352 ][ 1 ] =  "Campo Inchauspe / Argentina 4";
-projections[ 2353 ][ 0 ] =  "22195";	projections[ 2353 ][ 1 ] =  "Campo Inchauspe / Argentina 5";
-projections[ 2354 ][ 0 ] =  "22196";	projections[ 2354 ][ 1 ] =  "Campo Inchauspe / Argentina 6";
-projections[ 2355 ][ 0 ] =  "22197";	projections[ 2355 ][ 1 ] =  "Campo Inchauspe / Argentina 7";
-projections[ 2356 ][ 0 ] =  "22234";	projections[ 2356 ][ 1 ] =  "Cape / UTM zone 34S";
-projections[ 2357 ][ 0 ] =  "22235";	projections[ 2357 ][ 1 ] =  "Cape / UTM zone 35S";
-projections[ 2358 ][ 0 ] =  "22236";	projections[ 2358 ][ 1 ] =  "Cape / UTM zone 36S";
-projections[ 2359 ][ 0 ] =  "22275";	projections[ 2359 ][ 1 ] =  "Cape / Lo15";
-projections[ 2360 ][ 0 ] =  "22277";	projections[ 2360 ][ 1 ] =  "Cape / Lo17";
-projections[ 2361 ][ 0 ] =  "22279";	projections[ 2361 ][ 1 ] =  "Cape / Lo19";
-projections[ 2362 ][ 0 ] =  "22281";	projections[ 2362 ][ 1 ] =  "Cape / Lo21";
-projections[ 2363 ][ 0 ] =  "22283";	projections[ 2363 ][ 1 ] =  "Cape / Lo23";
-projections[ 2364 ][ 0 ] =  "22285";	projections[ 2364 ][ 1 ] =  "Cape / Lo25";
-projections[ 2365 ][ 0 ] =  "22287";	projections[ 2365 ][ 1 ] =  "Cape / Lo27";
-projections[ 2366 ][ 0 ] =  "22289";	projections[ 2366 ][ 1 ] =  "Cape / Lo29";
-projections[ 2367 ][ 0 ] =  "22291";	projections[ 2367 ][ 1 ] =  "Cape / Lo31";
-projections[ 2368 ][ 0 ] =  "22293";	projections[ 2368 ][ 1 ] =  "Cape / Lo33";
-projections[ 2369 ][ 0 ] =  "22300";	projections[ 2369 ][ 1 ] =  "Carthage (Paris) / Tunisia Mining Grid";
-projections[ 2370 ][ 0 ] =  "22332";	projections[ 2370 ][ 1 ] =  "Carthage / UTM zone 32N";
-projections[ 2371 ][ 0 ] =  "22391";	projections[ 2371 ][ 1 ] =  "Carthage / Nord Tunisie";
-projections[ 2372 ][ 0 ] =  "22392";	projections[ 2372 ][ 1 ] =  "Carthage / Sud Tunisie";
-projections[ 2373 ][ 0 ] =  "22521";	projections[ 2373 ][ 1 ] =  "Corrego Alegre / UTM zone 21S";
-projections[ 2374 ][ 0 ] =  "22522";	projections[ 2374 ][ 1 ] =  "Corrego Alegre / UTM zone 22S";
-projections[ 2375 ][ 0 ] =  "22523";	projections[ 2375 ][ 1 ] =  "Corrego Alegre / UTM zone 23S";
-projections[ 2376 ][ 0 ] =  "22524";	projections[ 2376 ][ 1 ] =  "Corrego Alegre / UTM zone 24S";
-projections[ 2377 ][ 0 ] =  "22525";	projections[ 2377 ][ 1 ] =  "Corrego Alegre / UTM zone 25S";
-projections[ 2378 ][ 0 ] =  "22700";	projections[ 2378 ][ 1 ] =  "Deir ez Zor / Levant Zone";
-projections[ 2379 ][ 0 ] =  "22770";	projections[ 2379 ][ 1 ] =  "Deir ez Zor / Syria Lambert";
-projections[ 2380 ][ 0 ] =  "22780";	projections[ 2380 ][ 1 ] =  "Deir ez Zor / Levant Stereographic";
-projections[ 2381 ][ 0 ] =  "22832";	projections[ 2381 ][ 1 ] =  "Douala / UTM zone 32N";
-projections[ 2382 ][ 0 ] =  "22991";	projections[ 2382 ][ 1 ] =  "Egypt 1907 / Blue Belt";
-projections[ 2383 ][ 0 ] =  "22992";	projections[ 2383 ][ 1 ] =  "Egypt 1907 / Red Belt";
-projections[ 2384 ][ 0 ] =  "22993";	projections[ 2384 ][ 1 ] =  "Egypt 1907 / Purple Belt";
-projections[ 2385 ][ 0 ] =  "22994";	projections[ 2385 ][ 1 ] =  "Egypt 1907 / Extended Purple Belt";
-projections[ 2386 ][ 0 ] =  "23028";	projections[ 2386 ][ 1 ] =  "ED50 / UTM zone 28N";
-projections[ 2387 ][ 0 ] =  "23029";	projections[ 2387 ][ 1 ] =  "ED50 / UTM zone 29N";
-projections[ 2388 ][ 0 ] =  "23030";	projections[ 2388 ][ 1 ] =  "ED50 / UTM zone 30N";
-projections[ 2389 ][ 0 ] =  "23031";	projections[ 2389 ][ 1 ] =  "ED50 / UTM zone 31N";
-projections[ 2390 ][ 0 ] =  "23032";	projections[ 2390 ][ 1 ] =  "ED50 / UTM zone 32N";
-projections[ 2391 ][ 0 ] =  "23033";	projections[ 2391 ][ 1 ] =  "ED50 / UTM zone 33N";
-projections[ 2392 ][ 0 ] =  "23034";	projections[ 2392 ][ 1 ] =  "ED50 / UTM zone 34N";
-projections[ 2393 ][ 0 ] =  "23035";	projections[ 2393 ][ 1 ] =  "ED50 / UTM zone 35N";
-projections[ 2394 ][ 0 ] =  "23036";	projections[ 2394 ][ 1 ] =  "ED50 / UTM zone 36N";
-projections[ 2395 ][ 0 ] =  "23037";	projections[ 2395 ][ 1 ] =  "ED50 / UTM zone 37N";
-projections[ 2396 ][ 0 ] =  "23038";	projections[ 2396 ][ 1 ] =  "ED50 / UTM zone 38N";
-projections[ 2397 ][ 0 ] =  "23090";	projections[ 2397 ][ 1 ] =  "ED50 / TM 0 N";
-projections[ 2398 ][ 0 ] =  "23095";	projections[ 2398 ][ 1 ] =  "ED50 / TM 5 NE";
-projections[ 2399 ][ 0 ] =  "23239";	projections[ 2399 ][ 1 ] =  "Fahud / UTM zone 39N";
-projections[ 2400 ][ 0 ] =  "23240";	projections[ 2400 ][ 1 ] =  "Fahud / UTM zone 40N";
-projections[ 2401 ][ 0 ] =  "23433";	projections[ 2401 ][ 1 ] =  "Garoua / UTM zone 33N";
-projections[ 2402 ][ 0 ] =  "23700";	projections[ 2402 ][ 1 ] =  "HD72 / EOV";
-projections[ 2403 ][ 0 ] =  "23830";	projections[ 2403 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 46.2";
-projections[ 2404 ][ 0 ] =  "23831";	projections[ 2404 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 47.1";
-projections[ 2405 ][ 0 ] =  "23832";	projections[ 2405 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 47.2";
-projections[ 2406 ][ 0 ] =  "23833";	projections[ 2406 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 48.1";
-projections[ 2407 ][ 0 ] =  "23834";	projections[ 2407 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 48.2";
-projections[ 2408 ][ 0 ] =  "23835";	projections[ 2408 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 49.1";
-projections[ 2409 ][ 0 ] =  "23836";	projections[ 2409 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 49.2";
-projections[ 2410 ][ 0 ] =  "23837";	projections[ 2410 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 50.1";
-projections[ 2411 ][ 0 ] =  "23838";	projections[ 2411 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 50.2";
-projections[ 2412 ][ 0 ] =  "23839";	projections[ 2412 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 51.1";
-projections[ 2413 ][ 0 ] =  "23840";	projections[ 2413 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 51.2";
-projections[ 2414 ][ 0 ] =  "23841";	projections[ 2414 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 52.1";
-projections[ 2415 ][ 0 ] =  "23842";	projections[ 2415 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 52.2";
-projections[ 2416 ][ 0 ] =  "23843";	projections[ 2416 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 53.1";
-projections[ 2417 ][ 0 ] =  "23844";	projections[ 2417 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 53.2";
-projections[ 2418 ][ 0 ] =  "23845";	projections[ 2418 ][ 1 ] =  "DGN95 / Indonesia TM-3 zone 54.1";
-projections[ 2419 ][ 0 ] =  "23846";	projections[ 2419 ][ 1 ] =  "ID74 / UTM zone 46N";
-projections[ 2420 ][ 0 ] =  "23847";	projections[ 2420 ][ 1 ] =  "ID74 / UTM zone 47N";
-projections[ 2421 ][ 0 ] =  "23848";	projections[ 2421 ][ 1 ] =  "ID74 / UTM zone 48N";
-projections[ 2422 ][ 0 ] =  "23849";	projections[ 2422 ][ 1 ] =  "ID74 / UTM zone 49N";
-projections[ 2423 ][ 0 ] =  "23850";	projections[ 2423 ][ 1 ] =  "ID74 / UTM zone 50N";
-projections[ 2424 ][ 0 ] =  "23851";	projections[ 2424 ][ 1 ] =  "ID74 / UTM zone 51N";
-projections[ 2425 ][ 0 ] =  "23852";	projections[ 2425 ][ 1 ] =  "ID74 / UTM zone 52N";
-projections[ 2426 ][ 0 ] =  "23853";	projections[ 2426 ][ 1 ] =  "ID74 / UTM zone 53N";
-projections[ 2427 ][ 0 ] =  "23866";	projections[ 2427 ][ 1 ] =  "DGN95 / UTM zone 46N";
-projections[ 2428 ][ 0 ] =  "23867";	projections[ 2428 ][ 1 ] =  "DGN95 / UTM zone 47N";
-projections[ 2429 ][ 0 ] =  "23868";	projections[ 2429 ][ 1 ] =  "DGN95 / UTM zone 48N";
-projections[ 2430 ][ 0 ] =  "23869";	projections[ 2430 ][ 1 ] =  "DGN95 / UTM zone 49N";
-projections[ 2431 ][ 0 ] =  "23870";	projections[ 2431 ][ 1 ] =  "DGN95 / UTM zone 50N";
-projections[ 2432 ][ 0 ] =  "23871";	projections[ 2432 ][ 1 ] =  "DGN95 / UTM zone 51N";
-projections[ 2433 ][ 0 ] =  "23872";	projections[ 2433 ][ 1 ] =  "DGN95 / UTM zone 52N";
-projections[ 2434 ][ 0 ] =  "23877";	projections[ 2434 ][ 1 ] =  "DGN95 / UTM zone 47S";
-projections[ 2435 ][ 0 ] =  "23878";	projections[ 2435 ][ 1 ] =  "DGN95 / UTM zone 48S";
-projections[ 2436 ][ 0 ] =  "23879";	projections[ 2436 ][ 1 ] =  "DGN95 / UTM zone 49S";
-projections[ 2437 ][ 0 ] =  "23880";	projections[ 2437 ][ 1 ] =  "DGN95 / UTM zone 50S";
-projections[ 2438 ][ 0 ] =  "23881";	projections[ 2438 ][ 1 ] =  "DGN95 / UTM zone 51S";
-projections[ 2439 ][ 0 ] =  "23882";	projections[ 2439 ][ 1 ] =  "DGN95 / UTM zone 52S";
-projections[ 2440 ][ 0 ] =  "23883";	projections[ 2440 ][ 1 ] =  "DGN95 / UTM zone 53S";
-projections[ 2441 ][ 0 ] =  "23884";	projections[ 2441 ][ 1 ] =  "DGN95 / UTM zone 54S";
-projections[ 2442 ][ 0 ] =  "23886";	projections[ 2442 ][ 1 ] =  "ID74 / UTM zone 46S";
-projections[ 2443 ][ 0 ] =  "23887";	projections[ 2443 ][ 1 ] =  "ID74 / UTM zone 47S";
-projections[ 2444 ][ 0 ] =  "23888";	projections[ 2444 ][ 1 ] =  "ID74 / UTM zone 48S";
-projections[ 2445 ][ 0 ] =  "23889";	projections[ 2445 ][ 1 ] =  "ID74 / UTM zone 49S";
-projections[ 2446 ][ 0 ] =  "23890";	projections[ 2446 ][ 1 ] =  "ID74 / UTM zone 50S";
-projections[ 2447 ][ 0 ] =  "23891";	projections[ 2447 ][ 1 ] =  "ID74 / UTM zone 51S";
-projections[ 2448 ][ 0 ] =  "23892";	projections[ 2448 ][ 1 ] =  "ID74 / UTM zone 52S";
-projections[ 2449 ][ 0 ] =  "23893";	projections[ 2449 ][ 1 ] =  "ID74 / UTM zone 53S";
-projections[ 2450 ][ 0 ] =  "23894";	projections[ 2450 ][ 1 ] =  "ID74 / UTM zone 54S";
-projections[ 2451 ][ 0 ] =  "23946";	projections[ 2451 ][ 1 ] =  "Indian 1954 / UTM zone 46N";
-projections[ 2452 ][ 0 ] =  "23947";	projections[ 2452 ][ 1 ] =  "Indian 1954 / UTM zone 47N";
-projections[ 2453 ][ 0 ] =  "23948";	projections[ 2453 ][ 1 ] =  "Indian 1954 / UTM zone 48N";
-projections[ 2454 ][ 0 ] =  "24047";	projections[ 2454 ][ 1 ] =  "Indian 1975 / UTM zone 47N";
-projections[ 2455 ][ 0 ] =  "24048";	projections[ 2455 ][ 1 ] =  "Indian 1975 / UTM zone 48N";
-projections[ 2456 ][ 0 ] =  "24100";	projections[ 2456 ][ 1 ] =  "Jamaica 1875 / Jamaica (Old Grid)";
-projections[ 2457 ][ 0 ] =  "24200";	projections[ 2457 ][ 1 ] =  "JAD69 / Jamaica National Grid";
-projections[ 2458 ][ 0 ] =  "24305";	projections[ 2458 ][ 1 ] =  "Kalianpur 1937 / UTM zone 45N";
-projections[ 2459 ][ 0 ] =  "24306";	projections[ 2459 ][ 1 ] =  "Kalianpur 1937 / UTM zone 46N";
-projections[ 2460 ][ 0 ] =  "24311";	projections[ 2460 ][ 1 ] =  "Kalianpur 1962 / UTM zone 41N";
-projections[ 2461 ][ 0 ] =  "24312";	projections[ 2461 ][ 1 ] =  "Kalianpur 1962 / UTM zone 42N";
-projections[ 2462 ][ 0 ] =  "24313";	projections[ 2462 ][ 1 ] =  "Kalianpur 1962 / UTM zone 43N";
-projections[ 2463 ][ 0 ] =  "24342";	projections[ 2463 ][ 1 ] =  "Kalianpur 1975 / UTM zone 42N";
-projections[ 2464 ][ 0 ] =  "24343";	projections[ 2464 ][ 1 ] =  "Kalianpur 1975 / UTM zone 43N";
-projections[ 2465 ][ 0 ] =  "24344";	projections[ 2465 ][ 1 ] =  "Kalianpur 1975 / UTM zone 44N";
-projections[ 2466 ][ 0 ] =  "24345";	projections[ 2466 ][ 1 ] =  "Kalianpur 1975 / UTM zone 45N";
-projections[ 2467 ][ 0 ] =  "24346";	projections[ 2467 ][ 1 ] =  "Kalianpur 1975 / UTM zone 46N";
-projections[ 2468 ][ 0 ] =  "24347";	projections[ 2468 ][ 1 ] =  "Kalianpur 1975 / UTM zone 47N";
-projections[ 2469 ][ 0 ] =  "24370";	projections[ 2469 ][ 1 ] =  "Kalianpur 1880 / India zone 0";
-projections[ 2470 ][ 0 ] =  "24371";	projections[ 2470 ][ 1 ] =  "Kalianpur 1880 / India zone I";
-projections[ 2471 ][ 0 ] =  "24372";	projections[ 2471 ][ 1 ] =  "Kalianpur 1880 / India zone IIa";
-projections[ 2472 ][ 0 ] =  "24373";	projections[ 2472 ][ 1 ] =  "Kalianpur 1880 / India zone III";
-projections[ 2473 ][ 0 ] =  "24374";	projections[ 2473 ][ 1 ] =  "Kalianpur 1880 / India zone IV";
-projections[ 2474 ][ 0 ] =  "24375";	projections[ 2474 ][ 1 ] =  "Kalianpur 1937 / India zone IIb";
-projections[ 2475 ][ 0 ] =  "24376";	projections[ 2475 ][ 1 ] =  "Kalianpur 1962 / India zone I";
-projections[ 2476 ][ 0 ] =  "24377";	projections[ 2476 ][ 1 ] =  "Kalianpur 1962 / India zone IIa";
-projections[ 2477 ][ 0 ] =  "24378";	projections[ 2477 ][ 1 ] =  "Kalianpur 1975 / India zone I";
-projections[ 2478 ][ 0 ] =  "24379";	projections[ 2478 ][ 1 ] =  "Kalianpur 1975 / India zone IIa";
-projections[ 2479 ][ 0 ] =  "24380";	projections[ 2479 ][ 1 ] =  "Kalianpur 1975 / India zone IIb";
-projections[ 2480 ][ 0 ] =  "24381";	projections[ 2480 ][ 1 ] =  "Kalianpur 1975 / India zone III";
-projections[ 2481 ][ 0 ] =  "24382";	projections[ 2481 ][ 1 ] =  "Kalianpur 1880 / India zone IIb";
-projections[ 2482 ][ 0 ] =  "24383";	projections[ 2482 ][ 1 ] =  "Kalianpur 1975 / India zone IV";
-projections[ 2483 ][ 0 ] =  "24500";	projections[ 2483 ][ 1 ] =  "Kertau 1968 / Singapore Grid";
-projections[ 2484 ][ 0 ] =  "24547";	projections[ 2484 ][ 1 ] =  "Kertau 1968 / UTM zone 47N";
-projections[ 2485 ][ 0 ] =  "24548";	projections[ 2485 ][ 1 ] =  "Kertau 1968 / UTM zone 48N";
-projections[ 2486 ][ 0 ] =  "24571";	projections[ 2486 ][ 1 ] =  "Kertau / R.S.O. Malaya (ch)";
-projections[ 2487 ][ 0 ] =  "24600";	projections[ 2487 ][ 1 ] =  "KOC Lambert";
-projections[ 2488 ][ 0 ] =  "24718";	projections[ 2488 ][ 1 ] =  "La Canoa / UTM zone 18N";
-projections[ 2489 ][ 0 ] =  "24719";	projections[ 2489 ][ 1 ] =  "La Canoa / UTM zone 19N";
-projections[ 2490 ][ 0 ] =  "24720";	projections[ 2490 ][ 1 ] =  "La Canoa / UTM zone 20N";
-projections[ 2491 ][ 0 ] =  "24817";	projections[ 2491 ][ 1 ] =  "PSAD56 / UTM zone 17N";
-projections[ 2492 ][ 0 ] =  "24818";	projections[ 2492 ][ 1 ] =  "PSAD56 / UTM zone 18N";
-projections[ 2493 ][ 0 ] =  "24819";	projections[ 2493 ][ 1 ] =  "PSAD56 / UTM zone 19N";
-projections[ 2494 ][ 0 ] =  "24820";	projections[ 2494 ][ 1 ] =  "PSAD56 / UTM zone 20N";
-projections[ 2495 ][ 0 ] =  "24821";	projections[ 2495 ][ 1 ] =  "PSAD56 / UTM zone 21N";
-projections[ 2496 ][ 0 ] =  "24877";	projections[ 2496 ][ 1 ] =  "PSAD56 / UTM zone 17S";
-projections[ 2497 ][ 0 ] =  "24878";	projections[ 2497 ][ 1 ] =  "PSAD56 / UTM zone 18S";
-projections[ 2498 ][ 0 ] =  "24879";	projections[ 2498 ][ 1 ] =  "PSAD56 / UTM zone 19S";
-projections[ 2499 ][ 0 ] =  "24880";	projections[ 2499 ][ 1 ] =  "PSAD56 / UTM zone 20S";
-projections[ 2500 ][ 0 ] =  "24881";	projections[ 2500 ][ 1 ] =  "PSAD56 / UTM zone 21S";
-projections[ 2501 ][ 0 ] =  "24882";	projections[ 2501 ][ 1 ] =  "PSAD56 / UTM zone 22S";
-projections[ 2502 ][ 0 ] =  "24891";	projections[ 2502 ][ 1 ] =  "PSAD56 / Peru west zone";
-projections[ 2503 ][ 0 ] =  "24892";	projections[ 2503 ][ 1 ] =  "PSAD56 / Peru central zone";
-projections[ 2504 ][ 0 ] =  "24893";	projections[ 2504 ][ 1 ] =  "PSAD56 / Peru east zone";
-projections[ 2505 ][ 0 ] =  "25000";	projections[ 2505 ][ 1 ] =  "Leigon / Ghana Metre Grid";
-projections[ 2506 ][ 0 ] =  "25231";	projections[ 2506 ][ 1 ] =  "Lome / UTM zone 31N";
-projections[ 2507 ][ 0 ] =  "25391";	projections[ 2507 ][ 1 ] =  "Luzon 1911 / Philippines zone I";
-projections[ 2508 ][ 0 ] =  "25392";	projections[ 2508 ][ 1 ] =  "Luzon 1911 / Philippines zone II";
-projections[ 2509 ][ 0 ] =  "25393";	projections[ 2509 ][ 1 ] =  "Luzon 1911 / Philippines zone III";
-projections[ 2510 ][ 0 ] =  "25394";	projections[ 2510 ][ 1 ] =  "Luzon 1911 / Philippines zone IV";
-projections[ 2511 ][ 0 ] =  "25395";	projections[ 2511 ][ 1 ] =  "Luzon 1911 / Philippines zone V";
-projections[ 2512 ][ 0 ] =  "25700";	projections[ 2512 ][ 1 ] =  "Makassar (Jakarta) / NEIEZ";
-projections[ 2513 ][ 0 ] =  "25828";	projections[ 2513 ][ 1 ] =  "ETRS89 / UTM zone 28N";
-projections[ 2514 ][ 0 ] =  "25829";	projections[ 2514 ][ 1 ] =  "ETRS89 / UTM zone 29N";
-projections[ 2515 ][ 0 ] =  "25830";	projections[ 2515 ][ 1 ] =  "ETRS89 / UTM zone 30N";
-projections[ 2516 ][ 0 ] =  "25831";	projections[ 2516 ][ 1 ] =  "ETRS89 / UTM zone 31N";
-projections[ 2517 ][ 0 ] =  "25832";	projections[ 2517 ][ 1 ] =  "ETRS89 / UTM zone 32N";
-projections[ 2518 ][ 0 ] =  "25833";	projections[ 2518 ][ 1 ] =  "ETRS89 / UTM zone 33N";
-projections[ 2519 ][ 0 ] =  "25834";	projections[ 2519 ][ 1 ] =  "ETRS89 / UTM zone 34N";
-projections[ 2520 ][ 0 ] =  "25835";	projections[ 2520 ][ 1 ] =  "ETRS89 / UTM zone 35N";
-projections[ 2521 ][ 0 ] =  "25836";	projections[ 2521 ][ 1 ] =  "ETRS89 / UTM zone 36N";
-projections[ 2522 ][ 0 ] =  "25837";	projections[ 2522 ][ 1 ] =  "ETRS89 / UTM zone 37N";
-projections[ 2523 ][ 0 ] =  "25838";	projections[ 2523 ][ 1 ] =  "ETRS89 / UTM zone 38N";
-projections[ 2524 ][ 0 ] =  "25884";	projections[ 2524 ][ 1 ] =  "ETRS89 / TM Baltic93";
-projections[ 2525 ][ 0 ] =  "25932";	projections[ 2525 ][ 1 ] =  "Malongo 1987 / UTM zone 32S";
-projections[ 2526 ][ 0 ] =  "26191";	projections[ 2526 ][ 1 ] =  "Merchich / Nord Maroc";
-projections[ 2527 ][ 0 ] =  "26192";	projections[ 2527 ][ 1 ] =  "Merchich / Sud Maroc";
-projections[ 2528 ][ 0 ] =  "26193";	projections[ 2528 ][ 1 ] =  "Merchich / Sahara";
-projections[ 2529 ][ 0 ] =  "26194";	projections[ 2529 ][ 1 ] =  "Merchich / Sahara Nord";
-projections[ 2530 ][ 0 ] =  "26195";	projections[ 2530 ][ 1 ] =  "Merchich / Sahara Sud";
-projections[ 2531 ][ 0 ] =  "26237";	projections[ 2531 ][ 1 ] =  "Massawa / UTM zone 37N";
-projections[ 2532 ][ 0 ] =  "26331";	projections[ 2532 ][ 1 ] =  "Minna / UTM zone 31N";
-projections[ 2533 ][ 0 ] =  "26332";	projections[ 2533 ][ 1 ] =  "Minna / UTM zone 32N";
-projections[ 2534 ][ 0 ] =  "26391";	projections[ 2534 ][ 1 ] =  "Minna / Nigeria West Belt";
-projections[ 2535 ][ 0 ] =  "26392";	projections[ 2535 ][ 1 ] =  "Minna / Nigeria Mid Belt";
-projections[ 2536 ][ 0 ] =  "26393";	projections[ 2536 ][ 1 ] =  "Minna / Nigeria East Belt";
-projections[ 2537 ][ 0 ] =  "26432";	projections[ 2537 ][ 1 ] =  "Mhast / UTM zone 32S";
-projections[ 2538 ][ 0 ] =  "26591";	projections[ 2538 ][ 1 ] =  "Monte Mario (Rome) / Italy zone 1";
-projections[ 2539 ][ 0 ] =  "26592";	projections[ 2539 ][ 1 ] =  "Monte Mario (Rome) / Italy zone 2";
-projections[ 2540 ][ 0 ] =  "26632";	projections[ 2540 ][ 1 ] =  "M'poraloko / UTM zone 32N";
-projections[ 2541 ][ 0 ] =  "26692";	projections[ 2541 ][ 1 ] =  "M'poraloko / UTM zone 32S";
-projections[ 2542 ][ 0 ] =  "26701";	projections[ 2542 ][ 1 ] =  "NAD27 / UTM zone 1N";
-projections[ 2543 ][ 0 ] =  "26702";	projections[ 2543 ][ 1 ] =  "NAD27 / UTM zone 2N";
-projections[ 2544 ][ 0 ] =  "26703";	projections[ 2544 ][ 1 ] =  "NAD27 / UTM zone 3N";
-projections[ 2545 ][ 0 ] =  "26704";	projections[ 2545 ][ 1 ] =  "NAD27 / UTM zone 4N";
-projections[ 2546 ][ 0 ] =  "26705";	projections[ 2546 ][ 1 ] =  "NAD27 / UTM zone 5N";
-projections[ 2547 ][ 0 ] =  "26706";	projections[ 2547 ][ 1 ] =  "NAD27 / UTM zone 6N";
-projections[ 2548 ][ 0 ] =  "26707";	projections[ 2548 ][ 1 ] =  "NAD27 / UTM zone 7N";
-projections[ 2549 ][ 0 ] =  "26708";	projections[ 2549 ][ 1 ] =  "NAD27 / UTM zone 8N";
-projections[ 2550 ][ 0 ] =  "26709";	projections[ 2550 ][ 1 ] =  "NAD27 / UTM zone 9N";
-projections[ 2551 ][ 0 ] =  "26710";	projections[ 2551 ][ 1 ] =  "NAD27 / UTM zone 10N";
-projections[ 2552 ][ 0 ] =  "26711";	projections[ 2552 ][ 1 ] =  "NAD27 / UTM zone 11N";
-projections[ 2553 ][ 0 ] =  "26712";	projections[ 2553 ][ 1 ] =  "NAD27 / UTM zone 12N";
-projections[ 2554 ][ 0 ] =  "26713";	projections[ 2554 ][ 1 ] =  "NAD27 / UTM zone 13N";
-projections[ 2555 ][ 0 ] =  "26714";	projections[ 2555 ][ 1 ] =  "NAD27 / UTM zone 14N";
-projections[ 2556 ][ 0 ] =  "26715";	projections[ 2556 ][ 1 ] =  "NAD27 / UTM zone 15N";
-projections[ 2557 ][ 0 ] =  "26716";	projections[ 2557 ][ 1 ] =  "NAD27 / UTM zone 16N";
-projections[ 2558 ][ 0 ] =  "26717";	projections[ 2558 ][ 1 ] =  "NAD27 / UTM zone 17N";
-projections[ 2559 ][ 0 ] =  "26718";	projections[ 2559 ][ 1 ] =  "NAD27 / UTM zone 18N";
-projections[ 2560 ][ 0 ] =  "26719";	projections[ 2560 ][ 1 ] =  "NAD27 / UTM zone 19N";
-projections[ 2561 ][ 0 ] =  "26720";	projections[ 2561 ][ 1 ] =  "NAD27 / UTM zone 20N";
-projections[ 2562 ][ 0 ] =  "26721";	projections[ 2562 ][ 1 ] =  "NAD27 / UTM zone 21N";
-projections[ 2563 ][ 0 ] =  "26722";	projections[ 2563 ][ 1 ] =  "NAD27 / UTM zone 22N";
-projections[ 2564 ][ 0 ] =  "26729";	projections[ 2564 ][ 1 ] =  "NAD27 / Alabama East";
-projections[ 2565 ][ 0 ] =  "26730";	projections[ 2565 ][ 1 ] =  "NAD27 / Alabama West";
-projections[ 2566 ][ 0 ] =  "26731";	projections[ 2566 ][ 1 ] =  "NAD27 / Alaska zone 1";
-projections[ 2567 ][ 0 ] =  "26732";	projections[ 2567 ][ 1 ] =  "NAD27 / Alaska zone 2";
-projections[ 2568 ][ 0 ] =  "26733";	projections[ 2568 ][ 1 ] =  "NAD27 / Alaska zone 3";
-projections[ 2569 ][ 0 ] =  "26734";	projections[ 2569 ][ 1 ] =  "NAD27 / Alaska zone 4";
-projections[ 2570 ][ 0 ] =  "26735";	projections[ 2570 ][ 1 ] =  "NAD27 / Alaska zone 5";
-projections[ 2571 ][ 0 ] =  "26736";	projections[ 2571 ][ 1 ] =  "NAD27 / Alaska zone 6";
-projections[ 2572 ][ 0 ] =  "26737";	projections[ 2572 ][ 1 ] =  "NAD27 / Alaska zone 7";
-projections[ 2573 ][ 0 ] =  "26738";	projections[ 2573 ][ 1 ] =  "NAD27 / Alaska zone 8";
-projections[ 2574 ][ 0 ] =  "26739";	projections[ 2574 ][ 1 ] =  "NAD27 / Alaska zone 9";
-projections[ 2575 ][ 0 ] =  "26740";	projections[ 2575 ][ 1 ] =  "NAD27 / Alaska zone 10";
-projections[ 2576 ][ 0 ] =  "26741";	projections[ 2576 ][ 1 ] =  "NAD27 / California zone I";
-projections[ 2577 ][ 0 ] =  "26742";	projections[ 2577 ][ 1 ] =  "NAD27 / California zone II";
-projections[ 2578 ][ 0 ] =  "26743";	projections[ 2578 ][ 1 ] =  "NAD27 / California zone III";
-projections[ 2579 ][ 0 ] =  "26744";	projections[ 2579 ][ 1 ] =  "NAD27 / California zone IV";
-projections[ 2580 ][ 0 ] =  "26745";	projections[ 2580 ][ 1 ] =  "NAD27 / California zone V";
-projections[ 2581 ][ 0 ] =  "26746";	projections[ 2581 ][ 1 ] =  "NAD27 / California zone VI";
-projections[ 2582 ][ 0 ] =  "26747";	projections[ 2582 ][ 1 ] =  "NAD27 / California zone VII";
-projections[ 2583 ][ 0 ] =  "26748";	projections[ 2583 ][ 1 ] =  "NAD27 / Arizona East";
-projections[ 2584 ][ 0 ] =  "26749";	projections[ 2584 ][ 1 ] =  "NAD27 / Arizona Central";
-projections[ 2585 ][ 0 ] =  "26750";	projections[ 2585 ][ 1 ] =  "NAD27 / Arizona West";
-projections[ 2586 ][ 0 ] =  "26751";	projections[ 2586 ][ 1 ] =  "NAD27 / Arkansas North";
-projections[ 2587 ][ 0 ] =  "26752";	projections[ 2587 ][ 1 ] =  "NAD27 / Arkansas South";
-projections[ 2588 ][ 0 ] =  "26753";	projections[ 2588 ][ 1 ] =  "NAD27 / Colorado North";
-projections[ 2589 ][ 0 ] =  "26754";	projections[ 2589 ][ 1 ] =  "NAD27 / Colorado Central";
-projections[ 2590 ][ 0 ] =  "26755";	projections[ 2590 ][ 1 ] =  "NAD27 / Colorado South";
-projections[ 2591 ][ 0 ] =  "26756";	projections[ 2591 ][ 1 ] =  "NAD27 / Connecticut";
-projections[ 2592 ][ 0 ] =  "26757";	projections[ 2592 ][ 1 ] =  "NAD27 / Delaware";
-projections[ 2593 ][ 0 ] =  "26758";	projections[ 2593 ][ 1 ] =  "NAD27 / Florida East";
-projections[ 2594 ][ 0 ] =  "26759";	projections[ 2594 ][ 1 ] =  "NAD27 / Florida West";
-projections[ 2595 ][ 0 ] =  "26760";	projections[ 2595 ][ 1 ] =  "NAD27 / Florida North";
-projections[ 2596 ][ 0 ] =  "26766";	projections[ 2596 ][ 1 ] =  "NAD27 / Georgia East";
-projections[ 2597 ][ 0 ] =  "26767";	projections[ 2597 ][ 1 ] =  "NAD27 / Georgia West";
-projections[ 2598 ][ 0 ] =  "26768";	projections[ 2598 ][ 1 ] =  "NAD27 / Idaho East";
-projections[ 2599 ][ 0 ] =  "26769";	projections[ 2599 ][ 1 ] =  "NAD27 / Idaho Central";
-projections[ 2600 ][ 0 ] =  "26770";	projections[ 2600 ][ 1 ] =  "NAD27 / Idaho West";
-projections[ 2601 ][ 0 ] =  "26771";	projections[ 2601 ][ 1 ] =  "NAD27 / Illinois East";
-projections[ 2602 ][ 0 ] =  "26772";	projections[ 2602 ][ 1 ] =  "NAD27 / Illinois West";
-projections[ 2603 ][ 0 ] =  "26773";	projections[ 2603 ][ 1 ] =  "NAD27 / Indiana East";
-projections[ 2604 ][ 0 ] =  "26774";	projections[ 2604 ][ 1 ] =  "NAD27 / Indiana West";
-projections[ 2605 ][ 0 ] =  "26775";	projections[ 2605 ][ 1 ] =  "NAD27 / Iowa North";
-projections[ 2606 ][ 0 ] =  "26776";	projections[ 2606 ][ 1 ] =  "NAD27 / Iowa South";
-projections[ 2607 ][ 0 ] =  "26777";	projections[ 2607 ][ 1 ] =  "NAD27 / Kansas North";
-projections[ 2608 ][ 0 ] =  "26778";	projections[ 2608 ][ 1 ] =  "NAD27 / Kansas South";
-projections[ 2609 ][ 0 ] =  "26779";	projections[ 2609 ][ 1 ] =  "NAD27 / Kentucky North";
-projections[ 2610 ][ 0 ] =  "26780";	projections[ 2610 ][ 1 ] =  "NAD27 / Kentucky South";
-projections[ 2611 ][ 0 ] =  "26781";	projections[ 2611 ][ 1 ] =  "NAD27 / Louisiana North";
-projections[ 2612 ][ 0 ] =  "26782";	projections[ 2612 ][ 1 ] =  "NAD27 / Louisiana South";
-projections[ 2613 ][ 0 ] =  "26783";	projections[ 2613 ][ 1 ] =  "NAD27 / Maine East";
-projections[ 2614 ][ 0 ] =  "26784";	projections[ 2614 ][ 1 ] =  "NAD27 / Maine West";
-projections[ 2615 ][ 0 ] =  "26785";	projections[ 2615 ][ 1 ] =  "NAD27 / Maryland";
-projections[ 2616 ][ 0 ] =  "26786";	projections[ 2616 ][ 1 ] =  "NAD27 / Massachusetts Mainland";
-projections[ 2617 ][ 0 ] =  "26787";	projections[ 2617 ][ 1 ] =  "NAD27 / Massachusetts Island";
-projections[ 2618 ][ 0 ] =  "26791";	projections[ 2618 ][ 1 ] =  "NAD27 / Minnesota North";
-projections[ 2619 ][ 0 ] =  "26792";	projections[ 2619 ][ 1 ] =  "NAD27 / Minnesota Central";
-projections[ 2620 ][ 0 ] =  "26793";	projections[ 2620 ][ 1 ] =  "NAD27 / Minnesota South";
-projections[ 2621 ][ 0 ] =  "26794";	projections[ 2621 ][ 1 ] =  "NAD27 / Mississippi East";
-projections[ 2622 ][ 0 ] =  "26795";	projections[ 2622 ][ 1 ] =  "NAD27 / Mississippi West";
-projections[ 2623 ][ 0 ] =  "26796";	projections[ 2623 ][ 1 ] =  "NAD27 / Missouri East";
-projections[ 2624 ][ 0 ] =  "26797";	projections[ 2624 ][ 1 ] =  "NAD27 / Missouri Central";
-projections[ 2625 ][ 0 ] =  "26798";	projections[ 2625 ][ 1 ] =  "NAD27 / Missouri West";
-projections[ 2626 ][ 0 ] =  "26799";	projections[ 2626 ][ 1 ] =  "NAD27 / California zone VII";
-projections[ 2627 ][ 0 ] =  "26801";	projections[ 2627 ][ 1 ] =  "NAD Michigan / Michigan East";
-projections[ 2628 ][ 0 ] =  "26802";	projections[ 2628 ][ 1 ] =  "NAD Michigan / Michigan Old Central";
-projections[ 2629 ][ 0 ] =  "26803";	projections[ 2629 ][ 1 ] =  "NAD Michigan / Michigan West";
-projections[ 2630 ][ 0 ] =  "26811";	projections[ 2630 ][ 1 ] =  "NAD Michigan / Michigan North";
-projections[ 2631 ][ 0 ] =  "26812";	projections[ 2631 ][ 1 ] =  "NAD Michigan / Michigan Central";
-projections[ 2632 ][ 0 ] =  "26813";	projections[ 2632 ][ 1 ] =  "NAD Michigan / Michigan South";
-projections[ 2633 ][ 0 ] =  "26901";	projections[ 2633 ][ 1 ] =  "NAD83 / UTM zone 1N";
-projections[ 2634 ][ 0 ] =  "26902";	projections[ 2634 ][ 1 ] =  "NAD83 / UTM zone 2N";
-projections[ 2635 ][ 0 ] =  "26903";	projections[ 2635 ][ 1 ] =  "NAD83 / UTM zone 3N";
-projections[ 2636 ][ 0 ] =  "26904";	projections[ 2636 ][ 1 ] =  "NAD83 / UTM zone 4N";
-projections[ 2637 ][ 0 ] =  "26905";	projections[ 2637 ][ 1 ] =  "NAD83 / UTM zone 5N";
-projections[ 2638 ][ 0 ] =  "26906";	projections[ 2638 ][ 1 ] =  "NAD83 / UTM zone 6N";
-projections[ 2639 ][ 0 ] =  "26907";	projections[ 2639 ][ 1 ] =  "NAD83 / UTM zone 7N";
-projections[ 2640 ][ 0 ] =  "26908";	projections[ 2640 ][ 1 ] =  "NAD83 / UTM zone 8N";
-projections[ 2641 ][ 0 ] =  "26909";	projections[ 2641 ][ 1 ] =  "NAD83 / UTM zone 9N";
-projections[ 2642 ][ 0 ] =  "26910";	projections[ 2642 ][ 1 ] =  "NAD83 / UTM zone 10N";
-projections[ 2643 ][ 0 ] =  "26911";	projections[ 2643 ][ 1 ] =  "NAD83 / UTM zone 11N";
-projections[ 2644 ][ 0 ] =  "26912";	projections[ 2644 ][ 1 ] =  "NAD83 / UTM zone 12N";
-projections[ 2645 ][ 0 ] =  "26913";	projections[ 2645 ][ 1 ] =  "NAD83 / UTM zone 13N";
-projections[ 2646 ][ 0 ] =  "26914";	projections[ 2646 ][ 1 ] =  "NAD83 / UTM zone 14N";
-projections[ 2647 ][ 0 ] =  "26915";	projections[ 2647 ][ 1 ] =  "NAD83 / UTM zone 15N";
-projections[ 2648 ][ 0 ] =  "26916";	projections[ 2648 ][ 1 ] =  "NAD83 / UTM zone 16N";
-projections[ 2649 ][ 0 ] =  "26917";	projections[ 2649 ][ 1 ] =  "NAD83 / UTM zone 17N";
-projections[ 2650 ][ 0 ] =  "26918";	projections[ 2650 ][ 1 ] =  "NAD83 / UTM zone 18N";
-projections[ 2651 ][ 0 ] =  "26919";	projections[ 2651 ][ 1 ] =  "NAD83 / UTM zone 19N";
-projections[ 2652 ][ 0 ] =  "26920";	projections[ 2652 ][ 1 ] =  "NAD83 / UTM zone 20N";
-projections[ 2653 ][ 0 ] =  "26921";	projections[ 2653 ][ 1 ] =  "NAD83 / UTM zone 21N";
-projections[ 2654 ][ 0 ] =  "26922";	projections[ 2654 ][ 1 ] =  "NAD83 / UTM zone 22N";
-projections[ 2655 ][ 0 ] =  "26923";	projections[ 2655 ][ 1 ] =  "NAD83 / UTM zone 23N";
-projections[ 2656 ][ 0 ] =  "26929";	projections[ 2656 ][ 1 ] =  "NAD83 / Alabama East";
-projections[ 2657 ][ 0 ] =  "26930";	projections[ 2657 ][ 1 ] =  "NAD83 / Alabama West";
-projections[ 2658 ][ 0 ] =  "26931";	projections[ 2658 ][ 1 ] =  "NAD83 / Alaska zone 1";
-projections[ 2659 ][ 0 ] =  "26932";	projections[ 2659 ][ 1 ] =  "NAD83 / Alaska zone 2";
-projections[ 2660 ][ 0 ] =  "26933";	projections[ 2660 ][ 1 ] =  "NAD83 / Alaska zone 3";
-projections[ 2661 ][ 0 ] =  "26934";	projections[ 2661 ][ 1 ] =  "NAD83 / Alaska zone 4";
-projections[ 2662 ][ 0 ] =  "26935";	projections[ 2662 ][ 1 ] =  "NAD83 / Alaska zone 5";
-projections[ 2663 ][ 0 ] =  "26936";	projections[ 2663 ][ 1 ] =  "NAD83 / Alaska zone 6";
-projections[ 2664 ][ 0 ] =  "26937";	projections[ 2664 ][ 1 ] =  "NAD83 / Alaska zone 7";
-projections[ 2665 ][ 0 ] =  "26938";	projections[ 2665 ][ 1 ] =  "NAD83 / Alaska zone 8";
-projections[ 2666 ][ 0 ] =  "26939";	projections[ 2666 ][ 1 ] =  "NAD83 / Alaska zone 9";
-projections[ 2667 ][ 0 ] =  "26940";	projections[ 2667 ][ 1 ] =  "NAD83 / Alaska zone 10";
-projections[ 2668 ][ 0 ] =  "26941";	projections[ 2668 ][ 1 ] =  "NAD83 / California zone 1";
-projections[ 2669 ][ 0 ] =  "26942";	projections[ 2669 ][ 1 ] =  "NAD83 / California zone 2";
-projections[ 2670 ][ 0 ] =  "26943";	projections[ 2670 ][ 1 ] =  "NAD83 / California zone 3";
-projections[ 2671 ][ 0 ] =  "26944";	projections[ 2671 ][ 1 ] =  "NAD83 / California zone 4";
-projections[ 2672 ][ 0 ] =  "26945";	projections[ 2672 ][ 1 ] =  "NAD83 / California zone 5";
-projections[ 2673 ][ 0 ] =  "26946";	projections[ 2673 ][ 1 ] =  "NAD83 / California zone 6";
-projections[ 2674 ][ 0 ] =  "26948";	projections[ 2674 ][ 1 ] =  "NAD83 / Arizona East";
-projections[ 2675 ][ 0 ] =  "26949";	projections[ 2675 ][ 1 ] =  "NAD83 / Arizona Central";
-projections[ 2676 ][ 0 ] =  "26950";	projections[ 2676 ][ 1 ] =  "NAD83 / Arizona West";
-projections[ 2677 ][ 0 ] =  "26951";	projections[ 2677 ][ 1 ] =  "NAD83 / Arkansas North";
-projections[ 2678 ][ 0 ] =  "26952";	projections[ 2678 ][ 1 ] =  "NAD83 / Arkansas South";
-projections[ 2679 ][ 0 ] =  "26953";	projections[ 2679 ][ 1 ] =  "NAD83 / Colorado North";
-projections[ 2680 ][ 0 ] =  "26954";	projections[ 2680 ][ 1 ] =  "NAD83 / Colorado Central";
-projections[ 2681 ][ 0 ] =  "26955";	projections[ 2681 ][ 1 ] =  "NAD83 / Colorado South";
-projections[ 2682 ][ 0 ] =  "26956";	projections[ 2682 ][ 1 ] =  "NAD83 / Connecticut";
-projections[ 2683 ][ 0 ] =  "26957";	projections[ 2683 ][ 1 ] =  "NAD83 / Delaware";
-projections[ 2684 ][ 0 ] =  "26958";	projections[ 2684 ][ 1 ] =  "NAD83 / Florida East";
-projections[ 2685 ][ 0 ] =  "26959";	projections[ 2685 ][ 1 ] =  "NAD83 / Florida West";
-projections[ 2686 ][ 0 ] =  "26960";	projections[ 2686 ][ 1 ] =  "NAD83 / Florida North";
-projections[ 2687 ][ 0 ] =  "26961";	projections[ 2687 ][ 1 ] =  "NAD83 / Hawaii zone 1";
-projections[ 2688 ][ 0 ] =  "26962";	projections[ 2688 ][ 1 ] =  "NAD83 / Hawaii zone 2";
-projections[ 2689 ][ 0 ] =  "26963";	projections[ 2689 ][ 1 ] =  "NAD83 / Hawaii zone 3";
-projections[ 2690 ][ 0 ] =  "26964";	projections[ 2690 ][ 1 ] =  "NAD83 / Hawaii zone 4";
-projections[ 2691 ][ 0 ] =  "26965";	projections[ 2691 ][ 1 ] =  "NAD83 / Hawaii zone 5";
-projections[ 2692 ][ 0 ] =  "26966";	projections[ 2692 ][ 1 ] =  "NAD83 / Georgia East";
-projections[ 2693 ][ 0 ] =  "26967";	projections[ 2693 ][ 1 ] =  "NAD83 / Georgia West";
-projections[ 2694 ][ 0 ] =  "26968";	projections[ 2694 ][ 1 ] =  "NAD83 / Idaho East";
-projections[ 2695 ][ 0 ] =  "26969";	projections[ 2695 ][ 1 ] =  "NAD83 / Idaho Central";
-projections[ 2696 ][ 0 ] =  "26970";	projections[ 2696 ][ 1 ] =  "NAD83 / Idaho West";
-projections[ 2697 ][ 0 ] =  "26971";	projections[ 2697 ][ 1 ] =  "NAD83 / Illinois East";
-projections[ 2698 ][ 0 ] =  "26972";	projections[ 2698 ][ 1 ] =  "NAD83 / Illinois West";
-projections[ 2699 ][ 0 ] =  "26973";	projections[ 2699 ][ 1 ] =  "NAD83 / Indiana East";
-projections[ 2700 ][ 0 ] =  "26974";	projections[ 2700 ][ 1 ] =  "NAD83 / Indiana West";
-projections[ 2701 ][ 0 ] =  "26975";	projections[ 2701 ][ 1 ] =  "NAD83 / Iowa North";
-projections[ 2702 ][ 0 ] =  "26976";	projections[ 2702 ][ 1 ] =  "NAD83 / Iowa South";
-projections[ 2703 ][ 0 ] =  "26977";	projections[ 2703 ][ 1 ] =  "NAD83 / Kansas North";
-projections[ 2704 ][ 0 ] =  "26978";	projections[ 2704 ][ 1 ] =  "NAD83 / Kansas South";
-projections[ 2705 ][ 0 ] =  "26979";	projections[ 2705 ][ 1 ] =  "NAD83 / Kentucky North";
-projections[ 2706 ][ 0 ] =  "26980";	projections[ 2706 ][ 1 ] =  "NAD83 / Kentucky South";
-projections[ 2707 ][ 0 ] =  "26981";	projections[ 2707 ][ 1 ] =  "NAD83 / Louisiana North";
-projections[ 2708 ][ 0 ] =  "26982";	projections[ 2708 ][ 1 ] =  "NAD83 / Louisiana South";
-projections[ 2709 ][ 0 ] =  "26983";	projections[ 2709 ][ 1 ] =  "NAD83 / Maine East";
-projections[ 2710 ][ 0 ] =  "26984";	projections[ 2710 ][ 1 ] =  "NAD83 / Maine West";
-projections[ 2711 ][ 0 ] =  "26985";	projections[ 2711 ][ 1 ] =  "NAD83 / Maryland";
-projections[ 2712 ][ 0 ] =  "26986";	projections[ 2712 ][ 1 ] =  "NAD83 / Massachusetts Mainland";
-projections[ 2713 ][ 0 ] =  "26987";	projections[ 2713 ][ 1 ] =  "NAD83 / Massachusetts Island";
-projections[ 2714 ][ 0 ] =  "26988";	projections[ 2714 ][ 1 ] =  "NAD83 / Michigan North";
-projections[ 2715 ][ 0 ] =  "26989";	projections[ 2715 ][ 1 ] =  "NAD83 / Michigan Central";
-projections[ 2716 ][ 0 ] =  "26990";	projections[ 2716 ][ 1 ] =  "NAD83 / Michigan South";
-projections[ 2717 ][ 0 ] =  "26991";	projections[ 2717 ][ 1 ] =  "NAD83 / Minnesota North";
-projections[ 2718 ][ 0 ] =  "26992";	projections[ 2718 ][ 1 ] =  "NAD83 / Minnesota Central";
-projections[ 2719 ][ 0 ] =  "26993";	projections[ 2719 ][ 1 ] =  "NAD83 / Minnesota South";
-projections[ 2720 ][ 0 ] =  "26994";	projections[ 2720 ][ 1 ] =  "NAD83 / Mississippi East";
-projections[ 2721 ][ 0 ] =  "26995";	projections[ 2721 ][ 1 ] =  "NAD83 / Mississippi West";
-projections[ 2722 ][ 0 ] =  "26996";	projections[ 2722 ][ 1 ] =  "NAD83 / Missouri East";
-projections[ 2723 ][ 0 ] =  "26997";	projections[ 2723 ][ 1 ] =  "NAD83 / Missouri Central";
-projections[ 2724 ][ 0 ] =  "26998";	projections[ 2724 ][ 1 ] =  "NAD83 / Missouri West";
-projections[ 2725 ][ 0 ] =  "27037";	projections[ 2725 ][ 1 ] =  "Nahrwan 1967 / UTM zone 37N";
-projections[ 2726 ][ 0 ] =  "27038";	projections[ 2726 ][ 1 ] =  "Nahrwan 1967 / UTM zone 38N";
-projections[ 2727 ][ 0 ] =  "27039";	projections[ 2727 ][ 1 ] =  "Nahrwan 1967 / UTM zone 39N";
-projections[ 2728 ][ 0 ] =  "27040";	projections[ 2728 ][ 1 ] =  "Nahrwan 1967 / UTM zone 40N";
-projections[ 2729 ][ 0 ] =  "27120";	projections[ 2729 ][ 1 ] =  "Naparima 1972 / UTM zone 20N";
-projections[ 2730 ][ 0 ] =  "27200";	projections[ 2730 ][ 1 ] =  "NZGD49 / New Zealand Map Grid";
-projections[ 2731 ][ 0 ] =  "27205";	projections[ 2731 ][ 1 ] =  "NZGD49 / Mount Eden Circuit";
-projections[ 2732 ][ 0 ] =  "27206";	projections[ 2732 ][ 1 ] =  "NZGD49 / Bay of Plenty Circuit";
-projections[ 2733 ][ 0 ] =  "27207";	projections[ 2733 ][ 1 ] =  "NZGD49 / Poverty Bay Circuit";
-projections[ 2734 ][ 0 ] =  "27208";	projections[ 2734 ][ 1 ] =  "NZGD49 / Hawkes Bay Circuit";
-projections[ 2735 ][ 0 ] =  "27209";	projections[ 2735 ][ 1 ] =  "NZGD49 / Taranaki Circuit";
-projections[ 2736 ][ 0 ] =  "27210";	projections[ 2736 ][ 1 ] =  "NZGD49 / Tuhirangi Circuit";
-projections[ 2737 ][ 0 ] =  "27211";	projections[ 2737 ][ 1 ] =  "NZGD49 / Wanganui Circuit";
-projections[ 2738 ][ 0 ] =  "27212";	projections[ 2738 ][ 1 ] =  "NZGD49 / Wairarapa Circuit";
-projections[ 2739 ][ 0 ] =  "27213";	projections[ 2739 ][ 1 ] =  "NZGD49 / Wellington Circuit";
-projections[ 2740 ][ 0 ] =  "27214";	projections[ 2740 ][ 1 ] =  "NZGD49 / Collingwood Circuit";
-projections[ 2741 ][ 0 ] =  "27215";	projections[ 2741 ][ 1 ] =  "NZGD49 / Nelson Circuit";
-projections[ 2742 ][ 0 ] =  "27216";	projections[ 2742 ][ 1 ] =  "NZGD49 / Karamea Circuit";
-projections[ 2743 ][ 0 ] =  "27217";	projections[ 2743 ][ 1 ] =  "NZGD49 / Buller Circuit";
-projections[ 2744 ][ 0 ] =  "27218";	projections[ 2744 ][ 1 ] =  "NZGD49 / Grey Circuit";
-projections[ 2745 ][ 0 ] =  "27219";	projections[ 2745 ][ 1 ] =  "NZGD49 / Amuri Circuit";
-projections[ 2746 ][ 0 ] =  "27220";	projections[ 2746 ][ 1 ] =  "NZGD49 / Marlborough Circuit";
-projections[ 2747 ][ 0 ] =  "27221";	projections[ 2747 ][ 1 ] =  "NZGD49 / Hokitika Circuit";
-projections[ 2748 ][ 0 ] =  "27222";	projections[ 2748 ][ 1 ] =  "NZGD49 / Okarito Circuit";
-projections[ 2749 ][ 0 ] =  "27223";	projections[ 2749 ][ 1 ] =  "NZGD49 / Jacksons Bay Circuit";
-projections[ 2750 ][ 0 ] =  "27224";	projections[ 2750 ][ 1 ] =  "NZGD49 / Mount Pleasant Circuit";
-projections[ 2751 ][ 0 ] =  "27225";	projections[ 2751 ][ 1 ] =  "NZGD49 / Gawler Circuit";
-projections[ 2752 ][ 0 ] =  "27226";	projections[ 2752 ][ 1 ] =  "NZGD49 / Timaru Circuit";
-projections[ 2753 ][ 0 ] =  "27227";	projections[ 2753 ][ 1 ] =  "NZGD49 / Lindis Peak Circuit";
-projections[ 2754 ][ 0 ] =  "27228";	projections[ 2754 ][ 1 ] =  "NZGD49 / Mount Nicholas Circuit";
-projections[ 2755 ][ 0 ] =  "27229";	projections[ 2755 ][ 1 ] =  "NZGD49 / Mount York Circuit";
-projections[ 2756 ][ 0 ] =  "27230";	projections[ 2756 ][ 1 ] =  "NZGD49 / Observation Point Circuit";
-projections[ 2757 ][ 0 ] =  "27231";	projections[ 2757 ][ 1 ] =  "NZGD49 / North Taieri Circuit";
-projections[ 2758 ][ 0 ] =  "27232";	projections[ 2758 ][ 1 ] =  "NZGD49 / Bluff Circuit";
-projections[ 2759 ][ 0 ] =  "27258";	projections[ 2759 ][ 1 ] =  "NZGD49 / UTM zone 58S";
-projections[ 2760 ][ 0 ] =  "27259";	projections[ 2760 ][ 1 ] =  "NZGD49 / UTM zone 59S";
-projections[ 2761 ][ 0 ] =  "27260";	projections[ 2761 ][ 1 ] =  "NZGD49 / UTM zone 60S";
-projections[ 2762 ][ 0 ] =  "27291";	projections[ 2762 ][ 1 ] =  "NZGD49 / North Island Grid";
-projections[ 2763 ][ 0 ] =  "27292";	projections[ 2763 ][ 1 ] =  "NZGD49 / South Island Grid";
-projections[ 2764 ][ 0 ] =  "27391";	projections[ 2764 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone I";
-projections[ 2765 ][ 0 ] =  "27392";	projections[ 2765 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone II";
-projections[ 2766 ][ 0 ] =  "27393";	projections[ 2766 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone III";
-projections[ 2767 ][ 0 ] =  "27394";	projections[ 2767 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone IV";
-projections[ 2768 ][ 0 ] =  "27395";	projections[ 2768 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone V";
-projections[ 2769 ][ 0 ] =  "27396";	projections[ 2769 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone VI";
-projections[ 2770 ][ 0 ] =  "27397";	projections[ 2770 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone VII";
-projections[ 2771 ][ 0 ] =  "27398";	projections[ 2771 ][ 1 ] =  "NGO 1948 (Oslo) / NGO zone VIII";
-projections[ 2772 ][ 0 ] =  "27429";	projections[ 2772 ][ 1 ] =  "Datum 73 / UTM zone 29N";
-projections[ 2773 ][ 0 ] =  "27492";	projections[ 2773 ][ 1 ] =  "Datum 73 / Modified Portuguese Grid";
-projections[ 2774 ][ 0 ] =  "27500";	projections[ 2774 ][ 1 ] =  "ATF (Paris) / Nord de Guerre";
-projections[ 2775 ][ 0 ] =  "27561";	projections[ 2775 ][ 1 ] =  "NTF (Paris) / Lambert Nord France";
-projections[ 2776 ][ 0 ] =  "27562";	projections[ 2776 ][ 1 ] =  "NTF (Paris) / Lambert Centre France";
-projections[ 2777 ][ 0 ] =  "27563";	projections[ 2777 ][ 1 ] =  "NTF (Paris) / Lambert Sud France";
-projections[ 2778 ][ 0 ] =  "27564";	projections[ 2778 ][ 1 ] =  "NTF (Paris) / Lambert Corse";
-projections[ 2779 ][ 0 ] =  "27571";	projections[ 2779 ][ 1 ] =  "NTF (Paris) / Lambert zone I";
-projections[ 2780 ][ 0 ] =  "27572";	projections[ 2780 ][ 1 ] =  "NTF (Paris) / Lambert zone II";
-projections[ 2781 ][ 0 ] =  "27573";	projections[ 2781 ][ 1 ] =  "NTF (Paris) / Lambert zone III";
-projections[ 2782 ][ 0 ] =  "27574";	projections[ 2782 ][ 1 ] =  "NTF (Paris) / Lambert zone IV";
-projections[ 2783 ][ 0 ] =  "27581";	projections[ 2783 ][ 1 ] =  "NTF (Paris) / France I";
-projections[ 2784 ][ 0 ] =  "27582";	projections[ 2784 ][ 1 ] =  "NTF (Paris) / France II";
-projections[ 2785 ][ 0 ] =  "27583";	projections[ 2785 ][ 1 ] =  "NTF (Paris) / France III";
-projections[ 2786 ][ 0 ] =  "27584";	projections[ 2786 ][ 1 ] =  "NTF (Paris) / France IV";
-projections[ 2787 ][ 0 ] =  "27591";	projections[ 2787 ][ 1 ] =  "NTF (Paris) / Nord France";
-projections[ 2788 ][ 0 ] =  "27592";	projections[ 2788 ][ 1 ] =  "NTF (Paris) / Centre France";
-projections[ 2789 ][ 0 ] =  "27593";	projections[ 2789 ][ 1 ] =  "NTF (Paris) / Sud France";
-projections[ 2790 ][ 0 ] =  "27594";	projections[ 2790 ][ 1 ] =  "NTF (Paris) / Corse";
-projections[ 2791 ][ 0 ] =  "27700";	projections[ 2791 ][ 1 ] =  "OSGB 1936 / British National Grid";
-projections[ 2792 ][ 0 ] =  "28191";	projections[ 2792 ][ 1 ] =  "Palestine 1923 / Palestine Grid";
-projections[ 2793 ][ 0 ] =  "28192";	projections[ 2793 ][ 1 ] =  "Palestine 1923 / Palestine Belt";
-projections[ 2794 ][ 0 ] =  "28193";	projections[ 2794 ][ 1 ] =  "Palestine 1923 / Israeli CS Grid";
-projections[ 2795 ][ 0 ] =  "28232";	projections[ 2795 ][ 1 ] =  "Pointe Noire / UTM zone 32S";
-projections[ 2796 ][ 0 ] =  "28348";	projections[ 2796 ][ 1 ] =  "GDA94 / MGA zone 48";
-projections[ 2797 ][ 0 ] =  "28349";	projections[ 2797 ][ 1 ] =  "GDA94 / MGA zone 49";
-projections[ 2798 ][ 0 ] =  "28350";	projections[ 2798 ][ 1 ] =  "GDA94 / MGA zone 50";
-projections[ 2799 ][ 0 ] =  "28351";	projections[ 2799 ][ 1 ] =  "GDA94 / MGA zone 51";
-projections[ 2800 ][ 0 ] =  "28352";	projections[ 2800 ][ 1 ] =  "GDA94 / MGA zone 52";
-projections[ 2801 ][ 0 ] =  "28353";	projections[ 2801 ][ 1 ] =  "GDA94 / MGA zone 53";
-projections[ 2802 ][ 0 ] =  "28354";	projections[ 2802 ][ 1 ] =  "GDA94 / MGA zone 54";
-projections[ 2803 ][ 0 ] =  "28355";	projections[ 2803 ][ 1 ] =  "GDA94 / MGA zone 55";
-projections[ 2804 ][ 0 ] =  "28356";	projections[ 2804 ][ 1 ] =  "GDA94 / MGA zone 56";
-projections[ 2805 ][ 0 ] =  "28357";	projections[ 2805 ][ 1 ] =  "GDA94 / MGA zone 57";
-projections[ 2806 ][ 0 ] =  "28358";	projections[ 2806 ][ 1 ] =  "GDA94 / MGA zone 58";
-projections[ 2807 ][ 0 ] =  "28402";	projections[ 2807 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 2";
-projections[ 2808 ][ 0 ] =  "28403";	projections[ 2808 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 3";
-projections[ 2809 ][ 0 ] =  "28404";	projections[ 2809 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 4";
-projections[ 2810 ][ 0 ] =  "28405";	projections[ 2810 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 5";
-projections[ 2811 ][ 0 ] =  "28406";	projections[ 2811 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 6";
-projections[ 2812 ][ 0 ] =  "28407";	projections[ 2812 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 7";
-projections[ 2813 ][ 0 ] =  "28408";	projections[ 2813 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 8";
-projections[ 2814 ][ 0 ] =  "28409";	projections[ 2814 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 9";
-projections[ 2815 ][ 0 ] =  "28410";	projections[ 2815 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 10";
-projections[ 2816 ][ 0 ] =  "28411";	projections[ 2816 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 11";
-projections[ 2817 ][ 0 ] =  "28412";	projections[ 2817 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 12";
-projections[ 2818 ][ 0 ] =  "28413";	projections[ 2818 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 13";
-projections[ 2819 ][ 0 ] =  "28414";	projections[ 2819 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 14";
-projections[ 2820 ][ 0 ] =  "28415";	projections[ 2820 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 15";
-projections[ 2821 ][ 0 ] =  "28416";	projections[ 2821 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 16";
-projections[ 2822 ][ 0 ] =  "28417";	projections[ 2822 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 17";
-projections[ 2823 ][ 0 ] =  "28418";	projections[ 2823 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 18";
-projections[ 2824 ][ 0 ] =  "28419";	projections[ 2824 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 19";
-projections[ 2825 ][ 0 ] =  "28420";	projections[ 2825 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 20";
-projections[ 2826 ][ 0 ] =  "28421";	projections[ 2826 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 21";
-projections[ 2827 ][ 0 ] =  "28422";	projections[ 2827 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 22";
-projections[ 2828 ][ 0 ] =  "28423";	projections[ 2828 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 23";
-projections[ 2829 ][ 0 ] =  "28424";	projections[ 2829 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 24";
-projections[ 2830 ][ 0 ] =  "28425";	projections[ 2830 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 25";
-projections[ 2831 ][ 0 ] =  "28426";	projections[ 2831 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 26";
-projections[ 2832 ][ 0 ] =  "28427";	projections[ 2832 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 27";
-projections[ 2833 ][ 0 ] =  "28428";	projections[ 2833 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 28";
-projections[ 2834 ][ 0 ] =  "28429";	projections[ 2834 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 29";
-projections[ 2835 ][ 0 ] =  "28430";	projections[ 2835 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 30";
-projections[ 2836 ][ 0 ] =  "28431";	projections[ 2836 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 31";
-projections[ 2837 ][ 0 ] =  "28432";	projections[ 2837 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger zone 32";
-projections[ 2838 ][ 0 ] =  "28462";	projections[ 2838 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 2N";
-projections[ 2839 ][ 0 ] =  "28463";	projections[ 2839 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 3N";
-projections[ 2840 ][ 0 ] =  "28464";	projections[ 2840 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 4N";
-projections[ 2841 ][ 0 ] =  "28465";	projections[ 2841 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 5N";
-projections[ 2842 ][ 0 ] =  "28466";	projections[ 2842 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 6N";
-projections[ 2843 ][ 0 ] =  "28467";	projections[ 2843 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 7N";
-projections[ 2844 ][ 0 ] =  "28468";	projections[ 2844 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 8N";
-projections[ 2845 ][ 0 ] =  "28469";	projections[ 2845 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 9N";
-projections[ 2846 ][ 0 ] =  "28470";	projections[ 2846 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 10N";
-projections[ 2847 ][ 0 ] =  "28471";	projections[ 2847 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 11N";
-projections[ 2848 ][ 0 ] =  "28472";	projections[ 2848 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 12N";
-projections[ 2849 ][ 0 ] =  "28473";	projections[ 2849 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 13N";
-projections[ 2850 ][ 0 ] =  "28474";	projections[ 2850 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 14N";
-projections[ 2851 ][ 0 ] =  "28475";	projections[ 2851 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 15N";
-projections[ 2852 ][ 0 ] =  "28476";	projections[ 2852 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 16N";
-projections[ 2853 ][ 0 ] =  "28477";	projections[ 2853 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 17N";
-projections[ 2854 ][ 0 ] =  "28478";	projections[ 2854 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 18N";
-projections[ 2855 ][ 0 ] =  "28479";	projections[ 2855 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 19N";
-projections[ 2856 ][ 0 ] =  "28480";	projections[ 2856 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 20N";
-projections[ 2857 ][ 0 ] =  "28481";	projections[ 2857 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 21N";
-projections[ 2858 ][ 0 ] =  "28482";	projections[ 2858 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 22N";
-projections[ 2859 ][ 0 ] =  "28483";	projections[ 2859 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 23N";
-projections[ 2860 ][ 0 ] =  "28484";	projections[ 2860 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 24N";
-projections[ 2861 ][ 0 ] =  "28485";	projections[ 2861 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 25N";
-projections[ 2862 ][ 0 ] =  "28486";	projections[ 2862 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 26N";
-projections[ 2863 ][ 0 ] =  "28487";	projections[ 2863 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 27N";
-projections[ 2864 ][ 0 ] =  "28488";	projections[ 2864 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 28N";
-projections[ 2865 ][ 0 ] =  "28489";	projections[ 2865 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 29N";
-projections[ 2866 ][ 0 ] =  "28490";	projections[ 2866 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 30N";
-projections[ 2867 ][ 0 ] =  "28491";	projections[ 2867 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 31N";
-projections[ 2868 ][ 0 ] =  "28492";	projections[ 2868 ][ 1 ] =  "Pulkovo 1942 / Gauss-Kruger 32N";
-projections[ 2869 ][ 0 ] =  "28600";	projections[ 2869 ][ 1 ] =  "Qatar 1974 / Qatar National Grid";
-projections[ 2870 ][ 0 ] =  "28991";	projections[ 2870 ][ 1 ] =  "Amersfoort / RD Old";
-projections[ 2871 ][ 0 ] =  "28992";	projections[ 2871 ][ 1 ] =  "Amersfoort / RD New";
-projections[ 2872 ][ 0 ] =  "29100";	projections[ 2872 ][ 1 ] =  "SAD69 / Brazil Polyconic";
-projections[ 2873 ][ 0 ] =  "29101";	projections[ 2873 ][ 1 ] =  "SAD69 / Brazil Polyconic";
-projections[ 2874 ][ 0 ] =  "29118";	projections[ 2874 ][ 1 ] =  "SAD69 / UTM zone 18N";
-projections[ 2875 ][ 0 ] =  "29119";	projections[ 2875 ][ 1 ] =  "SAD69 / UTM zone 19N";
-projections[ 2876 ][ 0 ] =  "29120";	projections[ 2876 ][ 1 ] =  "SAD69 / UTM zone 20N";
-projections[ 2877 ][ 0 ] =  "29121";	projections[ 2877 ][ 1 ] =  "SAD69 / UTM zone 21N";
-projections[ 2878 ][ 0 ] =  "29122";	projections[ 2878 ][ 1 ] =  "SAD69 / UTM zone 22N";
-projections[ 2879 ][ 0 ] =  "29168";	projections[ 2879 ][ 1 ] =  "SAD69 / UTM zone 18N";
-projections[ 2880 ][ 0 ] =  "29169";	projections[ 2880 ][ 1 ] =  "SAD69 / UTM zone 19N";
-projections[ 2881 ][ 0 ] =  "29170";	projections[ 2881 ][ 1 ] =  "SAD69 / UTM zone 20N";
-projections[ 2882 ][ 0 ] =  "29171";	projections[ 2882 ][ 1 ] =  "SAD69 / UTM zone 21N";
-projections[ 2883 ][ 0 ] =  "29172";	projections[ 2883 ][ 1 ] =  "SAD69 / UTM zone 22N";
-projections[ 2884 ][ 0 ] =  "29177";	projections[ 2884 ][ 1 ] =  "SAD69 / UTM zone 17S";
-projections[ 2885 ][ 0 ] =  "29178";	projections[ 2885 ][ 1 ] =  "SAD69 / UTM zone 18S";
-projections[ 2886 ][ 0 ] =  "29179";	projections[ 2886 ][ 1 ] =  "SAD69 / UTM zone 19S";
-projections[ 2887 ][ 0 ] =  "29180";	projections[ 2887 ][ 1 ] =  "SAD69 / UTM zone 20S";
-projections[ 2888 ][ 0 ] =  "29181";	projections[ 2888 ][ 1 ] =  "SAD69 / UTM zone 21S";
-projections[ 2889 ][ 0 ] =  "29182";	projections[ 2889 ][ 1 ] =  "SAD69 / UTM zone 22S";
-projections[ 2890 ][ 0 ] =  "29183";	projections[ 2890 ][ 1 ] =  "SAD69 / UTM zone 23S";
-projections[ 2891 ][ 0 ] =  "29184";	projections[ 2891 ][ 1 ] =  "SAD69 / UTM zone 24S";
-projections[ 2892 ][ 0 ] =  "29185";	projections[ 2892 ][ 1 ] =  "SAD69 / UTM zone 25S";
-projections[ 2893 ][ 0 ] =  "29187";	projections[ 2893 ][ 1 ] =  "SAD69 / UTM zone 17S";
-projections[ 2894 ][ 0 ] =  "29188";	projections[ 2894 ][ 1 ] =  "SAD69 / UTM zone 18S";
-projections[ 2895 ][ 0 ] =  "29189";	projections[ 2895 ][ 1 ] =  "SAD69 / UTM zone 19S";
-projections[ 2896 ][ 0 ] =  "29190";	projections[ 2896 ][ 1 ] =  "SAD69 / UTM zone 20S";
-projections[ 2897 ][ 0 ] =  "29191";	projections[ 2897 ][ 1 ] =  "SAD69 / UTM zone 21S";
-projections[ 2898 ][ 0 ] =  "29192";	projections[ 2898 ][ 1 ] =  "SAD69 / UTM zone 22S";
-projections[ 2899 ][ 0 ] =  "29193";	projections[ 2899 ][ 1 ] =  "SAD69 / UTM zone 23S";
-projections[ 2900 ][ 0 ] =  "29194";	projections[ 2900 ][ 1 ] =  "SAD69 / UTM zone 24S";
-projections[ 2901 ][ 0 ] =  "29195";	projections[ 2901 ][ 1 ] =  "SAD69 / UTM zone 25S";
-projections[ 2902 ][ 0 ] =  "29220";	projections[ 2902 ][ 1 ] =  "Sapper Hill 1943 / UTM zone 20S";
-projections[ 2903 ][ 0 ] =  "29221";	projections[ 2903 ][ 1 ] =  "Sapper Hill 1943 / UTM zone 21S";
-projections[ 2904 ][ 0 ] =  "29333";	projections[ 2904 ][ 1 ] =  "Schwarzeck / UTM zone 33S";
-projections[ 2905 ][ 0 ] =  "29371";	projections[ 2905 ][ 1 ] =  "Schwarzeck / Lo22/11";
-projections[ 2906 ][ 0 ] =  "29373";	projections[ 2906 ][ 1 ] =  "Schwarzeck / Lo22/13";
-projections[ 2907 ][ 0 ] =  "29375";	projections[ 2907 ][ 1 ] =  "Schwarzeck / Lo22/15";
-projections[ 2908 ][ 0 ] =  "29377";	projections[ 2908 ][ 1 ] =  "Schwarzeck / Lo22/17";
-projections[ 2909 ][ 0 ] =  "29379";	projections[ 2909 ][ 1 ] =  "Schwarzeck / Lo22/19";
-projections[ 2910 ][ 0 ] =  "29381";	projections[ 2910 ][ 1 ] =  "Schwarzeck / Lo22/21";
-projections[ 2911 ][ 0 ] =  "29383";	projections[ 2911 ][ 1 ] =  "Schwarzeck / Lo22/23";
-projections[ 2912 ][ 0 ] =  "29385";	projections[ 2912 ][ 1 ] =  "Schwarzeck / Lo22/25";
-projections[ 2913 ][ 0 ] =  "29635";	projections[ 2913 ][ 1 ] =  "Sudan / UTM zone 35N";
-projections[ 2914 ][ 0 ] =  "29636";	projections[ 2914 ][ 1 ] =  "Sudan / UTM zone 36N";
-projections[ 2915 ][ 0 ] =  "29700";	projections[ 2915 ][ 1 ] =  "Tananarive (Paris) / Laborde Grid";
-projections[ 2916 ][ 0 ] =  "29701";	projections[ 2916 ][ 1 ] =  "Tananarive (Paris) / Laborde Grid";
-projections[ 2917 ][ 0 ] =  "29702";	projections[ 2917 ][ 1 ] =  "Tananarive (Paris) / Laborde Grid approximation";
-projections[ 2918 ][ 0 ] =  "29738";	projections[ 2918 ][ 1 ] =  "Tananarive / UTM zone 38S";
-projections[ 2919 ][ 0 ] =  "29739";	projections[ 2919 ][ 1 ] =  "Tananarive / UTM zone 39S";
-projections[ 2920 ][ 0 ] =  "29849";	projections[ 2920 ][ 1 ] =  "Timbalai 1948 / UTM zone 49N";
-projections[ 2921 ][ 0 ] =  "29850";	projections[ 2921 ][ 1 ] =  "Timbalai 1948 / UTM zone 50N";
-projections[ 2922 ][ 0 ] =  "29871";	projections[ 2922 ][ 1 ] =  "Timbalai 1948 / RSO Borneo (ch)";
-projections[ 2923 ][ 0 ] =  "29872";	projections[ 2923 ][ 1 ] =  "Timbalai 1948 / RSO Borneo (ft)";
-projections[ 2924 ][ 0 ] =  "29873";	projections[ 2924 ][ 1 ] =  "Timbalai 1948 / RSO Borneo (m)";
-projections[ 2925 ][ 0 ] =  "29900";	projections[ 2925 ][ 1 ] =  "TM65 / Irish National Grid";
-projections[ 2926 ][ 0 ] =  "29901";	projections[ 2926 ][ 1 ] =  "OSNI 1952 / Irish National Grid";
-projections[ 2927 ][ 0 ] =  "29902";	projections[ 2927 ][ 1 ] =  "TM65 / Irish Grid";
-projections[ 2928 ][ 0 ] =  "29903";	projections[ 2928 ][ 1 ] =  "TM75 / Irish Grid";
-projections[ 2929 ][ 0 ] =  "30161";	projections[ 2929 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS I";
-projections[ 2930 ][ 0 ] =  "30162";	projections[ 2930 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS II";
-projections[ 2931 ][ 0 ] =  "30163";	projections[ 2931 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS III";
-projections[ 2932 ][ 0 ] =  "30164";	projections[ 2932 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS IV";
-projections[ 2933 ][ 0 ] =  "30165";	projections[ 2933 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS V";
-projections[ 2934 ][ 0 ] =  "30166";	projections[ 2934 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS VI";
-projections[ 2935 ][ 0 ] =  "30167";	projections[ 2935 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS VII";
-projections[ 2936 ][ 0 ] =  "30168";	projections[ 2936 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS VIII";
-projections[ 2937 ][ 0 ] =  "30169";	projections[ 2937 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS IX";
-projections[ 2938 ][ 0 ] =  "30170";	projections[ 2938 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS X";
-projections[ 2939 ][ 0 ] =  "30171";	projections[ 2939 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XI";
-projections[ 2940 ][ 0 ] =  "30172";	projections[ 2940 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XII";
-projections[ 2941 ][ 0 ] =  "30173";	projections[ 2941 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XIII";
-projections[ 2942 ][ 0 ] =  "30174";	projections[ 2942 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XIV";
-projections[ 2943 ][ 0 ] =  "30175";	projections[ 2943 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XV";
-projections[ 2944 ][ 0 ] =  "30176";	projections[ 2944 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XVI";
-projections[ 2945 ][ 0 ] =  "30177";	projections[ 2945 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XVII";
-projections[ 2946 ][ 0 ] =  "30178";	projections[ 2946 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XVIII";
-projections[ 2947 ][ 0 ] =  "30179";	projections[ 2947 ][ 1 ] =  "Tokyo / Japan Plane Rectangular CS XIX";
-projections[ 2948 ][ 0 ] =  "30200";	projections[ 2948 ][ 1 ] =  "Trinidad 1903 / Trinidad Grid";
-projections[ 2949 ][ 0 ] =  "30339";	projections[ 2949 ][ 1 ] =  "TC(1948) / UTM zone 39N";
-projections[ 2950 ][ 0 ] =  "30340";	projections[ 2950 ][ 1 ] =  "TC(1948) / UTM zone 40N";
-projections[ 2951 ][ 0 ] =  "30491";	projections[ 2951 ][ 1 ] =  "Voirol 1875 / Nord Algerie (ancienne)";
-projections[ 2952 ][ 0 ] =  "30492";	projections[ 2952 ][ 1 ] =  "Voirol 1875 / Sud Algerie (ancienne)";
-projections[ 2953 ][ 0 ] =  "30493";	projections[ 2953 ][ 1 ] =  "Voirol 1879 / Nord Algerie (ancienne)";
-projections[ 2954 ][ 0 ] =  "30494";	projections[ 2954 ][ 1 ] =  "Voirol 1879 / Sud Algerie (ancienne)";
-projections[ 2955 ][ 0 ] =  "30729";	projections[ 2955 ][ 1 ] =  "Nord Sahara 1959 / UTM zone 29N";
-projections[ 2956 ][ 0 ] =  "30730";	projections[ 2956 ][ 1 ] =  "Nord Sahara 1959 / UTM zone 30N";
-projections[ 2957 ][ 0 ] =  "30731";	projections[ 2957 ][ 1 ] =  "Nord Sahara 1959 / UTM zone 31N";
-projections[ 2958 ][ 0 ] =  "30732";	projections[ 2958 ][ 1 ] =  "Nord Sahara 1959 / UTM zone 32N";
-projections[ 2959 ][ 0 ] =  "30791";	projections[ 2959 ][ 1 ] =  "Nord Sahara 1959 / Voirol Unifie Nord";
-projections[ 2960 ][ 0 ] =  "30792";	projections[ 2960 ][ 1 ] =  "Nord Sahara 1959 / Voirol Unifie Sud";
-projections[ 2961 ][ 0 ] =  "30800";	projections[ 2961 ][ 1 ] =  "RT38 2.5 gon W";
-projections[ 2962 ][ 0 ] =  "31028";	projections[ 2962 ][ 1 ] =  "Yoff / UTM zone 28N";
-projections[ 2963 ][ 0 ] =  "31121";	projections[ 2963 ][ 1 ] =  "Zanderij / UTM zone 21N";
-projections[ 2964 ][ 0 ] =  "31154";	projections[ 2964 ][ 1 ] =  "Zanderij / TM 54 NW";
-projections[ 2965 ][ 0 ] =  "31170";	projections[ 2965 ][ 1 ] =  "Zanderij / Suriname Old TM";
-projections[ 2966 ][ 0 ] =  "31171";	projections[ 2966 ][ 1 ] =  "Zanderij / Suriname TM";
-projections[ 2967 ][ 0 ] =  "31251";	projections[ 2967 ][ 1 ] =  "MGI (Ferro) / Austria GK West Zone";
-projections[ 2968 ][ 0 ] =  "31252";	projections[ 2968 ][ 1 ] =  "MGI (Ferro) / Austria GK Central Zone";
-projections[ 2969 ][ 0 ] =  "31253";	projections[ 2969 ][ 1 ] =  "MGI (Ferro) / Austria GK East Zone";
-projections[ 2970 ][ 0 ] =  "31254";	projections[ 2970 ][ 1 ] =  "MGI / Austria GK West";
-projections[ 2971 ][ 0 ] =  "31255";	projections[ 2971 ][ 1 ] =  "MGI / Austria GK Central";
-projections[ 2972 ][ 0 ] =  "31256";	projections[ 2972 ][ 1 ] =  "MGI / Austria GK East";
-projections[ 2973 ][ 0 ] =  "31257";	projections[ 2973 ][ 1 ] =  "MGI / Austria GK M28";
-projections[ 2974 ][ 0 ] =  "31258";	projections[ 2974 ][ 1 ] =  "MGI / Austria GK M31";
-projections[ 2975 ][ 0 ] =  "31259";	projections[ 2975 ][ 1 ] =  "MGI / Austria GK M34";
-projections[ 2976 ][ 0 ] =  "31265";	projections[ 2976 ][ 1 ] =  "MGI / 3-degree Gauss zone 5";
-projections[ 2977 ][ 0 ] =  "31266";	projections[ 2977 ][ 1 ] =  "MGI / 3-degree Gauss zone 6";
-projections[ 2978 ][ 0 ] =  "31267";	projections[ 2978 ][ 1 ] =  "MGI / 3-degree Gauss zone 7";
-projections[ 2979 ][ 0 ] =  "31268";	projections[ 2979 ][ 1 ] =  "MGI / 3-degree Gauss zone 8";
-projections[ 2980 ][ 0 ] =  "31275";	projections[ 2980 ][ 1 ] =  "MGI / Balkans zone 5";
-projections[ 2981 ][ 0 ] =  "31276";	projections[ 2981 ][ 1 ] =  "MGI / Balkans zone 6";
-projections[ 2982 ][ 0 ] =  "31277";	projections[ 2982 ][ 1 ] =  "MGI / Balkans zone 7";
-projections[ 2983 ][ 0 ] =  "31278";	projections[ 2983 ][ 1 ] =  "MGI / Balkans zone 8";
-projections[ 2984 ][ 0 ] =  "31279";	projections[ 2984 ][ 1 ] =  "MGI / Balkans zone 8";
-projections[ 2985 ][ 0 ] =  "31281";	projections[ 2985 ][ 1 ] =  "MGI (Ferro) / Austria West Zone";
-projections[ 2986 ][ 0 ] =  "31282";	projections[ 2986 ][ 1 ] =  "MGI (Ferro) / Austria Central Zone";
-projections[ 2987 ][ 0 ] =  "31283";	projections[ 2987 ][ 1 ] =  "MGI (Ferro) / Austria East Zone";
-projections[ 2988 ][ 0 ] =  "31284";	projections[ 2988 ][ 1 ] =  "MGI / Austria M28";
-projections[ 2989 ][ 0 ] =  "31285";	projections[ 2989 ][ 1 ] =  "MGI / Austria M31";
-projections[ 2990 ][ 0 ] =  "31286";	projections[ 2990 ][ 1 ] =  "MGI / Austria M34";
-projections[ 2991 ][ 0 ] =  "31287";	projections[ 2991 ][ 1 ] =  "MGI / Austria Lambert";
-projections[ 2992 ][ 0 ] =  "31288";	projections[ 2992 ][ 1 ] =  "MGI (Ferro) / M28";
-projections[ 2993 ][ 0 ] =  "31289";	projections[ 2993 ][ 1 ] =  "MGI (Ferro) / M31";
-projections[ 2994 ][ 0 ] =  "31290";	projections[ 2994 ][ 1 ] =  "MGI (Ferro) / M34";
-projections[ 2995 ][ 0 ] =  "31291";	projections[ 2995 ][ 1 ] =  "MGI (Ferro) / Austria West Zone";
-projections[ 2996 ][ 0 ] =  "31292";	projections[ 2996 ][ 1 ] =  "MGI (Ferro) / Austria Central Zone";
-projections[ 2997 ][ 0 ] =  "31293";	projections[ 2997 ][ 1 ] =  "MGI (Ferro) / Austria East Zone";
-projections[ 2998 ][ 0 ] =  "31294";	projections[ 2998 ][ 1 ] =  "MGI / M28";
-projections[ 2999 ][ 0 ] =  "31295";	projections[ 2999 ][ 1 ] =  "MGI / M31";
-projections[ 3000 ][ 0 ] =  "31296";	projections[ 3000 ][ 1 ] =  "MGI / M34";
-projections[ 3001 ][ 0 ] =  "31297";	projections[ 3001 ][ 1 ] =  "MGI / Austria Lambert";
-projections[ 3002 ][ 0 ] =  "31300";	projections[ 3002 ][ 1 ] =  "Belge 1972 / Belge Lambert 72";
-projections[ 3003 ][ 0 ] =  "31370";	projections[ 3003 ][ 1 ] =  "Belge 1972 / Belgian Lambert 72";
-projections[ 3004 ][ 0 ] =  "31461";	projections[ 3004 ][ 1 ] =  "DHDN / 3-degree Gauss zone 1";
-projections[ 3005 ][ 0 ] =  "31462";	projections[ 3005 ][ 1 ] =  "DHDN / 3-degree Gauss zone 2";
-projections[ 3006 ][ 0 ] =  "31463";	projections[ 3006 ][ 1 ] =  "DHDN / 3-degree Gauss zone 3";
-projections[ 3007 ][ 0 ] =  "31464";	projections[ 3007 ][ 1 ] =  "DHDN / 3-degree Gauss zone 4";
-projections[ 3008 ][ 0 ] =  "31465";	projections[ 3008 ][ 1 ] =  "DHDN / 3-degree Gauss zone 5";
-projections[ 3009 ][ 0 ] =  "31466";	projections[ 3009 ][ 1 ] =  "DHDN / Gauss-Kruger zone 2";
-projections[ 3010 ][ 0 ] =  "31467";	projections[ 3010 ][ 1 ] =  "DHDN / Gauss-Kruger zone 3";
-projections[ 3011 ][ 0 ] =  "31468";	projections[ 3011 ][ 1 ] =  "DHDN / Gauss-Kruger zone 4";
-projections[ 3012 ][ 0 ] =  "31469";	projections[ 3012 ][ 1 ] =  "DHDN / Gauss-Kruger zone 5";
-projections[ 3013 ][ 0 ] =  "31528";	projections[ 3013 ][ 1 ] =  "Conakry 1905 / UTM zone 28N";
-projections[ 3014 ][ 0 ] =  "31529";	projections[ 3014 ][ 1 ] =  "Conakry 1905 / UTM zone 29N";
-projections[ 3015 ][ 0 ] =  "31600";	projections[ 3015 ][ 1 ] =  "Dealul Piscului 1933/ Stereo 33";
-projections[ 3016 ][ 0 ] =  "31700";	projections[ 3016 ][ 1 ] =  "Dealul Piscului 1970/ Stereo 70";
-projections[ 3017 ][ 0 ] =  "31838";	projections[ 3017 ][ 1 ] =  "NGN / UTM zone 38N";
-projections[ 3018 ][ 0 ] =  "31839";	projections[ 3018 ][ 1 ] =  "NGN / UTM zone 39N";
-projections[ 3019 ][ 0 ] =  "31900";	projections[ 3019 ][ 1 ] =  "KUDAMS / KTM";
-projections[ 3020 ][ 0 ] =  "31901";	projections[ 3020 ][ 1 ] =  "KUDAMS / KTM";
-projections[ 3021 ][ 0 ] =  "31965";	projections[ 3021 ][ 1 ] =  "SIRGAS 2000 / UTM zone 11N";
-projections[ 3022 ][ 0 ] =  "31966";	projections[ 3022 ][ 1 ] =  "SIRGAS 2000 / UTM zone 12N";
-projections[ 3023 ][ 0 ] =  "31967";	projections[ 3023 ][ 1 ] =  "SIRGAS 2000 / UTM zone 13N";
-projections[ 3024 ][ 0 ] =  "31968";	projections[ 3024 ][ 1 ] =  "SIRGAS 2000 / UTM zone 14N";
-projections[ 3025 ][ 0 ] =  "31969";	projections[ 3025 ][ 1 ] =  "SIRGAS 2000 / UTM zone 15N";
-projections[ 3026 ][ 0 ] =  "31970";	projections[ 3026 ][ 1 ] =  "SIRGAS 2000 / UTM zone 16N";
-projections[ 3027 ][ 0 ] =  "31971";	projections[ 3027 ][ 1 ] =  "SIRGAS 2000 / UTM zone 17N";
-projections[ 3028 ][ 0 ] =  "31972";	projections[ 3028 ][ 1 ] =  "SIRGAS 2000 / UTM zone 18N";
-projections[ 3029 ][ 0 ] =  "31973";	projections[ 3029 ][ 1 ] =  "SIRGAS 2000 / UTM zone 19N";
-projections[ 3030 ][ 0 ] =  "31974";	projections[ 3030 ][ 1 ] =  "SIRGAS 2000 / UTM zone 20N";
-projections[ 3031 ][ 0 ] =  "31975";	projections[ 3031 ][ 1 ] =  "SIRGAS 2000 / UTM zone 21N";
-projections[ 3032 ][ 0 ] =  "31976";	projections[ 3032 ][ 1 ] =  "SIRGAS 2000 / UTM zone 22N";
-projections[ 3033 ][ 0 ] =  "31977";	projections[ 3033 ][ 1 ] =  "SIRGAS 2000 / UTM zone 17S";
-projections[ 3034 ][ 0 ] =  "31978";	projections[ 3034 ][ 1 ] =  "SIRGAS 2000 / UTM zone 18S";
-projections[ 3035 ][ 0 ] =  "31979";	projections[ 3035 ][ 1 ] =  "SIRGAS 2000 / UTM zone 19S";
-projections[ 3036 ][ 0 ] =  "31980";	projections[ 3036 ][ 1 ] =  "SIRGAS 2000 / UTM zone 20S";
-projections[ 3037 ][ 0 ] =  "31981";	projections[ 3037 ][ 1 ] =  "SIRGAS 2000 / UTM zone 21S";
-projections[ 3038 ][ 0 ] =  "31982";	projections[ 3038 ][ 1 ] =  "SIRGAS 2000 / UTM zone 22S";
-projections[ 3039 ][ 0 ] =  "31983";	projections[ 3039 ][ 1 ] =  "SIRGAS 2000 / UTM zone 23S";
-projections[ 3040 ][ 0 ] =  "31984";	projections[ 3040 ][ 1 ] =  "SIRGAS 2000 / UTM zone 24S";
-projections[ 3041 ][ 0 ] =  "31985";	projections[ 3041 ][ 1 ] =  "SIRGAS 2000 / UTM zone 25S";
-projections[ 3042 ][ 0 ] =  "31986";	projections[ 3042 ][ 1 ] =  "SIRGAS / UTM zone 17N";
-projections[ 3043 ][ 0 ] =  "31987";	projections[ 3043 ][ 1 ] =  "SIRGAS / UTM zone 18N";
-projections[ 3044 ][ 0 ] =  "31988";	projections[ 3044 ][ 1 ] =  "SIRGAS / UTM zone 19N";
-projections[ 3045 ][ 0 ] =  "31989";	projections[ 3045 ][ 1 ] =  "SIRGAS / UTM zone 20N";
-projections[ 3046 ][ 0 ] =  "31990";	projections[ 3046 ][ 1 ] =  "SIRGAS / UTM zone 21N";
-projections[ 3047 ][ 0 ] =  "31991";	projections[ 3047 ][ 1 ] =  "SIRGAS / UTM zone 22N";
-projections[ 3048 ][ 0 ] =  "31992";	projections[ 3048 ][ 1 ] =  "SIRGAS / UTM zone 17S";
-projections[ 3049 ][ 0 ] =  "31993";	projections[ 3049 ][ 1 ] =  "SIRGAS / UTM zone 18S";
-projections[ 3050 ][ 0 ] =  "31994";	projections[ 3050 ][ 1 ] =  "SIRGAS / UTM zone 19S";
-projections[ 3051 ][ 0 ] =  "31995";	projections[ 3051 ][ 1 ] =  "SIRGAS / UTM zone 20S";
-projections[ 3052 ][ 0 ] =  "31996";	projections[ 3052 ][ 1 ] =  "SIRGAS / UTM zone 21S";
-projections[ 3053 ][ 0 ] =  "31997";	projections[ 3053 ][ 1 ] =  "SIRGAS / UTM zone 22S";
-projections[ 3054 ][ 0 ] =  "31998";	projections[ 3054 ][ 1 ] =  "SIRGAS / UTM zone 23S";
-projections[ 3055 ][ 0 ] =  "31999";	projections[ 3055 ][ 1 ] =  "SIRGAS / UTM zone 24S";
-projections[ 3056 ][ 0 ] =  "32000";	projections[ 3056 ][ 1 ] =  "SIRGAS / UTM zone 25S";
-projections[ 3057 ][ 0 ] =  "32001";	projections[ 3057 ][ 1 ] =  "NAD27 / Montana North";
-projections[ 3058 ][ 0 ] =  "32002";	projections[ 3058 ][ 1 ] =  "NAD27 / Montana Central";
-projections[ 3059 ][ 0 ] =  "32003";	projections[ 3059 ][ 1 ] =  "NAD27 / Montana South";
-projections[ 3060 ][ 0 ] =  "32005";	projections[ 3060 ][ 1 ] =  "NAD27 / Nebraska North";
-projections[ 3061 ][ 0 ] =  "32006";	projections[ 3061 ][ 1 ] =  "NAD27 / Nebraska South";
-projections[ 3062 ][ 0 ] =  "32007";	projections[ 3062 ][ 1 ] =  "NAD27 / Nevada East";
-projections[ 3063 ][ 0 ] =  "32008";	projections[ 3063 ][ 1 ] =  "NAD27 / Nevada Central";
-projections[ 3064 ][ 0 ] =  "32009";	projections[ 3064 ][ 1 ] =  "NAD27 / Nevada West";
-projections[ 3065 ][ 0 ] =  "32010";	projections[ 3065 ][ 1 ] =  "NAD27 / New Hampshire";
-projections[ 3066 ][ 0 ] =  "32011";	projections[ 3066 ][ 1 ] =  "NAD27 / New Jersey";
-projections[ 3067 ][ 0 ] =  "32012";	projections[ 3067 ][ 1 ] =  "NAD27 / New Mexico East";
-projections[ 3068 ][ 0 ] =  "32013";	projections[ 3068 ][ 1 ] =  "NAD27 / New Mexico Central";
-projections[ 3069 ][ 0 ] =  "32014";	projections[ 3069 ][ 1 ] =  "NAD27 / New Mexico West";
-projections[ 3070 ][ 0 ] =  "32015";	projections[ 3070 ][ 1 ] =  "NAD27 / New York East";
-projections[ 3071 ][ 0 ] =  "32016";	projections[ 3071 ][ 1 ] =  "NAD27 / New York Central";
-projections[ 3072 ][ 0 ] =  "32017";	projections[ 3072 ][ 1 ] =  "NAD27 / New York West";
-projections[ 3073 ][ 0 ] =  "32018";	projections[ 3073 ][ 1 ] =  "NAD27 / New York Long Island";
-projections[ 3074 ][ 0 ] =  "32019";	projections[ 3074 ][ 1 ] =  "NAD27 / North Carolina";
-projections[ 3075 ][ 0 ] =  "32020";	projections[ 3075 ][ 1 ] =  "NAD27 / North Dakota North";
-projections[ 3076 ][ 0 ] =  "32021";	projections[ 3076 ][ 1 ] =  "NAD27 / North Dakota South";
-projections[ 3077 ][ 0 ] =  "32022";	projections[ 3077 ][ 1 ] =  "NAD27 / Ohio North";
-projections[ 3078 ][ 0 ] =  "32023";	projections[ 3078 ][ 1 ] =  "NAD27 / Ohio South";
-projections[ 3079 ][ 0 ] =  "32024";	projections[ 3079 ][ 1 ] =  "NAD27 / Oklahoma North";
-projections[ 3080 ][ 0 ] =  "32025";	projections[ 3080 ][ 1 ] =  "NAD27 / Oklahoma South";
-projections[ 3081 ][ 0 ] =  "32026";	projections[ 3081 ][ 1 ] =  "NAD27 / Oregon North";
-projections[ 3082 ][ 0 ] =  "32027";	projections[ 3082 ][ 1 ] =  "NAD27 / Oregon South";
-projections[ 3083 ][ 0 ] =  "32028";	projections[ 3083 ][ 1 ] =  "NAD27 / Pennsylvania North";
-projections[ 3084 ][ 0 ] =  "32029";	projections[ 3084 ][ 1 ] =  "NAD27 / Pennsylvania South";
-projections[ 3085 ][ 0 ] =  "32030";	projections[ 3085 ][ 1 ] =  "NAD27 / Rhode Island";
-projections[ 3086 ][ 0 ] =  "32031";	projections[ 3086 ][ 1 ] =  "NAD27 / South Carolina North";
-projections[ 3087 ][ 0 ] =  "32033";	projections[ 3087 ][ 1 ] =  "NAD27 / South Carolina South";
-projections[ 3088 ][ 0 ] =  "32034";	projections[ 3088 ][ 1 ] =  "NAD27 / South Dakota North";
-projections[ 3089 ][ 0 ] =  "32035";	projections[ 3089 ][ 1 ] =  "NAD27 / South Dakota South";
-projections[ 3090 ][ 0 ] =  "32036";	projections[ 3090 ][ 1 ] =  "NAD27 / Tennessee";
-projections[ 3091 ][ 0 ] =  "32037";	projections[ 3091 ][ 1 ] =  "NAD27 / Texas North";
-projections[ 3092 ][ 0 ] =  "32038";	projections[ 3092 ][ 1 ] =  "NAD27 / Texas North Central";
-projections[ 3093 ][ 0 ] =  "32039";	projections[ 3093 ][ 1 ] =  "NAD27 / Texas Central";
-projections[ 3094 ][ 0 ] =  "32040";	projections[ 3094 ][ 1 ] =  "NAD27 / Texas South Central";
-projections[ 3095 ][ 0 ] =  "32041";	projections[ 3095 ][ 1 ] =  "NAD27 / Texas South";
-projections[ 3096 ][ 0 ] =  "32042";	projections[ 3096 ][ 1 ] =  "NAD27 / Utah North";
-projections[ 3097 ][ 0 ] =  "32043";	projections[ 3097 ][ 1 ] =  "NAD27 / Utah Central";
-projections[ 3098 ][ 0 ] =  "32044";	projections[ 3098 ][ 1 ] =  "NAD27 / Utah South";
-projections[ 3099 ][ 0 ] =  "32045";	projections[ 3099 ][ 1 ] =  "NAD27 / Vermont";
-projections[ 3100 ][ 0 ] =  "32046";	projections[ 3100 ][ 1 ] =  "NAD27 / Virginia North";
-projections[ 3101 ][ 0 ] =  "32047";	projections[ 3101 ][ 1 ] =  "NAD27 / Virginia South";
-projections[ 3102 ][ 0 ] =  "32048";	projections[ 3102 ][ 1 ] =  "NAD27 / Washington North";
-projections[ 3103 ][ 0 ] =  "32049";	projections[ 3103 ][ 1 ] =  "NAD27 / Washington South";
-projections[ 3104 ][ 0 ] =  "32050";	projections[ 3104 ][ 1 ] =  "NAD27 / West Virginia North";
-projections[ 3105 ][ 0 ] =  "32051";	projections[ 3105 ][ 1 ] =  "NAD27 / West Virginia South";
-projections[ 3106 ][ 0 ] =  "32052";	projections[ 3106 ][ 1 ] =  "NAD27 / Wisconsin North";
-projections[ 3107 ][ 0 ] =  "32053";	projections[ 3107 ][ 1 ] =  "NAD27 / Wisconsin Central";
-projections[ 3108 ][ 0 ] =  "32054";	projections[ 3108 ][ 1 ] =  "NAD27 / Wisconsin South";
-projections[ 3109 ][ 0 ] =  "32055";	projections[ 3109 ][ 1 ] =  "NAD27 / Wyoming East";
-projections[ 3110 ][ 0 ] =  "32056";	projections[ 3110 ][ 1 ] =  "NAD27 / Wyoming East Central";
-projections[ 3111 ][ 0 ] =  "32057";	projections[ 3111 ][ 1 ] =  "NAD27 / Wyoming West Central";
-projections[ 3112 ][ 0 ] =  "32058";	projections[ 3112 ][ 1 ] =  "NAD27 / Wyoming West";
-projections[ 3113 ][ 0 ] =  "32061";	projections[ 3113 ][ 1 ] =  "NAD27 / Guatemala Norte";
-projections[ 3114 ][ 0 ] =  "32062";	projections[ 3114 ][ 1 ] =  "NAD27 / Guatemala Sur";
-projections[ 3115 ][ 0 ] =  "32064";	projections[ 3115 ][ 1 ] =  "NAD27 / BLM 14N (ftUS)";
-projections[ 3116 ][ 0 ] =  "32065";	projections[ 3116 ][ 1 ] =  "NAD27 / BLM 15N (ftUS)";
-projections[ 3117 ][ 0 ] =  "32066";	projections[ 3117 ][ 1 ] =  "NAD27 / BLM 16N (ftUS)";
-projections[ 3118 ][ 0 ] =  "32067";	projections[ 3118 ][ 1 ] =  "NAD27 / BLM 17N (ftUS)";
-projections[ 3119 ][ 0 ] =  "32074";	projections[ 3119 ][ 1 ] =  "NAD27 / BLM 14N (feet)";
-projections[ 3120 ][ 0 ] =  "32075";	projections[ 3120 ][ 1 ] =  "NAD27 / BLM 15N (feet)";
-projections[ 3121 ][ 0 ] =  "32076";	projections[ 3121 ][ 1 ] =  "NAD27 / BLM 16N (feet)";
-projections[ 3122 ][ 0 ] =  "32077";	projections[ 3122 ][ 1 ] =  "NAD27 / BLM 17N (feet)";
-projections[ 3123 ][ 0 ] =  "32081";	projections[ 3123 ][ 1 ] =  "NAD27 / MTM zone 1";
-projections[ 3124 ][ 0 ] =  "32082";	projections[ 3124 ][ 1 ] =  "NAD27 / MTM zone 2";
-projections[ 3125 ][ 0 ] =  "32083";	projections[ 3125 ][ 1 ] =  "NAD27 / MTM zone 3";
-projections[ 3126 ][ 0 ] =  "32084";	projections[ 3126 ][ 1 ] =  "NAD27 / MTM zone 4";
-projections[ 3127 ][ 0 ] =  "32085";	projections[ 3127 ][ 1 ] =  "NAD27 / MTM zone 5";
-projections[ 3128 ][ 0 ] =  "32086";	projections[ 3128 ][ 1 ] =  "NAD27 / MTM zone 6";
-projections[ 3129 ][ 0 ] =  "32098";	projections[ 3129 ][ 1 ] =  "NAD27 / Quebec Lambert";
-projections[ 3130 ][ 0 ] =  "32099";	projections[ 3130 ][ 1 ] =  "NAD27 / Louisiana Offshore";
-projections[ 3131 ][ 0 ] =  "32100";	projections[ 3131 ][ 1 ] =  "NAD83 / Montana";
-projections[ 3132 ][ 0 ] =  "32104";	projections[ 3132 ][ 1 ] =  "NAD83 / Nebraska";
-projections[ 3133 ][ 0 ] =  "32107";	projections[ 3133 ][ 1 ] =  "NAD83 / Nevada East";
-projections[ 3134 ][ 0 ] =  "32108";	projections[ 3134 ][ 1 ] =  "NAD83 / Nevada Central";
-projections[ 3135 ][ 0 ] =  "32109";	projections[ 3135 ][ 1 ] =  "NAD83 / Nevada West";
-projections[ 3136 ][ 0 ] =  "32110";	projections[ 3136 ][ 1 ] =  "NAD83 / New Hampshire";
-projections[ 3137 ][ 0 ] =  "32111";	projections[ 3137 ][ 1 ] =  "NAD83 / New Jersey";
-projections[ 3138 ][ 0 ] =  "32112";	projections[ 3138 ][ 1 ] =  "NAD83 / New Mexico East";
-projections[ 3139 ][ 0 ] =  "32113";	projections[ 3139 ][ 1 ] =  "NAD83 / New Mexico Central";
-projections[ 3140 ][ 0 ] =  "32114";	projections[ 3140 ][ 1 ] =  "NAD83 / New Mexico West";
-projections[ 3141 ][ 0 ] =  "32115";	projections[ 3141 ][ 1 ] =  "NAD83 / New York East";
-projections[ 3142 ][ 0 ] =  "32116";	projections[ 3142 ][ 1 ] =  "NAD83 / New York Central";
-projections[ 3143 ][ 0 ] =  "32117";	projections[ 3143 ][ 1 ] =  "NAD83 / New York West";
-projections[ 3144 ][ 0 ] =  "32118";	projections[ 3144 ][ 1 ] =  "NAD83 / New York Long Island";
-projections[ 3145 ][ 0 ] =  "32119";	projections[ 3145 ][ 1 ] =  "NAD83 / North Carolina";
-projections[ 3146 ][ 0 ] =  "32120";	projections[ 3146 ][ 1 ] =  "NAD83 / North Dakota North";
-projections[ 3147 ][ 0 ] =  "32121";	projections[ 3147 ][ 1 ] =  "NAD83 / North Dakota South";
-projections[ 3148 ][ 0 ] =  "32122";	projections[ 3148 ][ 1 ] =  "NAD83 / Ohio North";
-projections[ 3149 ][ 0 ] =  "32123";	projections[ 3149 ][ 1 ] =  "NAD83 / Ohio South";
-projections[ 3150 ][ 0 ] =  "32124";	projections[ 3150 ][ 1 ] =  "NAD83 / Oklahoma North";
-projections[ 3151 ][ 0 ] =  "32125";	projections[ 3151 ][ 1 ] =  "NAD83 / Oklahoma South";
-projections[ 3152 ][ 0 ] =  "32126";	projections[ 3152 ][ 1 ] =  "NAD83 / Oregon North";
-projections[ 3153 ][ 0 ] =  "32127";	projections[ 3153 ][ 1 ] =  "NAD83 / Oregon South";
-projections[ 3154 ][ 0 ] =  "32128";	projections[ 3154 ][ 1 ] =  "NAD83 / Pennsylvania North";
-projections[ 3155 ][ 0 ] =  "32129";	projections[ 3155 ][ 1 ] =  "NAD83 / Pennsylvania South";
-projections[ 3156 ][ 0 ] =  "32130";	projections[ 3156 ][ 1 ] =  "NAD83 / Rhode Island";
-projections[ 3157 ][ 0 ] =  "32133";	projections[ 3157 ][ 1 ] =  "NAD83 / South Carolina";
-projections[ 3158 ][ 0 ] =  "32134";	projections[ 3158 ][ 1 ] =  "NAD83 / South Dakota North";
-projections[ 3159 ][ 0 ] =  "32135";	projections[ 3159 ][ 1 ] =  "NAD83 / South Dakota South";
-projections[ 3160 ][ 0 ] =  "32136";	projections[ 3160 ][ 1 ] =  "NAD83 / Tennessee";
-projections[ 3161 ][ 0 ] =  "32137";	projections[ 3161 ][ 1 ] =  "NAD83 / Texas North";
-projections[ 3162 ][ 0 ] =  "32138";	projections[ 3162 ][ 1 ] =  "NAD83 / Texas North Central";
-projections[ 3163 ][ 0 ] =  "32139";	projections[ 3163 ][ 1 ] =  "NAD83 / Texas Central";
-projections[ 3164 ][ 0 ] =  "32140";	projections[ 3164 ][ 1 ] =  "NAD83 / Texas South Central";
-projections[ 3165 ][ 0 ] =  "32141";	projections[ 3165 ][ 1 ] =  "NAD83 / Texas South";
-projections[ 3166 ][ 0 ] =  "32142";	projections[ 3166 ][ 1 ] =  "NAD83 / Utah North";
-projections[ 3167 ][ 0 ] =  "32143";	projections[ 3167 ][ 1 ] =  "NAD83 / Utah Central";
-projections[ 3168 ][ 0 ] =  "32144";	projections[ 3168 ][ 1 ] =  "NAD83 / Utah South";
-projections[ 3169 ][ 0 ] =  "32145";	projections[ 3169 ][ 1 ] =  "NAD83 / Vermont";
-projections[ 3170 ][ 0 ] =  "32146";	projections[ 3170 ][ 1 ] =  "NAD83 / Virginia North";
-projections[ 3171 ][ 0 ] =  "32147";	projections[ 3171 ][ 1 ] =  "NAD83 / Virginia South";
-projections[ 3172 ][ 0 ] =  "32148";	projections[ 3172 ][ 1 ] =  "NAD83 / Washington North";
-projections[ 3173 ][ 0 ] =  "32149";	projections[ 3173 ][ 1 ] =  "NAD83 / Washington South";
-projections[ 3174 ][ 0 ] =  "32150";	projections[ 3174 ][ 1 ] =  "NAD83 / West Virginia North";
-projections[ 3175 ][ 0 ] =  "32151";	projections[ 3175 ][ 1 ] =  "NAD83 / West Virginia South";
-projections[ 3176 ][ 0 ] =  "32152";	projections[ 3176 ][ 1 ] =  "NAD83 / Wisconsin North";
-projections[ 3177 ][ 0 ] =  "32153";	projections[ 3177 ][ 1 ] =  "NAD83 / Wisconsin Central";
-projections[ 3178 ][ 0 ] =  "32154";	projections[ 3178 ][ 1 ] =  "NAD83 / Wisconsin South";
-projections[ 3179 ][ 0 ] =  "32155";	projections[ 3179 ][ 1 ] =  "NAD83 / Wyoming East";
-projections[ 3180 ][ 0 ] =  "32156";	projections[ 3180 ][ 1 ] =  "NAD83 / Wyoming East Central";
-projections[ 3181 ][ 0 ] =  "32157";	projections[ 3181 ][ 1 ] =  "NAD83 / Wyoming West Central";
-projections[ 3182 ][ 0 ] =  "32158";	projections[ 3182 ][ 1 ] =  "NAD83 / Wyoming West";
-projections[ 3183 ][ 0 ] =  "32161";	projections[ 3183 ][ 1 ] =  "NAD83 / Puerto Rico & Virgin Is.";
-projections[ 3184 ][ 0 ] =  "32164";	projections[ 3184 ][ 1 ] =  "NAD83 / BLM 14N (ftUS)";
-projections[ 3185 ][ 0 ] =  "32165";	projections[ 3185 ][ 1 ] =  "NAD83 / BLM 15N (ftUS)";
-projections[ 3186 ][ 0 ] =  "32166";	projections[ 3186 ][ 1 ] =  "NAD83 / BLM 16N (ftUS)";
-projections[ 3187 ][ 0 ] =  "32167";	projections[ 3187 ][ 1 ] =  "NAD83 / BLM 17N (ftUS)";
-projections[ 3188 ][ 0 ] =  "32180";	projections[ 3188 ][ 1 ] =  "NAD83 / SCoPQ zone 2";
-projections[ 3189 ][ 0 ] =  "32181";	projections[ 3189 ][ 1 ] =  "NAD83 / MTM zone 1";
-projections[ 3190 ][ 0 ] =  "32182";	projections[ 3190 ][ 1 ] =  "NAD83 / MTM zone 2";
-projections[ 3191 ][ 0 ] =  "32183";	projections[ 3191 ][ 1 ] =  "NAD83 / MTM zone 3";
-projections[ 3192 ][ 0 ] =  "32184";	projections[ 3192 ][ 1 ] =  "NAD83 / MTM zone 4";
-projections[ 3193 ][ 0 ] =  "32185";	projections[ 3193 ][ 1 ] =  "NAD83 / MTM zone 5";
-projections[ 3194 ][ 0 ] =  "32186";	projections[ 3194 ][ 1 ] =  "NAD83 / MTM zone 6";
-projections[ 3195 ][ 0 ] =  "32187";	projections[ 3195 ][ 1 ] =  "NAD83 / MTM zone 7";
-projections[ 3196 ][ 0 ] =  "32188";	projections[ 3196 ][ 1 ] =  "NAD83 / MTM zone 8";
-projections[ 3197 ][ 0 ] =  "32189";	projections[ 3197 ][ 1 ] =  "NAD83 / MTM zone 9";
-projections[ 3198 ][ 0 ] =  "32190";	projections[ 3198 ][ 1 ] =  "NAD83 / MTM zone 10";
-projections[ 3199 ][ 0 ] =  "32191";	projections[ 3199 ][ 1 ] =  "NAD83 / MTM zone 11";
-projections[ 3200 ][ 0 ] =  "32192";	projections[ 3200 ][ 1 ] =  "NAD83 / MTM zone 12";
-projections[ 3201 ][ 0 ] =  "32193";	projections[ 3201 ][ 1 ] =  "NAD83 / MTM zone 13";
-projections[ 3202 ][ 0 ] =  "32194";	projections[ 3202 ][ 1 ] =  "NAD83 / MTM zone 14";
-projections[ 3203 ][ 0 ] =  "32195";	projections[ 3203 ][ 1 ] =  "NAD83 / MTM zone 15";
-projections[ 3204 ][ 0 ] =  "32196";	projections[ 3204 ][ 1 ] =  "NAD83 / MTM zone 16";
-projections[ 3205 ][ 0 ] =  "32197";	projections[ 3205 ][ 1 ] =  "NAD83 / MTM zone 17";
-projections[ 3206 ][ 0 ] =  "32198";	projections[ 3206 ][ 1 ] =  "NAD83 / Quebec Lambert";
-projections[ 3207 ][ 0 ] =  "32199";	projections[ 3207 ][ 1 ] =  "NAD83 / Louisiana Offshore";
-projections[ 3208 ][ 0 ] =  "32201";	projections[ 3208 ][ 1 ] =  "WGS 72 / UTM zone 1N";
-projections[ 3209 ][ 0 ] =  "32202";	projections[ 3209 ][ 1 ] =  "WGS 72 / UTM zone 2N";
-projections[ 3210 ][ 0 ] =  "32203";	projections[ 3210 ][ 1 ] =  "WGS 72 / UTM zone 3N";
-projections[ 3211 ][ 0 ] =  "32204";	projections[ 3211 ][ 1 ] =  "WGS 72 / UTM zone 4N";
-projections[ 3212 ][ 0 ] =  "32205";	projections[ 3212 ][ 1 ] =  "WGS 72 / UTM zone 5N";
-projections[ 3213 ][ 0 ] =  "32206";	projections[ 3213 ][ 1 ] =  "WGS 72 / UTM zone 6N";
-projections[ 3214 ][ 0 ] =  "32207";	projections[ 3214 ][ 1 ] =  "WGS 72 / UTM zone 7N";
-projections[ 3215 ][ 0 ] =  "32208";	projections[ 3215 ][ 1 ] =  "WGS 72 / UTM zone 8N";
-projections[ 3216 ][ 0 ] =  "32209";	projections[ 3216 ][ 1 ] =  "WGS 72 / UTM zone 9N";
-projections[ 3217 ][ 0 ] =  "32210";	projections[ 3217 ][ 1 ] =  "WGS 72 / UTM zone 10N";
-projections[ 3218 ][ 0 ] =  "32211";	projections[ 3218 ][ 1 ] =  "WGS 72 / UTM zone 11N";
-projections[ 3219 ][ 0 ] =  "32212";	projections[ 3219 ][ 1 ] =  "WGS 72 / UTM zone 12N";
-projections[ 3220 ][ 0 ] =  "32213";	projections[ 3220 ][ 1 ] =  "WGS 72 / UTM zone 13N";
-projections[ 3221 ][ 0 ] =  "32214";	projections[ 3221 ][ 1 ] =  "WGS 72 / UTM zone 14N";
-projections[ 3222 ][ 0 ] =  "32215";	projections[ 3222 ][ 1 ] =  "WGS 72 / UTM zone 15N";
-projections[ 3223 ][ 0 ] =  "32216";	projections[ 3223 ][ 1 ] =  "WGS 72 / UTM zone 16N";
-projections[ 3224 ][ 0 ] =  "32217";	projections[ 3224 ][ 1 ] =  "WGS 72 / UTM zone 17N";
-projections[ 3225 ][ 0 ] =  "32218";	projections[ 3225 ][ 1 ] =  "WGS 72 / UTM zone 18N";
-projections[ 3226 ][ 0 ] =  "32219";	projections[ 3226 ][ 1 ] =  "WGS 72 / UTM zone 19N";
-projections[ 3227 ][ 0 ] =  "32220";	projections[ 3227 ][ 1 ] =  "WGS 72 / UTM zone 20N";
-projections[ 3228 ][ 0 ] =  "32221";	projections[ 3228 ][ 1 ] =  "WGS 72 / UTM zone 21N";
-projections[ 3229 ][ 0 ] =  "32222";	projections[ 3229 ][ 1 ] =  "WGS 72 / UTM zone 22N";
-projections[ 3230 ][ 0 ] =  "32223";	projections[ 3230 ][ 1 ] =  "WGS 72 / UTM zone 23N";
-projections[ 3231 ][ 0 ] =  "32224";	projections[ 3231 ][ 1 ] =  "WGS 72 / UTM zone 24N";
-projections[ 3232 ][ 0 ] =  "32225";	projections[ 3232 ][ 1 ] =  "WGS 72 / UTM zone 25N";
-projections[ 3233 ][ 0 ] =  "32226";	projections[ 3233 ][ 1 ] =  "WGS 72 / UTM zone 26N";
-projections[ 3234 ][ 0 ] =  "32227";	projections[ 3234 ][ 1 ] =  "WGS 72 / UTM zone 27N";
-projections[ 3235 ][ 0 ] =  "32228";	projections[ 3235 ][ 1 ] =  "WGS 72 / UTM zone 28N";
-projections[ 3236 ][ 0 ] =  "32229";	projections[ 3236 ][ 1 ] =  "WGS 72 / UTM zone 29N";
-projections[ 3237 ][ 0 ] =  "32230";	projections[ 3237 ][ 1 ] =  "WGS 72 / UTM zone 30N";
-projections[ 3238 ][ 0 ] =  "32231";	projections[ 3238 ][ 1 ] =  "WGS 72 / UTM zone 31N";
-projections[ 3239 ][ 0 ] =  "32232";	projections[ 3239 ][ 1 ] =  "WGS 72 / UTM zone 32N";
-projections[ 3240 ][ 0 ] =  "32233";	projections[ 3240 ][ 1 ] =  "WGS 72 / UTM zone 33N";
-projections[ 3241 ][ 0 ] =  "32234";	projections[ 3241 ][ 1 ] =  "WGS 72 / UTM zone 34N";
-projections[ 3242 ][ 0 ] =  "32235";	projections[ 3242 ][ 1 ] =  "WGS 72 / UTM zone 35N";
-projections[ 3243 ][ 0 ] =  "32236";	projections[ 3243 ][ 1 ] =  "WGS 72 / UTM zone 36N";
-projections[ 3244 ][ 0 ] =  "32237";	projections[ 3244 ][ 1 ] =  "WGS 72 / UTM zone 37N";
-projections[ 3245 ][ 0 ] =  "32238";	projections[ 3245 ][ 1 ] =  "WGS 72 / UTM zone 38N";
-projections[ 3246 ][ 0 ] =  "32239";	projections[ 3246 ][ 1 ] =  "WGS 72 / UTM zone 39N";
-projections[ 3247 ][ 0 ] =  "32240";	projections[ 3247 ][ 1 ] =  "WGS 72 / UTM zone 40N";
-projections[ 3248 ][ 0 ] =  "32241";	projections[ 3248 ][ 1 ] =  "WGS 72 / UTM zone 41N";
-projections[ 3249 ][ 0 ] =  "32242";	projections[ 3249 ][ 1 ] =  "WGS 72 / UTM zone 42N";
-projections[ 3250 ][ 0 ] =  "32243";	projections[ 3250 ][ 1 ] =  "WGS 72 / UTM zone 43N";
-projections[ 3251 ][ 0 ] =  "32244";	projections[ 3251 ][ 1 ] =  "WGS 72 / UTM zone 44N";
-projections[ 3252 ][ 0 ] =  "32245";	projections[ 3252 ][ 1 ] =  "WGS 72 / UTM zone 45N";
-projections[ 3253 ][ 0 ] =  "32246";	projections[ 3253 ][ 1 ] =  "WGS 72 / UTM zone 46N";
-projections[ 3254 ][ 0 ] =  "32247";	projections[ 3254 ][ 1 ] =  "WGS 72 / UTM zone 47N";
-projections[ 3255 ][ 0 ] =  "32248";	projections[ 3255 ][ 1 ] =  "WGS 72 / UTM zone 48N";
-projections[ 3256 ][ 0 ] =  "32249";	projections[ 3256 ][ 1 ] =  "WGS 72 / UTM zone 49N";
-projections[ 3257 ][ 0 ] =  "32250";	projections[ 3257 ][ 1 ] =  "WGS 72 / UTM zone 50N";
-projections[ 3258 ][ 0 ] =  "32251";	projections[ 3258 ][ 1 ] =  "WGS 72 / UTM zone 51N";
-projections[ 3259 ][ 0 ] =  "32252";	projections[ 3259 ][ 1 ] =  "WGS 72 / UTM zone 52N";
-projections[ 3260 ][ 0 ] =  "32253";	projections[ 3260 ][ 1 ] =  "WGS 72 / UTM zone 53N";
-projections[ 3261 ][ 0 ] =  "32254";	projections[ 3261 ][ 1 ] =  "WGS 72 / UTM zone 54N";
-projections[ 3262 ][ 0 ] =  "32255";	projections[ 3262 ][ 1 ] =  "WGS 72 / UTM zone 55N";
-projections[ 3263 ][ 0 ] =  "32256";	projections[ 3263 ][ 1 ] =  "WGS 72 / UTM zone 56N";
-projections[ 3264 ][ 0 ] =  "32257";	projections[ 3264 ][ 1 ] =  "WGS 72 / UTM zone 57N";
-projections[ 3265 ][ 0 ] =  "32258";	projections[ 3265 ][ 1 ] =  "WGS 72 / UTM zone 58N";
-projections[ 3266 ][ 0 ] =  "32259";	projections[ 3266 ][ 1 ] =  "WGS 72 / UTM zone 59N";
-projections[ 3267 ][ 0 ] =  "32260";	projections[ 3267 ][ 1 ] =  "WGS 72 / UTM zone 60N";
-projections[ 3268 ][ 0 ] =  "32301";	projections[ 3268 ][ 1 ] =  "WGS 72 / UTM zone 1S";
-projections[ 3269 ][ 0 ] =  "32302";	projections[ 3269 ][ 1 ] =  "WGS 72 / UTM zone 2S";
-projections[ 3270 ][ 0 ] =  "32303";	projections[ 3270 ][ 1 ] =  "WGS 72 / UTM zone 3S";
-projections[ 3271 ][ 0 ] =  "32304";	projections[ 3271 ][ 1 ] =  "WGS 72 / UTM zone 4S";
-projections[ 3272 ][ 0 ] =  "32305";	projections[ 3272 ][ 1 ] =  "WGS 72 / UTM zone 5S";
-projections[ 3273 ][ 0 ] =  "32306";	projections[ 3273 ][ 1 ] =  "WGS 72 / UTM zone 6S";
-projections[ 3274 ][ 0 ] =  "32307";	projections[ 3274 ][ 1 ] =  "WGS 72 / UTM zone 7S";
-projections[ 3275 ][ 0 ] =  "32308";	projections[ 3275 ][ 1 ] =  "WGS 72 / UTM zone 8S";
-projections[ 3276 ][ 0 ] =  "32309";	projections[ 3276 ][ 1 ] =  "WGS 72 / UTM zone 9S";
-projections[ 3277 ][ 0 ] =  "32310";	projections[ 3277 ][ 1 ] =  "WGS 72 / UTM zone 10S";
-projections[ 3278 ][ 0 ] =  "32311";	projections[ 3278 ][ 1 ] =  "WGS 72 / UTM zone 11S";
-projections[ 3279 ][ 0 ] =  "32312";	projections[ 3279 ][ 1 ] =  "WGS 72 / UTM zone 12S";
-projections[ 3280 ][ 0 ] =  "32313";	projections[ 3280 ][ 1 ] =  "WGS 72 / UTM zone 13S";
-projections[ 3281 ][ 0 ] =  "32314";	projections[ 3281 ][ 1 ] =  "WGS 72 / UTM zone 14S";
-projections[ 3282 ][ 0 ] =  "32315";	projections[ 3282 ][ 1 ] =  "WGS 72 / UTM zone 15S";
-projections[ 3283 ][ 0 ] =  "32316";	projections[ 3283 ][ 1 ] =  "WGS 72 / UTM zone 16S";
-projections[ 3284 ][ 0 ] =  "32317";	projections[ 3284 ][ 1 ] =  "WGS 72 / UTM zone 17S";
-projections[ 3285 ][ 0 ] =  "32318";	projections[ 3285 ][ 1 ] =  "WGS 72 / UTM zone 18S";
-projections[ 3286 ][ 0 ] =  "32319";	projections[ 3286 ][ 1 ] =  "WGS 72 / UTM zone 19S";
-projections[ 3287 ][ 0 ] =  "32320";	projections[ 3287 ][ 1 ] =  "WGS 72 / UTM zone 20S";
-projections[ 3288 ][ 0 ] =  "32321";	projections[ 3288 ][ 1 ] =  "WGS 72 / UTM zone 21S";
-projections[ 3289 ][ 0 ] =  "32322";	projections[ 3289 ][ 1 ] =  "WGS 72 / UTM zone 22S";
-projections[ 3290 ][ 0 ] =  "32323";	projections[ 3290 ][ 1 ] =  "WGS 72 / UTM zone 23S";
-projections[ 3291 ][ 0 ] =  "32324";	projections[ 3291 ][ 1 ] =  "WGS 72 / UTM zone 24S";
-projections[ 3292 ][ 0 ] =  "32325";	projections[ 3292 ][ 1 ] =  "WGS 72 / UTM zone 25S";
-projections[ 3293 ][ 0 ] =  "32326";	projections[ 3293 ][ 1 ] =  "WGS 72 / UTM zone 26S";
-projections[ 3294 ][ 0 ] =  "32327";	projections[ 3294 ][ 1 ] =  "WGS 72 / UTM zone 27S";
-projections[ 3295 ][ 0 ] =  "32328";	projections[ 3295 ][ 1 ] =  "WGS 72 / UTM zone 28S";
-projections[ 3296 ][ 0 ] =  "32329";	projections[ 3296 ][ 1 ] =  "WGS 72 / UTM zone 29S";
-projections[ 3297 ][ 0 ] =  "32330";	projections[ 3297 ][ 1 ] =  "WGS 72 / UTM zone 30S";
-projections[ 3298 ][ 0 ] =  "32331";	projections[ 3298 ][ 1 ] =  "WGS 72 / UTM zone 31S";
-projections[ 3299 ][ 0 ] =  "32332";	projections[ 3299 ][ 1 ] =  "WGS 72 / UTM zone 32S";
-projections[ 3300 ][ 0 ] =  "32333";	projections[ 3300 ][ 1 ] =  "WGS 72 / UTM zone 33S";
-projections[ 3301 ][ 0 ] =  "32334";	projections[ 3301 ][ 1 ] =  "WGS 72 / UTM zone 34S";
-projections[ 3302 ][ 0 ] =  "32335";	projections[ 3302 ][ 1 ] =  "WGS 72 / UTM zone 35S";
-projections[ 3303 ][ 0 ] =  "32336";	projections[ 3303 ][ 1 ] =  "WGS 72 / UTM zone 36S";
-projections[ 3304 ][ 0 ] =  "32337";	projections[ 3304 ][ 1 ] =  "WGS 72 / UTM zone 37S";
-projections[ 3305 ][ 0 ] =  "32338";	projections[ 3305 ][ 1 ] =  "WGS 72 / UTM zone 38S";
-projections[ 3306 ][ 0 ] =  "32339";	projections[ 3306 ][ 1 ] =  "WGS 72 / UTM zone 39S";
-projections[ 3307 ][ 0 ] =  "32340";	projections[ 3307 ][ 1 ] =  "WGS 72 / UTM zone 40S";
-projections[ 3308 ][ 0 ] =  "32341";	projections[ 3308 ][ 1 ] =  "WGS 72 / UTM zone 41S";
-projections[ 3309 ][ 0 ] =  "32342";	projections[ 3309 ][ 1 ] =  "WGS 72 / UTM zone 42S";
-projections[ 3310 ][ 0 ] =  "32343";	projections[ 3310 ][ 1 ] =  "WGS 72 / UTM zone 43S";
-projections[ 3311 ][ 0 ] =  "32344";	projections[ 3311 ][ 1 ] =  "WGS 72 / UTM zone 44S";
-projections[ 3312 ][ 0 ] =  "32345";	projections[ 3312 ][ 1 ] =  "WGS 72 / UTM zone 45S";
-projections[ 3313 ][ 0 ] =  "32346";	projections[ 3313 ][ 1 ] =  "WGS 72 / UTM zone 46S";
-projections[ 3314 ][ 0 ] =  "32347";	projections[ 3314 ][ 1 ] =  "WGS 72 / UTM zone 47S";
-projections[ 3315 ][ 0 ] =  "32348";	projections[ 3315 ][ 1 ] =  "WGS 72 / UTM zone 48S";
-projections[ 3316 ][ 0 ] =  "32349";	projections[ 3316 ][ 1 ] =  "WGS 72 / UTM zone 49S";
-projections[ 3317 ][ 0 ] =  "32350";	projections[ 3317 ][ 1 ] =  "WGS 72 / UTM zone 50S";
-projections[ 3318 ][ 0 ] =  "32351";	projections[ 3318 ][ 1 ] =  "WGS 72 / UTM zone 51S";
-projections[ 3319 ][ 0 ] =  "32352";	projections[ 3319 ][ 1 ] =  "WGS 72 / UTM zone 52S";
-projections[ 3320 ][ 0 ] =  "32353";	projections[ 3320 ][ 1 ] =  "WGS 72 / UTM zone 53S";
-projections[ 3321 ][ 0 ] =  "32354";	projections[ 3321 ][ 1 ] =  "WGS 72 / UTM zone 54S";
-projections[ 3322 ][ 0 ] =  "32355";	projections[ 3322 ][ 1 ] =  "WGS 72 / UTM zone 55S";
-projections[ 3323 ][ 0 ] =  "32356";	projections[ 3323 ][ 1 ] =  "WGS 72 / UTM zone 56S";
-projections[ 3324 ][ 0 ] =  "32357";	projections[ 3324 ][ 1 ] =  "WGS 72 / UTM zone 57S";
-projections[ 3325 ][ 0 ] =  "32358";	projections[ 3325 ][ 1 ] =  "WGS 72 / UTM zone 58S";
-projections[ 3326 ][ 0 ] =  "32359";	projections[ 3326 ][ 1 ] =  "WGS 72 / UTM zone 59S";
-projections[ 3327 ][ 0 ] =  "32360";	projections[ 3327 ][ 1 ] =  "WGS 72 / UTM zone 60S";
-projections[ 3328 ][ 0 ] =  "32401";	projections[ 3328 ][ 1 ] =  "WGS 72BE / UTM zone 1N";
-projections[ 3329 ][ 0 ] =  "32402";	projections[ 3329 ][ 1 ] =  "WGS 72BE / UTM zone 2N";
-projections[ 3330 ][ 0 ] =  "32403";	projections[ 3330 ][ 1 ] =  "WGS 72BE / UTM zone 3N";
-projections[ 3331 ][ 0 ] =  "32404";	projections[ 3331 ][ 1 ] =  "WGS 72BE / UTM zone 4N";
-projections[ 3332 ][ 0 ] =  "32405";	projections[ 3332 ][ 1 ] =  "WGS 72BE / UTM zone 5N";
-projections[ 3333 ][ 0 ] =  "32406";	projections[ 3333 ][ 1 ] =  "WGS 72BE / UTM zone 6N";
-projections[ 3334 ][ 0 ] =  "32407";	projections[ 3334 ][ 1 ] =  "WGS 72BE / UTM zone 7N";
-projections[ 3335 ][ 0 ] =  "32408";	projections[ 3335 ][ 1 ] =  "WGS 72BE / UTM zone 8N";
-projections[ 3336 ][ 0 ] =  "32409";	projections[ 3336 ][ 1 ] =  "WGS 72BE / UTM zone 9N";
-projections[ 3337 ][ 0 ] =  "32410";	projections[ 3337 ][ 1 ] =  "WGS 72BE / UTM zone 10N";
-projections[ 3338 ][ 0 ] =  "32411";	projections[ 3338 ][ 1 ] =  "WGS 72BE / UTM zone 11N";
-projections[ 3339 ][ 0 ] =  "32412";	projections[ 3339 ][ 1 ] =  "WGS 72BE / UTM zone 12N";
-projections[ 3340 ][ 0 ] =  "32413";	projections[ 3340 ][ 1 ] =  "WGS 72BE / UTM zone 13N";
-projections[ 3341 ][ 0 ] =  "32414";	projections[ 3341 ][ 1 ] =  "WGS 72BE / UTM zone 14N";
-projections[ 3342 ][ 0 ] =  "32415";	projections[ 3342 ][ 1 ] =  "WGS 72BE / UTM zone 15N";
-projections[ 3343 ][ 0 ] =  "32416";	projections[ 3343 ][ 1 ] =  "WGS 72BE / UTM zone 16N";
-projections[ 3344 ][ 0 ] =  "32417";	projections[ 3344 ][ 1 ] =  "WGS 72BE / UTM zone 17N";
-projections[ 3345 ][ 0 ] =  "32418";	projections[ 3345 ][ 1 ] =  "WGS 72BE / UTM zone 18N";
-projections[ 3346 ][ 0 ] =  "32419";	projections[ 3346 ][ 1 ] =  "WGS 72BE / UTM zone 19N";
-projections[ 3347 ][ 0 ] =  "32420";	projections[ 3347 ][ 1 ] =  "WGS 72BE / UTM zone 20N";
-projections[ 3348 ][ 0 ] =  "32421";	projections[ 3348 ][ 1 ] =  "WGS 72BE / UTM zone 21N";
-projections[ 3349 ][ 0 ] =  "32422";	projections[ 3349 ][ 1 ] =  "WGS 72BE / UTM zone 22N";
-projections[ 3350 ][ 0 ] =  "32423";	projections[ 3350 ][ 1 ] =  "WGS 72BE / UTM zone 23N";
-projections[ 3351 ][ 0 ] =  "32424";	projections[ 3351 ][ 1 ] =  "WGS 72BE / UTM zone 24N";
-projections[ 3352 ][ 0 ] =  "32425";	projections[ 3352 ][ 1 ] =  "WGS 72BE / UTM zone 25N";
-projections[ 3353 ][ 0 ] =  "32426";	projections[ 3353 ][ 1 ] =  "WGS 72BE / UTM zone 26N";
-projections[ 3354 ][ 0 ] =  "32427";	projections[ 3354 ][ 1 ] =  "WGS 72BE / UTM zone 27N";
-projections[ 3355 ][ 0 ] =  "32428";	projections[ 3355 ][ 1 ] =  "WGS 72BE / UTM zone 28N";
-projections[ 3356 ][ 0 ] =  "32429";	projections[ 3356 ][ 1 ] =  "WGS 72BE / UTM zone 29N";
-projections[ 3357 ][ 0 ] =  "32430";	projections[ 3357 ][ 1 ] =  "WGS 72BE / UTM zone 30N";
-projections[ 3358 ][ 0 ] =  "32431";	projections[ 3358 ][ 1 ] =  "WGS 72BE / UTM zone 31N";
-projections[ 3359 ][ 0 ] =  "32432";	projections[ 3359 ][ 1 ] =  "WGS 72BE / UTM zone 32N";
-projections[ 3360 ][ 0 ] =  "32433";	projections[ 3360 ][ 1 ] =  "WGS 72BE / UTM zone 33N";
-projections[ 3361 ][ 0 ] =  "32434";	projections[ 3361 ][ 1 ] =  "WGS 72BE / UTM zone 34N";
-projections[ 3362 ][ 0 ] =  "32435";	projections[ 3362 ][ 1 ] =  "WGS 72BE / UTM zone 35N";
-projections[ 3363 ][ 0 ] =  "32436";	projections[ 3363 ][ 1 ] =  "WGS 72BE / UTM zone 36N";
-projections[ 3364 ][ 0 ] =  "32437";	projections[ 3364 ][ 1 ] =  "WGS 72BE / UTM zone 37N";
-projections[ 3365 ][ 0 ] =  "32438";	projections[ 3365 ][ 1 ] =  "WGS 72BE / UTM zone 38N";
-projections[ 3366 ][ 0 ] =  "32439";	projections[ 3366 ][ 1 ] =  "WGS 72BE / UTM zone 39N";
-projections[ 3367 ][ 0 ] =  "32440";	projections[ 3367 ][ 1 ] =  "WGS 72BE / UTM zone 40N";
-projections[ 3368 ][ 0 ] =  "32441";	projections[ 3368 ][ 1 ] =  "WGS 72BE / UTM zone 41N";
-projections[ 3369 ][ 0 ] =  "32442";	projections[ 3369 ][ 1 ] =  "WGS 72BE / UTM zone 42N";
-projections[ 3370 ][ 0 ] =  "32443";	projections[ 3370 ][ 1 ] =  "WGS 72BE / UTM zone 43N";
-projections[ 3371 ][ 0 ] =  "32444";	projections[ 3371 ][ 1 ] =  "WGS 72BE / UTM zone 44N";
-projections[ 3372 ][ 0 ] =  "32445";	projections[ 3372 ][ 1 ] =  "WGS 72BE / UTM zone 45N";
-projections[ 3373 ][ 0 ] =  "32446";	projections[ 3373 ][ 1 ] =  "WGS 72BE / UTM zone 46N";
-projections[ 3374 ][ 0 ] =  "32447";	projections[ 3374 ][ 1 ] =  "WGS 72BE / UTM zone 47N";
-projections[ 3375 ][ 0 ] =  "32448";	projections[ 3375 ][ 1 ] =  "WGS 72BE / UTM zone 48N";
-projections[ 3376 ][ 0 ] =  "32449";	projections[ 3376 ][ 1 ] =  "WGS 72BE / UTM zone 49N";
-projections[ 3377 ][ 0 ] =  "32450";	projections[ 3377 ][ 1 ] =  "WGS 72BE / UTM zone 50N";
-projections[ 3378 ][ 0 ] =  "32451";	projections[ 3378 ][ 1 ] =  "WGS 72BE / UTM zone 51N";
-projections[ 3379 ][ 0 ] =  "32452";	projections[ 3379 ][ 1 ] =  "WGS 72BE / UTM zone 52N";
-projections[ 3380 ][ 0 ] =  "32453";	projections[ 3380 ][ 1 ] =  "WGS 72BE / UTM zone 53N";
-projections[ 3381 ][ 0 ] =  "32454";	projections[ 3381 ][ 1 ] =  "WGS 72BE / UTM zone 54N";
-projections[ 3382 ][ 0 ] =  "32455";	projections[ 3382 ][ 1 ] =  "WGS 72BE / UTM zone 55N";
-projections[ 3383 ][ 0 ] =  "32456";	projections[ 3383 ][ 1 ] =  "WGS 72BE / UTM zone 56N";
-projections[ 3384 ][ 0 ] =  "32457";	projections[ 3384 ][ 1 ] =  "WGS 72BE / UTM zone 57N";
-projections[ 3385 ][ 0 ] =  "32458";	projections[ 3385 ][ 1 ] =  "WGS 72BE / UTM zone 58N";
-projections[ 3386 ][ 0 ] =  "32459";	projections[ 3386 ][ 1 ] =  "WGS 72BE / UTM zone 59N";
-projections[ 3387 ][ 0 ] =  "32460";	projections[ 3387 ][ 1 ] =  "WGS 72BE / UTM zone 60N";
-projections[ 3388 ][ 0 ] =  "32501";	projections[ 3388 ][ 1 ] =  "WGS 72BE / UTM zone 1S";
-projections[ 3389 ][ 0 ] =  "32502";	projections[ 3389 ][ 1 ] =  "WGS 72BE / UTM zone 2S";
-projections[ 3390 ][ 0 ] =  "32503";	projections[ 3390 ][ 1 ] =  "WGS 72BE / UTM zone 3S";
-projections[ 3391 ][ 0 ] =  "32504";	projections[ 3391 ][ 1 ] =  "WGS 72BE / UTM zone 4S";
-projections[ 3392 ][ 0 ] =  "32505";	projections[ 3392 ][ 1 ] =  "WGS 72BE / UTM zone 5S";
-projections[ 3393 ][ 0 ] =  "32506";	projections[ 3393 ][ 1 ] =  "WGS 72BE / UTM zone 6S";
-projections[ 3394 ][ 0 ] =  "32507";	projections[ 3394 ][ 1 ] =  "WGS 72BE / UTM zone 7S";
-projections[ 3395 ][ 0 ] =  "32508";	projections[ 3395 ][ 1 ] =  "WGS 72BE / UTM zone 8S";
-projections[ 3396 ][ 0 ] =  "32509";	projections[ 3396 ][ 1 ] =  "WGS 72BE / UTM zone 9S";
-projections[ 3397 ][ 0 ] =  "32510";	projections[ 3397 ][ 1 ] =  "WGS 72BE / UTM zone 10S";
-projections[ 3398 ][ 0 ] =  "32511";	projections[ 3398 ][ 1 ] =  "WGS 72BE / UTM zone 11S";
-projections[ 3399 ][ 0 ] =  "32512";	projections[ 3399 ][ 1 ] =  "WGS 72BE / UTM zone 12S";
-projections[ 3400 ][ 0 ] =  "32513";	projections[ 3400 ][ 1 ] =  "WGS 72BE / UTM zone 13S";
-projections[ 3401 ][ 0 ] =  "32514";	projections[ 3401 ][ 1 ] =  "WGS 72BE / UTM zone 14S";
-projections[ 3402 ][ 0 ] =  "32515";	projections[ 3402 ][ 1 ] =  "WGS 72BE / UTM zone 15S";
-projections[ 3403 ][ 0 ] =  "32516";	projections[ 3403 ][ 1 ] =  "WGS 72BE / UTM zone 16S";
-projections[ 3404 ][ 0 ] =  "32517";	projections[ 3404 ][ 1 ] =  "WGS 72BE / UTM zone 17S";
-projections[ 3405 ][ 0 ] =  "32518";	projections[ 3405 ][ 1 ] =  "WGS 72BE / UTM zone 18S";
-projections[ 3406 ][ 0 ] =  "32519";	projections[ 3406 ][ 1 ] =  "WGS 72BE / UTM zone 19S";
-projections[ 3407 ][ 0 ] =  "32520";	projections[ 3407 ][ 1 ] =  "WGS 72BE / UTM zone 20S";
-projections[ 3408 ][ 0 ] =  "32521";	projections[ 3408 ][ 1 ] =  "WGS 72BE / UTM zone 21S";
-projections[ 3409 ][ 0 ] =  "32522";	projections[ 3409 ][ 1 ] =  "WGS 72BE / UTM zone 22S";
-projections[ 3410 ][ 0 ] =  "32523";	projections[ 3410 ][ 1 ] =  "WGS 72BE / UTM zone 23S";
-projections[ 3411 ][ 0 ] =  "32524";	projections[ 3411 ][ 1 ] =  "WGS 72BE / UTM zone 24S";
-projections[ 3412 ][ 0 ] =  "32525";	projections[ 3412 ][ 1 ] =  "WGS 72BE / UTM zone 25S";
-projections[ 3413 ][ 0 ] =  "32526";	projections[ 3413 ][ 1 ] =  "WGS 72BE / UTM zone 26S";
-projections[ 3414 ][ 0 ] =  "32527";	projections[ 3414 ][ 1 ] =  "WGS 72BE / UTM zone 27S";
-projections[ 3415 ][ 0 ] =  "32528";	projections[ 3415 ][ 1 ] =  "WGS 72BE / UTM zone 28S";
-projections[ 3416 ][ 0 ] =  "32529";	projections[ 3416 ][ 1 ] =  "WGS 72BE / UTM zone 29S";
-projections[ 3417 ][ 0 ] =  "32530";	projections[ 3417 ][ 1 ] =  "WGS 72BE / UTM zone 30S";
-projections[ 3418 ][ 0 ] =  "32531";	projections[ 3418 ][ 1 ] =  "WGS 72BE / UTM zone 31S";
-projections[ 3419 ][ 0 ] =  "32532";	projections[ 3419 ][ 1 ] =  "WGS 72BE / UTM zone 32S";
-projections[ 3420 ][ 0 ] =  "32533";	projections[ 3420 ][ 1 ] =  "WGS 72BE / UTM zone 33S";
-projections[ 3421 ][ 0 ] =  "32534";	projections[ 3421 ][ 1 ] =  "WGS 72BE / UTM zone 34S";
-projections[ 3422 ][ 0 ] =  "32535";	projections[ 3422 ][ 1 ] =  "WGS 72BE / UTM zone 35S";
-projections[ 3423 ][ 0 ] =  "32536";	projections[ 3423 ][ 1 ] =  "WGS 72BE / UTM zone 36S";
-projections[ 3424 ][ 0 ] =  "32537";	projections[ 3424 ][ 1 ] =  "WGS 72BE / UTM zone 37S";
-projections[ 3425 ][ 0 ] =  "32538";	projections[ 3425 ][ 1 ] =  "WGS 72BE / UTM zone 38S";
-projections[ 3426 ][ 0 ] =  "32539";	projections[ 3426 ][ 1 ] =  "WGS 72BE / UTM zone 39S";
-projections[ 3427 ][ 0 ] =  "32540";	projections[ 3427 ][ 1 ] =  "WGS 72BE / UTM zone 40S";
-projections[ 3428 ][ 0 ] =  "32541";	projections[ 3428 ][ 1 ] =  "WGS 72BE / UTM zone 41S";
-projections[ 3429 ][ 0 ] =  "32542";	projections[ 3429 ][ 1 ] =  "WGS 72BE / UTM zone 42S";
-projections[ 3430 ][ 0 ] =  "32543";	projections[ 3430 ][ 1 ] =  "WGS 72BE / UTM zone 43S";
-projections[ 3431 ][ 0 ] =  "32544";	projections[ 3431 ][ 1 ] =  "WGS 72BE / UTM zone 44S";
-projections[ 3432 ][ 0 ] =  "32545";	projections[ 3432 ][ 1 ] =  "WGS 72BE / UTM zone 45S";
-projections[ 3433 ][ 0 ] =  "32546";	projections[ 3433 ][ 1 ] =  "WGS 72BE / UTM zone 46S";
-projections[ 3434 ][ 0 ] =  "32547";	projections[ 3434 ][ 1 ] =  "WGS 72BE / UTM zone 47S";
-projections[ 3435 ][ 0 ] =  "32548";	projections[ 3435 ][ 1 ] =  "WGS 72BE / UTM zone 48S";
-projections[ 3436 ][ 0 ] =  "32549";	projections[ 3436 ][ 1 ] =  "WGS 72BE / UTM zone 49S";
-projections[ 3437 ][ 0 ] =  "32550";	projections[ 3437 ][ 1 ] =  "WGS 72BE / UTM zone 50S";
-projections[ 3438 ][ 0 ] =  "32551";	projections[ 3438 ][ 1 ] =  "WGS 72BE / UTM zone 51S";
-projections[ 3439 ][ 0 ] =  "32552";	projections[ 3439 ][ 1 ] =  "WGS 72BE / UTM zone 52S";
-projections[ 3440 ][ 0 ] =  "32553";	projections[ 3440 ][ 1 ] =  "WGS 72BE / UTM zone 53S";
-projections[ 3441 ][ 0 ] =  "32554";	projections[ 3441 ][ 1 ] =  "WGS 72BE / UTM zone 54S";
-projections[ 3442 ][ 0 ] =  "32555";	projections[ 3442 ][ 1 ] =  "WGS 72BE / UTM zone 55S";
-projections[ 3443 ][ 0 ] =  "32556";	projections[ 3443 ][ 1 ] =  "WGS 72BE / UTM zone 56S";
-projections[ 3444 ][ 0 ] =  "32557";	projections[ 3444 ][ 1 ] =  "WGS 72BE / UTM zone 57S";
-projections[ 3445 ][ 0 ] =  "32558";	projections[ 3445 ][ 1 ] =  "WGS 72BE / UTM zone 58S";
-projections[ 3446 ][ 0 ] =  "32559";	projections[ 3446 ][ 1 ] =  "WGS 72BE / UTM zone 59S";
-projections[ 3447 ][ 0 ] =  "32560";	projections[ 3447 ][ 1 ] =  "WGS 72BE / UTM zone 60S";
-projections[ 3448 ][ 0 ] =  "32600";	projections[ 3448 ][ 1 ] =  "WGS 84 / UTM grid system (northern hemisphere)";
-projections[ 3449 ][ 0 ] =  "32601";	projections[ 3449 ][ 1 ] =  "WGS 84 / UTM zone 1N";
-projections[ 3450 ][ 0 ] =  "32602";	projections[ 3450 ][ 1 ] =  "WGS 84 / UTM zone 2N";
-projections[ 3451 ][ 0 ] =  "32603";	projections[ 3451 ][ 1 ] =  "WGS 84 / UTM zone 3N";
-projections[ 3452 ][ 0 ] =  "32604";	projections[ 3452 ][ 1 ] =  "WGS 84 / UTM zone 4N";
-projections[ 3453 ][ 0 ] =  "32605";	projections[ 3453 ][ 1 ] =  "WGS 84 / UTM zone 5N";
-projections[ 3454 ][ 0 ] =  "32606";	projections[ 3454 ][ 1 ] =  "WGS 84 / UTM zone 6N";
-projections[ 3455 ][ 0 ] =  "32607";	projections[ 3455 ][ 1 ] =  "WGS 84 / UTM zone 7N";
-projections[ 3456 ][ 0 ] =  "32608";	projections[ 3456 ][ 1 ] =  "WGS 84 / UTM zone 8N";
-projections[ 3457 ][ 0 ] =  "32609";	projections[ 3457 ][ 1 ] =  "WGS 84 / UTM zone 9N";
-projections[ 3458 ][ 0 ] =  "32610";	projections[ 3458 ][ 1 ] =  "WGS 84 / UTM zone 10N";
-projections[ 3459 ][ 0 ] =  "32611";	projections[ 3459 ][ 1 ] =  "WGS 84 / UTM zone 11N";
-projections[ 3460 ][ 0 ] =  "32612";	projections[ 3460 ][ 1 ] =  "WGS 84 / UTM zone 12N";
-projections[ 3461 ][ 0 ] =  "32613";	projections[ 3461 ][ 1 ] =  "WGS 84 / UTM zone 13N";
-projections[ 3462 ][ 0 ] =  "32614";	projections[ 3462 ][ 1 ] =  "WGS 84 / UTM zone 14N";
-projections[ 3463 ][ 0 ] =  "32615";	projections[ 3463 ][ 1 ] =  "WGS 84 / UTM zone 15N";
-projections[ 3464 ][ 0 ] =  "32616";	projections[ 3464 ][ 1 ] =  "WGS 84 / UTM zone 16N";
-projections[ 3465 ][ 0 ] =  "32617";	projections[ 3465 ][ 1 ] =  "WGS 84 / UTM zone 17N";
-projections[ 3466 ][ 0 ] =  "32618";	projections[ 3466 ][ 1 ] =  "WGS 84 / UTM zone 18N";
-projections[ 3467 ][ 0 ] =  "32619";	projections[ 3467 ][ 1 ] =  "WGS 84 / UTM zone 19N";
-projections[ 3468 ][ 0 ] =  "32620";	projections[ 3468 ][ 1 ] =  "WGS 84 / UTM zone 20N";
-projections[ 3469 ][ 0 ] =  "32621";	projections[ 3469 ][ 1 ] =  "WGS 84 / UTM zone 21N";
-projections[ 3470 ][ 0 ] =  "32622";	projections[ 3470 ][ 1 ] =  "WGS 84 / UTM zone 22N";
-projections[ 3471 ][ 0 ] =  "32623";	projections[ 3471 ][ 1 ] =  "WGS 84 / UTM zone 23N";
-projections[ 3472 ][ 0 ] =  "32624";	projections[ 3472 ][ 1 ] =  "WGS 84 / UTM zone 24N";
-projections[ 3473 ][ 0 ] =  "32625";	projections[ 3473 ][ 1 ] =  "WGS 84 / UTM zone 25N";
-projections[ 3474 ][ 0 ] =  "32626";	projections[ 3474 ][ 1 ] =  "WGS 84 / UTM zone 26N";
-projections[ 3475 ][ 0 ] =  "32627";	projections[ 3475 ][ 1 ] =  "WGS 84 / UTM zone 27N";
-projections[ 3476 ][ 0 ] =  "32628";	projections[ 3476 ][ 1 ] =  "WGS 84 / UTM zone 28N";
-projections[ 3477 ][ 0 ] =  "32629";	projections[ 3477 ][ 1 ] =  "WGS 84 / UTM zone 29N";
-projections[ 3478 ][ 0 ] =  "32630";	projections[ 3478 ][ 1 ] =  "WGS 84 / UTM zone 30N";
-projections[ 3479 ][ 0 ] =  "32631";	projections[ 3479 ][ 1 ] =  "WGS 84 / UTM zone 31N";
-projections[ 3480 ][ 0 ] =  "32632";	projections[ 3480 ][ 1 ] =  "WGS 84 / UTM zone 32N";
-projections[ 3481 ][ 0 ] =  "32633";	projections[ 3481 ][ 1 ] =  "WGS 84 / UTM zone 33N";
-projections[ 3482 ][ 0 ] =  "32634";	projections[ 3482 ][ 1 ] =  "WGS 84 / UTM zone 34N";
-projections[ 3483 ][ 0 ] =  "32635";	projections[ 3483 ][ 1 ] =  "WGS 84 / UTM zone 35N";
-projections[ 3484 ][ 0 ] =  "32636";	projections[ 3484 ][ 1 ] =  "WGS 84 / UTM zone 36N";
-projections[ 3485 ][ 0 ] =  "32637";	projections[ 3485 ][ 1 ] =  "WGS 84 / UTM zone 37N";
-projections[ 3486 ][ 0 ] =  "32638";	projections[ 3486 ][ 1 ] =  "WGS 84 / UTM zone 38N";
-projections[ 3487 ][ 0 ] =  "32639";	projections[ 3487 ][ 1 ] =  "WGS 84 / UTM zone 39N";
-projections[ 3488 ][ 0 ] =  "32640";	projections[ 3488 ][ 1 ] =  "WGS 84 / UTM zone 40N";
-projections[ 3489 ][ 0 ] =  "32641";	projections[ 3489 ][ 1 ] =  "WGS 84 / UTM zone 41N";
-projections[ 3490 ][ 0 ] =  "32642";	projections[ 3490 ][ 1 ] =  "WGS 84 / UTM zone 42N";
-projections[ 3491 ][ 0 ] =  "32643";	projections[ 3491 ][ 1 ] =  "WGS 84 / UTM zone 43N";
-projections[ 3492 ][ 0 ] =  "32644";	projections[ 3492 ][ 1 ] =  "WGS 84 / UTM zone 44N";
-projections[ 3493 ][ 0 ] =  "32645";	projections[ 3493 ][ 1 ] =  "WGS 84 / UTM zone 45N";
-projections[ 3494 ][ 0 ] =  "32646";	projections[ 3494 ][ 1 ] =  "WGS 84 / UTM zone 46N";
-projections[ 3495 ][ 0 ] =  "32647";	projections[ 3495 ][ 1 ] =  "WGS 84 / UTM zone 47N";
-projections[ 3496 ][ 0 ] =  "32648";	projections[ 3496 ][ 1 ] =  "WGS 84 / UTM zone 48N";
-projections[ 3497 ][ 0 ] =  "32649";	projections[ 3497 ][ 1 ] =  "WGS 84 / UTM zone 49N";
-projections[ 3498 ][ 0 ] =  "32650";	projections[ 3498 ][ 1 ] =  "WGS 84 / UTM zone 50N";
-projections[ 3499 ][ 0 ] =  "32651";	projections[ 3499 ][ 1 ] =  "WGS 84 / UTM zone 51N";
-projections[ 3500 ][ 0 ] =  "32652";	projections[ 3500 ][ 1 ] =  "WGS 84 / UTM zone 52N";
-projections[ 3501 ][ 0 ] =  "32653";	projections[ 3501 ][ 1 ] =  "WGS 84 / UTM zone 53N";
-projections[ 3502 ][ 0 ] =  "32654";	projections[ 3502 ][ 1 ] =  "WGS 84 / UTM zone 54N";
-projections[ 3503 ][ 0 ] =  "32655";	projections[ 3503 ][ 1 ] =  "WGS 84 / UTM zone 55N";
-projections[ 3504 ][ 0 ] =  "32656";	projections[ 3504 ][ 1 ] =  "WGS 84 / UTM zone 56N";
-projections[ 3505 ][ 0 ] =  "32657";	projections[ 3505 ][ 1 ] =  "WGS 84 / UTM zone 57N";
-projections[ 3506 ][ 0 ] =  "32658";	projections[ 3506 ][ 1 ] =  "WGS 84 / UTM zone 58N";
-projections[ 3507 ][ 0 ] =  "32659";	projections[ 3507 ][ 1 ] =  "WGS 84 / UTM zone 59N";
-projections[ 3508 ][ 0 ] =  "32660";	projections[ 3508 ][ 1 ] =  "WGS 84 / UTM zone 60N";
-projections[ 3509 ][ 0 ] =  "32661";	projections[ 3509 ][ 1 ] =  "WGS 84 / UPS North";
-projections[ 3510 ][ 0 ] =  "32662";	projections[ 3510 ][ 1 ] =  "WGS 84 / Plate Carree";
-projections[ 3511 ][ 0 ] =  "32664";	projections[ 3511 ][ 1 ] =  "WGS 84 / BLM 14N (ftUS)";
-projections[ 3512 ][ 0 ] =  "32665";	projections[ 3512 ][ 1 ] =  "WGS 84 / BLM 15N (ftUS)";
-projections[ 3513 ][ 0 ] =  "32666";	projections[ 3513 ][ 1 ] =  "WGS 84 / BLM 16N (ftUS)";
-projections[ 3514 ][ 0 ] =  "32667";	projections[ 3514 ][ 1 ] =  "WGS 84 / BLM 17N (ftUS)";
-projections[ 3515 ][ 0 ] =  "32700";	projections[ 3515 ][ 1 ] =  "WGS 84 / UTM grid system (southern hemisphere)";
-projections[ 3516 ][ 0 ] =  "32701";	projections[ 3516 ][ 1 ] =  "WGS 84 / UTM zone 1S";
-projections[ 3517 ][ 0 ] =  "32702";	projections[ 3517 ][ 1 ] =  "WGS 84 / UTM zone 2S";
-projections[ 3518 ][ 0 ] =  "32703";	projections[ 3518 ][ 1 ] =  "WGS 84 / UTM zone 3S";
-projections[ 3519 ][ 0 ] =  "32704";	projections[ 3519 ][ 1 ] =  "WGS 84 / UTM zone 4S";
-projections[ 3520 ][ 0 ] =  "32705";	projections[ 3520 ][ 1 ] =  "WGS 84 / UTM zone 5S";
-projections[ 3521 ][ 0 ] =  "32706";	projections[ 3521 ][ 1 ] =  "WGS 84 / UTM zone 6S";
-projections[ 3522 ][ 0 ] =  "32707";	projections[ 3522 ][ 1 ] =  "WGS 84 / UTM zone 7S";
-projections[ 3523 ][ 0 ] =  "32708";	projections[ 3523 ][ 1 ] =  "WGS 84 / UTM zone 8S";
-projections[ 3524 ][ 0 ] =  "32709";	projections[ 3524 ][ 1 ] =  "WGS 84 / UTM zone 9S";
-projections[ 3525 ][ 0 ] =  "32710";	projections[ 3525 ][ 1 ] =  "WGS 84 / UTM zone 10S";
-projections[ 3526 ][ 0 ] =  "32711";	projections[ 3526 ][ 1 ] =  "WGS 84 / UTM zone 11S";
-projections[ 3527 ][ 0 ] =  "32712";	projections[ 3527 ][ 1 ] =  "WGS 84 / UTM zone 12S";
-projections[ 3528 ][ 0 ] =  "32713";	projections[ 3528 ][ 1 ] =  "WGS 84 / UTM zone 13S";
-projections[ 3529 ][ 0 ] =  "32714";	projections[ 3529 ][ 1 ] =  "WGS 84 / UTM zone 14S";
-projections[ 3530 ][ 0 ] =  "32715";	projections[ 3530 ][ 1 ] =  "WGS 84 / UTM zone 15S";
-projections[ 3531 ][ 0 ] =  "32716";	projections[ 3531 ][ 1 ] =  "WGS 84 / UTM zone 16S";
-projections[ 3532 ][ 0 ] =  "32717";	projections[ 3532 ][ 1 ] =  "WGS 84 / UTM zone 17S";
-projections[ 3533 ][ 0 ] =  "32718";	projections[ 3533 ][ 1 ] =  "WGS 84 / UTM zone 18S";
-projections[ 3534 ][ 0 ] =  "32719";	projections[ 3534 ][ 1 ] =  "WGS 84 / UTM zone 19S";
-projections[ 3535 ][ 0 ] =  "32720";	projections[ 3535 ][ 1 ] =  "WGS 84 / UTM zone 20S";
-projections[ 3536 ][ 0 ] =  "32721";	projections[ 3536 ][ 1 ] =  "WGS 84 / UTM zone 21S";
-projections[ 3537 ][ 0 ] =  "32722";	projections[ 3537 ][ 1 ] =  "WGS 84 / UTM zone 22S";
-projections[ 3538 ][ 0 ] =  "32723";	projections[ 3538 ][ 1 ] =  "WGS 84 / UTM zone 23S";
-projections[ 3539 ][ 0 ] =  "32724";	projections[ 3539 ][ 1 ] =  "WGS 84 / UTM zone 24S";
-projections[ 3540 ][ 0 ] =  "32725";	projections[ 3540 ][ 1 ] =  "WGS 84 / UTM zone 25S";
-projections[ 3541 ][ 0 ] =  "32726";	projections[ 3541 ][ 1 ] =  "WGS 84 / UTM zone 26S";
-projections[ 3542 ][ 0 ] =  "32727";	projections[ 3542 ][ 1 ] =  "WGS 84 / UTM zone 27S";
-projections[ 3543 ][ 0 ] =  "32728";	projections[ 3543 ][ 1 ] =  "WGS 84 / UTM zone 28S";
-projections[ 3544 ][ 0 ] =  "32729";	projections[ 3544 ][ 1 ] =  "WGS 84 / UTM zone 29S";
-projections[ 3545 ][ 0 ] =  "32730";	projections[ 3545 ][ 1 ] =  "WGS 84 / UTM zone 30S";
-projections[ 3546 ][ 0 ] =  "32731";	projections[ 3546 ][ 1 ] =  "WGS 84 / UTM zone 31S";
-projections[ 3547 ][ 0 ] =  "32732";	projections[ 3547 ][ 1 ] =  "WGS 84 / UTM zone 32S";
-projections[ 3548 ][ 0 ] =  "32733";	projections[ 3548 ][ 1 ] =  "WGS 84 / UTM zone 33S";
-projections[ 3549 ][ 0 ] =  "32734";	projections[ 3549 ][ 1 ] =  "WGS 84 / UTM zone 34S";
-projections[ 3550 ][ 0 ] =  "32735";	projections[ 3550 ][ 1 ] =  "WGS 84 / UTM zone 35S";
-projections[ 3551 ][ 0 ] =  "32736";	projections[ 3551 ][ 1 ] =  "WGS 84 / UTM zone 36S";
-projections[ 3552 ][ 0 ] =  "32737";	projections[ 3552 ][ 1 ] =  "WGS 84 / UTM zone 37S";
-projections[ 3553 ][ 0 ] =  "32738";	projections[ 3553 ][ 1 ] =  "WGS 84 / UTM zone 38S";
-projections[ 3554 ][ 0 ] =  "32739";	projections[ 3554 ][ 1 ] =  "WGS 84 / UTM zone 39S";
-projections[ 3555 ][ 0 ] =  "32740";	projections[ 3555 ][ 1 ] =  "WGS 84 / UTM zone 40S";
-projections[ 3556 ][ 0 ] =  "32741";	projections[ 3556 ][ 1 ] =  "WGS 84 / UTM zone 41S";
-projections[ 3557 ][ 0 ] =  "32742";	projections[ 3557 ][ 1 ] =  "WGS 84 / UTM zone 42S";
-projections[ 3558 ][ 0 ] =  "32743";	projections[ 3558 ][ 1 ] =  "WGS 84 / UTM zone 43S";
-projections[ 3559 ][ 0 ] =  "32744";	projections[ 3559 ][ 1 ] =  "WGS 84 / UTM zone 44S";
-projections[ 3560 ][ 0 ] =  "32745";	projections[ 3560 ][ 1 ] =  "WGS 84 / UTM zone 45S";
-projections[ 3561 ][ 0 ] =  "32746";	projections[ 3561 ][ 1 ] =  "WGS 84 / UTM zone 46S";
-projections[ 3562 ][ 0 ] =  "32747";	projections[ 3562 ][ 1 ] =  "WGS 84 / UTM zone 47S";
-projections[ 3563 ][ 0 ] =  "32748";	projections[ 3563 ][ 1 ] =  "WGS 84 / UTM zone 48S";
-projections[ 3564 ][ 0 ] =  "32749";	projections[ 3564 ][ 1 ] =  "WGS 84 / UTM zone 49S";
-projections[ 3565 ][ 0 ] =  "32750";	projections[ 3565 ][ 1 ] =  "WGS 84 / UTM zone 50S";
-projections[ 3566 ][ 0 ] =  "32751";	projections[ 3566 ][ 1 ] =  "WGS 84 / UTM zone 51S";
-projections[ 3567 ][ 0 ] =  "32752";	projections[ 3567 ][ 1 ] =  "WGS 84 / UTM zone 52S";
-projections[ 3568 ][ 0 ] =  "32753";	projections[ 3568 ][ 1 ] =  "WGS 84 / UTM zone 53S";
-projections[ 3569 ][ 0 ] =  "32754";	projections[ 3569 ][ 1 ] =  "WGS 84 / UTM zone 54S";
-projections[ 3570 ][ 0 ] =  "32755";	projections[ 3570 ][ 1 ] =  "WGS 84 / UTM zone 55S";
-projections[ 3571 ][ 0 ] =  "32756";	projections[ 3571 ][ 1 ] =  "WGS 84 / UTM zone 56S";
-projections[ 3572 ][ 0 ] =  "32757";	projections[ 3572 ][ 1 ] =  "WGS 84 / UTM zone 57S";
-projections[ 3573 ][ 0 ] =  "32758";	projections[ 3573 ][ 1 ] =  "WGS 84 / UTM zone 58S";
-projections[ 3574 ][ 0 ] =  "32759";	projections[ 3574 ][ 1 ] =  "WGS 84 / UTM zone 59S";
-projections[ 3575 ][ 0 ] =  "32760";	projections[ 3575 ][ 1 ] =  "WGS 84 / UTM zone 60S";
-projections[ 3576 ][ 0 ] =  "32761";	projections[ 3576 ][ 1 ] =  "WGS 84 / UPS South";
-projections[ 3577 ][ 0 ] =  "32766";	projections[ 3577 ][ 1 ] =  "WGS 84 / TM 36 SE";
+#endif
@@ -0,0 +1,165 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Job.h
+ *	\brief Conversion job
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef JOB
+#define JOB
+
+#include "../inc/Ogr.h"
+
+#include <QtCore>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+ *	\class Job
+ *	\brief Conversion job
+ *	\author Olivier Pilotte
+ *
+ *	Converts one source into one target with its own Ogr instance, so jobs
+ *	can run concurrently on a thread pool. Progress and completion are sent
+ *	as signals. Progress is coalesced : at most every 50 ms, or every
+ *	50000 features if that comes first.
+ */
+class Job : public QObject, public QRunnable
+{
+	Q_OBJECT
+
+	private:
+
+		Ogr *ogr;
+
+		int index;
+
+		QString source;
+		QString target;
+		QString driver;
+		QString query;
+
+		int projection;
+
+		bool update;
+
+		QAtomicInt canceled;
+
+		double elapsed;
+
+		int total;
+		int percent;
+
+		int count;
+		int reported;
+		int reportedTime;
+
+		QTime clock;
+
+		/*!
+		 *	\fn static bool Progress( int count, void *data );
+		 *	\brief Conversion progress callback
+		 *	\param count : processed features
+		 *	\param data : job
+		 *	\returns true to continue
+		 */
+		static bool Progress( int count, void *data );
+
+		/*!
+		 *	\fn QStringList Stages( void );
+		 *	\brief Stage times and feature counters of the engine
+		 *	\returns report lines
+		 */
+		QStringList Stages( void );
+
+	signals:
+
+		void progress( int index, int count, int percent );
+
+		void finished( int index, bool success, QString message );
+
+	public:
+
+		/*!
+		 *	\fn Job( int index, QString source, QString target, QString driver, int projection = 0 );
+		 *	\brief Constructor
+		 *	\param index : job number
+		 *	\param source : source name
+		 *	\param target : target name
+		 *	\param driver : target driver
+		 *	\param projection : target epsg code
+		 */
+		Job( int index, QString source, QString target, QString driver, int projection = 0 );
+
+		/*!
+		 *	\fn ~Job( void );
+		 *	\brief Destructor
+		 */
+		~Job( void );
+
+		/*!
+		 *	\fn void run( void );
+		 *	\brief Runs conversion
+		 */
+		void run( void );
+
+		/*!
+		 *	\fn Ogr *GetOgr( void );
+		 *	\brief Job engine, to be configured before the job starts
+		 *	\returns Ogr instance
+		 */
+		Ogr *GetOgr( void );
+
+		/*!
+		 *	\fn void SetQuery( QString sql );
+		 *	\brief Sets source query
+		 *	\param sql : sql query
+		 */
+		void SetQuery( QString sql );
+
+		/*!
+		 *	\fn void SetUpdate( bool mode );
+		 *	\brief Writes into existing target instead of overwriting it
+		 *	\param mode : update mode
+		 */
+		void SetUpdate( bool mode );
+
+		/*!
+		 *	\fn double GetElapsed( void );
+		 *	\brief Wall time of last run
+		 *	\returns seconds
+		 */
+		double GetElapsed( void );
+
+		/*!
+		 *	\fn void Cancel( void );
+		 *	\brief Stops the job at its next feature, may be called from any thread
+		 */
+		void Cancel( void );
+};
+
+QT_END_NAMESPACE
+
+#endif
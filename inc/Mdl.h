@@ -0,0 +1,78 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Mdl.h
+ *	\brief Projection list model
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef MDL
+#define MDL
+
+#include <QtGui>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+ *	\class Mdl
+ *	\brief Projection list model
+ *	\author Olivier Pilotte
+ *
+ *	Rows of the static projection table, row 0 being no projection. Texts
+ *	are only built when a view asks for them.
+ */
+class Mdl : public QAbstractListModel
+{
+	Q_OBJECT
+
+	public :
+
+		/*!
+		 *	\fn Mdl( QObject *parent = 0 );
+		 *	\brief Constructor
+		 *	\param parent : owner
+		 */
+		Mdl( QObject *parent = 0 );
+
+		/*!
+		 *	\fn int rowCount( const QModelIndex &parent = QModelIndex() ) const;
+		 *	\brief Number of projections
+		 *	\param parent : unused, the model is a flat list
+		 *	\returns rows
+		 */
+		int rowCount( const QModelIndex &parent = QModelIndex() ) const;
+
+		/*!
+		 *	\fn QVariant data( const QModelIndex &index, int role = Qt::DisplayRole ) const;
+		 *	\brief Text of a projection
+		 *	\param index : row
+		 *	\param role : display and edit roles give "code : name", user role the code
+		 *	\returns value
+		 */
+		QVariant data( const QModelIndex &index, int role = Qt::DisplayRole ) const;
+};
+
+QT_END_NAMESPACE
+
+#endif
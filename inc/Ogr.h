@@ -32,12 +32,31 @@
 
 #include "sys/types.h"
 #include "sys/stat.h"
+#include "sys/time.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+
+#include "../inc/Que.h"
+#include "../inc/Prj.h"
 
 #include <string>
+#include <vector>
+#include <map>
+#include <set>
 
 using std::string;
+using std::vector;
+using std::map;
+using std::pair;
+using std::set;
+
+/*!
+ *	\typedef bool ( *OgrProgress )( int count, void *data );
+ *	\brief Progress callback, returns false to stop conversion
+ */
+typedef bool ( *OgrProgress )( int count, void *data );
 
 /*!
  *	\class Ogr
@@ -47,8 +66,100 @@ using std::string;
 
 class Ogr
 {
+	public :
+
+		/*!
+		 *	\enum Count
+		 *	\brief Feature count strategies
+		 */
+		enum Count
+		{
+			COUNT_EXACT,	/*!< counts every feature, may scan the whole source */
+			COUNT_FAST,		/*!< uses the driver count only when it is cheap */
+			COUNT_ESTIMATE,	/*!< cheap count, or estimated from source size */
+			COUNT_NONE		/*!< no count */
+		};
+
+		/*!
+		 *	\enum Fields
+		 *	\brief Field selection modes
+		 */
+		enum Fields
+		{
+			FIELDS_ALL,			/*!< geometry and every attribute */
+			FIELDS_SELECTED,	/*!< geometry and selected attributes */
+			FIELDS_GEOMETRY,	/*!< geometry only */
+			FIELDS_ATTRIBUTES	/*!< attributes only */
+		};
+
+		/*!
+		 *	\enum Stage
+		 *	\brief Instrumented conversion stages
+		 */
+		enum Stage
+		{
+			STAGE_OPEN,			/*!< source and target opening */
+			STAGE_PREPARE,		/*!< query, schema creation and counting */
+			STAGE_READ,			/*!< source reading */
+			STAGE_TRANSFORM,	/*!< reprojection and dimension coercion */
+			STAGE_WRITE,		/*!< target writing and commits */
+			STAGE_COUNT
+		};
+
+		/*!
+		 *	\struct Stats
+		 *	\brief Conversion instrumentation
+		 *
+		 *	Wall times add up the time spent in each stage. Pipelined stages
+		 *	run on their own threads and get their exact cpu time, serial runs
+		 *	share their cpu time between read, transform and write by wall time.
+		 */
+		struct Stats
+		{
+			double wall[ STAGE_COUNT ];
+			double cpu[ STAGE_COUNT ];
+
+			long read;
+			long written;
+			long failed;
+
+			double bytes;
+		};
+
 	private :
 
+		/*!
+		 *	\struct Layer
+		 *	\brief Cached description of a source layer
+		 */
+		struct Layer
+		{
+			OGRwkbGeometryType geometry;
+
+			string epsg;
+
+			vector<string> fieldNames;
+			vector<OGRFieldType> fieldTypes;
+
+			// driver count of the unfiltered layer, -1 if unknown
+			int count;
+		};
+
+		/*!
+		 *	\struct Source
+		 *	\brief Cached description of a source
+		 */
+		struct Source
+		{
+			vector<string> layers;
+
+			map<string, Layer> described;
+		};
+
+		// sources probed or converted by the process, by Key
+		static CPLMutex *sourceMutex;
+		static map<string, Source> sources;
+
 		OGRSFDriverH formatDriver;
 
 		OGRDataSourceH sourceData;
@@ -61,17 +172,311 @@ class Ogr
 		OGRSpatialReferenceH sourceSRS;
 		OGRSpatialReferenceH targetSRS;
 
+		OGRCoordinateTransformationH transform;
+		OGRSpatialReferenceH layerSRS;
+
+		// closed form replacement of transform, shared by workers
+		Prj *fastTransform;
+
 		OGRFeatureDefnH sourceLayerDefn;
 		OGRwkbGeometryType sourceLayerGeom;
 
 		OGRGeometryH sourceGeom;
 
+		OGRGeometryH extentGeom;
+		bool extentTarget;
+
 		string sourceName;
+		string sourceKey;
 		string sourceLayerName;
+		string sourceLayerRequest;
 		string targetName;
 
+		// target layer opened for append or resume, its fields already exist
+		bool targetUpdate;
+
 		string error;
 
+		double processTime;
+		double transformTime;
+
+		int groupSize;
+		int groupCount;
+		bool transaction;
+
+		// a failed commit stops the run
+		bool aborted;
+
+		int commitCount;
+		double commitTime;
+
+		Stats stats;
+
+		string checkpointName;
+		int checkpointSize;
+		int checkpointCount;
+		long checkpointFid;
+		bool resume;
+		long resumeCount;
+		long writtenCount;
+		bool complete;
+
+		int dimension;
+
+		int countStrategy;
+
+		int fieldMode;
+		vector<string> selectedFields;
+		vector<int> fieldMap;
+
+		vector<string> queryFields;
+		bool queryFiltered;
+
+		string plan;
+
+		int threads;
+		size_t memoryBudget;
+
+		Que *readQueue;
+		Que *writeQueue;
+
+		OgrProgress progress;
+		void *progressData;
+
+		// features transformed per batch
+		const static int batchSize = 256;
+
+		/*!
+		 *	\struct Batch
+		 *	\brief Coordinate arrays of a batch of features, reused between batches
+		 */
+		struct Batch
+		{
+			vector<OGRGeometryH> parts;
+			vector<int> owners;
+			vector<int> offsets;
+
+			vector<double> x;
+			vector<double> y;
+			vector<double> z;
+
+			vector<int> success;
+			vector<bool> failed;
+		};
+
+		Batch batch;
+
+		/*!
+		 *	\struct Worker
+		 *	\brief Transform worker state
+		 */
+		struct Worker
+		{
+			Ogr *ogr;
+
+			Batch batch;
+
+			OGRCoordinateTransformationH transform;
+
+			double transformTime;
+
+			double wall;
+			double cpu;
+
+			long failed;
+
+			// sequence numbers of the features failing to transform
+			vector<long> failures;
+
+			CPLJoinableThread *thread;
+		};
+
+		/*!
+		 *	\fn double Clock( void );
+		 *	\brief Wall clock
+		 *	\returns seconds
+		 */
+		static double Clock( void );
+
+		/*!
+		 *	\fn double CpuClock( void );
+		 *	\brief Cpu time of the calling thread
+		 *	\returns seconds
+		 */
+		static double CpuClock( void );
+
+		/*!
+		 *	\fn void Measure( int stage, double wall, double cpu );
+		 *	\brief Adds the time elapsed since wall and cpu to a stage
+		 *	\param stage : Stage value
+		 *	\param wall : wall clock at stage start
+		 *	\param cpu : cpu clock at stage start
+		 */
+		void Measure( int stage, double wall, double cpu );
+
+		/*!
+		 *	\fn static string Json( string text );
+		 *	\brief Quotes a json string
+		 *	\param text : text
+		 *	\returns quoted text
+		 */
+		static string Json( string text );
+
+		/*!
+		 *	\fn bool Commit( bool restart );
+		 *	\brief Commits pending target transaction
+		 *	\param restart : starts a new transaction after commit
+		 *	\returns true on success
+		 */
+		bool Commit( bool restart );
+
+		/*!
+		 *	\fn static void Collect( OGRGeometryH geom, int owner, Batch &batch );
+		 *	\brief Adds the simple parts of a geometry to a batch
+		 *	\param geom : geometry
+		 *	\param owner : feature position in the batch
+		 *	\param &batch : batch
+		 */
+		static void Collect( OGRGeometryH geom, int owner, Batch &batch );
+
+		/*!
+		 *	\fn long Transform( vector<OGRFeatureH> &features, OGRCoordinateTransformationH transform, Batch &batch, double &time );
+		 *	\brief Reprojects and coerces dimension of a batch of features
+		 *	\param &features : features
+		 *	\param transform : coordinate transformation
+		 *	\param &batch : reused coordinate arrays
+		 *	\param &time : accumulated reprojection time
+		 *	\returns number of features left untransformed
+		 */
+		long Transform( vector<OGRFeatureH> &features, OGRCoordinateTransformationH transform, Batch &batch, double &time );
+
+		/*!
+		 *	\fn bool Write( OGRFeatureH feature );
+		 *	\brief Writes and destroys a feature
+		 *	\param feature : feature
+		 *	\returns true on success
+		 */
+		bool Write( OGRFeatureH feature );
+
+		/*!
+		 *	\fn bool Checkpoint( void );
+		 *	\brief Writes last source fid and feature count to the checkpoint file
+		 *	\returns false if the file can't be written
+		 */
+		bool Checkpoint( void );
+
+		/*!
+		 *	\fn bool LoadCheckpoint( void );
+		 *	\brief Reads the checkpoint file of the current target
+		 *	\returns false if there is no checkpoint for the source layer
+		 */
+		bool LoadCheckpoint( void );
+
+		/*!
+		 *	\fn bool Skip( void );
+		 *	\brief Moves source reading after the checkpoint
+		 *	\returns false if the source doesn't match the checkpoint
+		 */
+		bool Skip( void );
+
+		/*!
+		 *	\fn static string Key( string filename );
+		 *	\brief Source cache key
+		 *	\param filename : source filename or connection string
+		 *	\returns path, modification time and size for files, connection string otherwise
+		 */
+		static string Key( string filename );
+
+		/*!
+		 *	\fn void Describe( OGRLayerH layer, string epsg );
+		 *	\brief Adds a layer of the opened source to the source cache
+		 *	\param layer : source layer
+		 *	\param epsg : epsg code of the layer
+		 */
+		void Describe( OGRLayerH layer, string epsg );
+
+		/*!
+		 *	\fn int Known( void );
+		 *	\brief Cached feature count of the source layer
+		 *	\returns count, -1 if unknown
+		 */
+		int Known( void );
+
+		/*!
+		 *	\fn void Remember( int count );
+		 *	\brief Caches the feature count of the source layer
+		 *	\param count : driver count
+		 */
+		void Remember( int count );
+
+		/*!
+		 *	\fn int Estimate( void );
+		 *	\brief Estimates feature count from source size and a sample
+		 *	\returns estimated count, -1 if unknown
+		 */
+		int Estimate( void );
+
+		/*!
+		 *	\fn bool Selected( string name );
+		 *	\brief Tells if a source field is converted
+		 *	\param name : field name
+		 *	\returns true if selected
+		 */
+		bool Selected( string name );
+
+		/*!
+		 *	\fn bool Listed( vector<string> &list, string name );
+		 *	\brief Tells if a field name is in a list, ignoring case
+		 *	\param &list : field names
+		 *	\param name : field name
+		 *	\returns true if listed
+		 */
+		bool Listed( vector<string> &list, string name );
+
+		/*!
+		 *	\fn bool Plan( string query );
+		 *	\brief Turns a simple query into an attribute filter and field selection
+		 *	\param query : SELECT <columns> FROM <layer> [ WHERE <expression> ]
+		 *	\returns false if query needs the sql engine
+		 */
+		bool Plan( string query );
+
+		/*!
+		 *	\fn bool Database( void );
+		 *	\brief Tells if source is a database
+		 *	\returns true for database drivers
+		 */
+		bool Database( void );
+
+		/*!
+		 *	\fn bool Filter( void );
+		 *	\brief Sets extent as source layer spatial filter
+		 *	\returns true on success
+		 */
+		bool Filter( void );
+
+		/*!
+		 *	\fn bool Pipeline( int workers );
+		 *	\brief Converts features with reader, transform and writer stages
+		 *	\param workers : number of transform workers
+		 *	\returns true on success
+		 */
+		bool Pipeline( int workers );
+
+		/*!
+		 *	\fn static void ReadThread( void *data );
+		 *	\brief Reader stage
+		 *	\param data : Ogr instance
+		 */
+		static void ReadThread( void *data );
+
+		/*!
+		 *	\fn static void TransformThread( void *data );
+		 *	\brief Transform stage
+		 *	\param data : Worker state
+		 */
+		static void TransformThread( void *data );
+
 		/*!
 		 *	\fn bool Error( OGRErr e, string &s );
 		 *	\brief OGR errors
@@ -106,6 +511,32 @@ class Ogr
 		 */
 		bool OpenSource( string filename, string &epsg, string &query, string &error );
 
+		/*!
+		 *	\fn bool Probe( string filename, string &epsg, string &query, vector<string> &layers, string &error );
+		 *	\brief Describes a source, opening it only when it isn't cached
+		 *	\param filename : source filename
+		 *	\param &epsg : epsg code
+		 *	\param &query : sql query
+		 *	\param &layers : layer names
+		 *	\param &error : error text
+		 *	\returns true on success
+		 */
+		bool Probe( string filename, string &epsg, string &query, vector<string> &layers, string &error );
+
+		/*!
+		 *	\fn void SetSourceLayer( string name );
+		 *	\brief Selects the layer opened by OpenSource
+		 *	\param name : layer name, empty for the first layer
+		 */
+		void SetSourceLayer( string name );
+
+		/*!
+		 *	\fn vector<string> GetLayers( void );
+		 *	\brief Lists layers of opened source
+		 *	\returns layer names
+		 */
+		vector<string> GetLayers( void );
+
 		/*!
 		 *	\fn bool CloseSource( void );
 		 *	\brief Closes source data
@@ -150,7 +581,7 @@ class Ogr
 		/*!
 		 *	\fn bool Prepare( int &nbFeat, string query );
 		 *	\brief Prepare data for conversion
-		 *	\param nbFeat : number of features
+		 *	\param nbFeat : number of features, -1 if unknown
 		 *	\param query : source sql query
 		 *	\returns true on success
 		 */
@@ -158,10 +589,148 @@ class Ogr
 
 		/*!
 		 *	\fn bool Process( void );
-		 *	\brief Process a feature
-		 *	\returns true on success
+		 *	\brief Process a batch of features
+		 *	\returns false once source is exhausted
 		 */
 		bool Process( void );
+
+		/*!
+		 *	\fn bool Run( void );
+		 *	\brief Converts all prepared features, pipelined when worth it
+		 *	\returns true on success
+		 */
+		bool Run( void );
+
+		/*!
+		 *	\fn void SetDimension( int dim );
+		 *	\brief Sets target coordinate dimension
+		 *	\param dim : 2 or 3, 0 keeps source dimension
+		 */
+		void SetDimension( int dim );
+
+		/*!
+		 *	\fn void SetCountStrategy( int strategy );
+		 *	\brief Sets how Prepare counts source features
+		 *	\param strategy : Count value
+		 */
+		void SetCountStrategy( int strategy );
+
+		/*!
+		 *	\fn void SetFields( int mode, vector<string> fields );
+		 *	\brief Sets converted fields
+		 *	\param mode : Fields value
+		 *	\param fields : field names for FIELDS_SELECTED
+		 */
+		void SetFields( int mode, vector<string> fields = vector<string>() );
+
+		/*!
+		 *	\fn bool SetExtent( string extent, bool target = false );
+		 *	\brief Sets spatial extent of converted features
+		 *	\param extent : "minx miny maxx maxy" or polygon wkt, empty for none
+		 *	\param target : extent is in target projection
+		 *	\returns false if extent is invalid
+		 */
+		bool SetExtent( string extent, bool target = false );
+
+		/*!
+		 *	\fn void SetThreads( int count );
+		 *	\brief Sets number of transform workers
+		 *	\param count : workers, 0 for one per core, 1 runs serially
+		 */
+		void SetThreads( int count );
+
+		/*!
+		 *	\fn void SetMemoryBudget( size_t bytes );
+		 *	\brief Sets memory budget of the pipeline queues
+		 *	\param bytes : budget
+		 */
+		void SetMemoryBudget( size_t bytes );
+
+		/*!
+		 *	\fn void SetProgress( OgrProgress callback, void *data );
+		 *	\brief Sets progress callback, called from the calling thread
+		 *	\param callback : progress callback
+		 *	\param data : callback data
+		 */
+		void SetProgress( OgrProgress callback, void *data );
+
+		/*!
+		 *	\fn double GetProcessTime( void );
+		 *	\brief Time spent processing features
+		 *	\returns seconds
+		 */
+		double GetProcessTime( void );
+
+		/*!
+		 *	\fn string GetError( void );
+		 *	\brief Last error
+		 *	\returns error text
+		 */
+		string GetError( void );
+
+		/*!
+		 *	\fn string GetPlan( void );
+		 *	\brief How Prepare runs the source query
+		 *	\returns plan text, empty without query
+		 */
+		string GetPlan( void );
+
+		/*!
+		 *	\fn double GetTransformTime( void );
+		 *	\brief Time spent transforming geometries
+		 *	\returns seconds
+		 */
+		double GetTransformTime( void );
+
+		/*!
+		 *	\fn void SetGroupSize( int size );
+		 *	\brief Sets number of features per transaction
+		 *	\param size : features per transaction, 0 disables transactions
+		 */
+		void SetGroupSize( int size );
+
+		/*!
+		 *	\fn void SetCheckpoint( int size, bool restart );
+		 *	\brief Writes a checkpoint file next to the target every size features
+		 *	\param size : features between checkpoints, 0 disables checkpoints
+		 *	\param restart : resumes from an existing checkpoint instead of overwriting
+		 */
+		void SetCheckpoint( int size, bool restart );
+
+		/*!
+		 *	\fn long GetResumed( void );
+		 *	\brief Features skipped because a checkpoint already covered them
+		 *	\returns features
+		 */
+		long GetResumed( void );
+
+		/*!
+		 *	\fn Stats GetStats( void );
+		 *	\brief Instrumentation of the last conversion
+		 *	\returns stage times and counters
+		 */
+		Stats GetStats( void );
+
+		/*!
+		 *	\fn string GetReport( void );
+		 *	\brief Instrumentation of the last conversion as json
+		 *	\returns json object
+		 */
+		string GetReport( void );
+
+		/*!
+		 *	\fn int GetCommitCount( void );
+		 *	\brief Number of committed transactions
+		 *	\returns commits
+		 */
+		int GetCommitCount( void );
+
+		/*!
+		 *	\fn double GetCommitTime( void );
+		 *	\brief Time spent committing transactions
+		 *	\returns seconds
+		 */
+		double GetCommitTime( void );
 };
 
 #endif
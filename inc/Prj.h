@@ -0,0 +1,154 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Prj.h
+ *	\brief Closed form projections
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef PRJ
+#define PRJ
+
+#include "ogr_srs_api.h"
+#include "cpl_conv.h"
+
+/*!
+ *	\class Prj
+ *	\brief Closed form projections
+ *	\author Olivier Pilotte
+ *
+ *	Reprojects coordinate arrays between geographic, web mercator and
+ *	transverse mercator ( UTM, MTM ) systems of WGS84 coincident datums
+ *	without going through PROJ. Each step is a loop over the whole array.
+ *	Other systems are left to OCTTransformEx.
+ */
+class Prj
+{
+	private :
+
+		/*!
+		 *	\enum Kind
+		 *	\brief Supported coordinate systems
+		 */
+		enum Kind
+		{
+			GEOGRAPHIC,
+			MERCATOR,
+			TRANSVERSE
+		};
+
+		/*!
+		 *	\struct Frame
+		 *	\brief Coordinate system parameters
+		 */
+		struct Frame
+		{
+			int kind;
+
+			double a;
+			double n;
+
+			double k0;
+			double lon0;
+			double x0;
+			double y0;
+
+			// ellipsoid scale and kruger series, transverse only
+			double scale;
+			double e;
+			double alpha[ 6 ];
+			double beta[ 6 ];
+		};
+
+		Frame source;
+		Frame target;
+
+		/*!
+		 *	\fn static bool Identify( OGRSpatialReferenceH srs, Frame &frame );
+		 *	\brief Reads coordinate system parameters
+		 *	\param srs : spatial reference
+		 *	\param &frame : parameters
+		 *	\returns false if system is not supported
+		 */
+		static bool Identify( OGRSpatialReferenceH srs, Frame &frame );
+
+		/*!
+		 *	\fn static bool Coincident( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+		 *	\brief Tells if datums differ by less than their accuracy
+		 *	\param source : source spatial reference
+		 *	\param target : target spatial reference
+		 *	\returns true if no datum shift is needed
+		 */
+		static bool Coincident( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+
+		/*!
+		 *	\fn static void Inverse( const Frame &frame, int count, double *x, double *y );
+		 *	\brief Projected to geographic radians
+		 *	\param frame : parameters
+		 *	\param count : number of points
+		 *	\param *x : eastings, longitudes on return
+		 *	\param *y : northings, latitudes on return
+		 */
+		static void Inverse( const Frame &frame, int count, double *x, double *y );
+
+		/*!
+		 *	\fn static void Forward( const Frame &frame, int count, double *x, double *y );
+		 *	\brief Geographic radians to projected
+		 *	\param frame : parameters
+		 *	\param count : number of points
+		 *	\param *x : longitudes, eastings on return
+		 *	\param *y : latitudes, northings on return
+		 */
+		static void Forward( const Frame &frame, int count, double *x, double *y );
+
+		/*!
+		 *	\fn Prj( void );
+		 *	\brief Constructor, see Create
+		 */
+		Prj( void );
+
+	public :
+
+		/*!
+		 *	\fn static Prj *Create( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+		 *	\brief Creates a closed form transformation
+		 *	\param source : source spatial reference
+		 *	\param target : target spatial reference
+		 *	\returns transformation, NULL if PROJ is needed
+		 */
+		static Prj *Create( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+
+		/*!
+		 *	\fn int Transform( int count, double *x, double *y, int *success ) const;
+		 *	\brief Reprojects points in place, z is left as is
+		 *	\param count : number of points
+		 *	\param *x : x coordinates
+		 *	\param *y : y coordinates
+		 *	\param *success : per point result
+		 *	\returns number of failed points
+		 */
+		int Transform( int count, double *x, double *y, int *success ) const;
+};
+
+#endif
@@ -0,0 +1,158 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Que.h
+ *	\brief Bounded feature queue
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef QUE
+#define QUE
+
+#include "ogr_api.h"
+#include "cpl_multiproc.h"
+
+#include <deque>
+#include <vector>
+
+using std::deque;
+using std::vector;
+
+/*!
+ *	\class Que
+ *	\brief Bounded feature queue
+ *	\author Olivier Pilotte
+ *
+ *	Joins the stages of the conversion pipeline. Push blocks while the queue
+ *	holds more than its item capacity or memory budget, Pop blocks while it
+ *	is empty. The queue closes once every producer has called Close.
+ *	A limit on sequence numbers keeps producers from running too far ahead
+ *	of the last consumer.
+ */
+class Que
+{
+	private :
+
+		struct Item
+		{
+			long index;
+
+			OGRFeatureH feature;
+
+			size_t size;
+		};
+
+		deque<Item> items;
+
+		int capacity;
+		int producers;
+
+		size_t budget;
+		size_t bytes;
+
+		// highest sequence number accepted, -1 for none
+		long limit;
+
+		bool aborted;
+
+		CPLMutex *mutex;
+		CPLCond *pushCond;
+		CPLCond *popCond;
+
+	public :
+
+		/*!
+		 *	\fn Que( int capacity, size_t budget, int producers = 1 );
+		 *	\brief Constructor
+		 *	\param capacity : maximum number of queued features
+		 *	\param budget : maximum number of queued bytes
+		 *	\param producers : number of producers
+		 */
+		Que( int capacity, size_t budget, int producers = 1 );
+
+		/*!
+		 *	\fn ~Que( void );
+		 *	\brief Destructor, destroys remaining features
+		 */
+		~Que( void );
+
+		/*!
+		 *	\fn bool Push( long index, OGRFeatureH feature, size_t size );
+		 *	\brief Queues a feature, waits for room and for the limit to reach its index
+		 *	\param index : feature sequence number
+		 *	\param feature : feature
+		 *	\param size : estimated feature size
+		 *	\returns false if queue was aborted
+		 */
+		bool Push( long index, OGRFeatureH feature, size_t size );
+
+		/*!
+		 *	\fn bool Pop( long &index, OGRFeatureH &feature, size_t &size );
+		 *	\brief Dequeues a feature, waits for one
+		 *	\param &index : feature sequence number
+		 *	\param &feature : feature
+		 *	\param &size : estimated feature size
+		 *	\returns false if queue is closed and empty, or aborted
+		 */
+		bool Pop( long &index, OGRFeatureH &feature, size_t &size );
+
+		/*!
+		 *	\fn bool Pop( vector<long> &indexes, vector<OGRFeatureH> &features, int count );
+		 *	\brief Dequeues a batch, waits for its first feature only
+		 *	\param &indexes : feature sequence numbers
+		 *	\param &features : features
+		 *	\param count : maximum batch size
+		 *	\returns false if queue is closed and empty, or aborted
+		 */
+		bool Pop( vector<long> &indexes, vector<OGRFeatureH> &features, int count );
+
+		/*!
+		 *	\fn void Limit( long index );
+		 *	\brief Sets the highest sequence number Push accepts
+		 *	\param index : sequence number, -1 for no limit
+		 */
+		void Limit( long index );
+
+		/*!
+		 *	\fn void Close( void );
+		 *	\brief Signals end of data for one producer
+		 */
+		void Close( void );
+
+		/*!
+		 *	\fn void Abort( void );
+		 *	\brief Wakes up and stops every producer and consumer
+		 */
+		void Abort( void );
+
+		/*!
+		 *	\fn static size_t Size( OGRFeatureH feature );
+		 *	\brief Estimates feature memory size
+		 *	\param feature : feature
+		 *	\returns bytes
+		 */
+		static size_t Size( OGRFeatureH feature );
+};
+
+#endif
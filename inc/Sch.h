@@ -0,0 +1,98 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Sch.h
+ *	\brief Projection search
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef SCH
+#define SCH
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+/*!
+ *	\class Sch
+ *	\brief Projection search
+ *	\author Olivier Pilotte
+ *
+ *	Word prefix search over the EPSG codes and names of the projection
+ *	table. Codes and names are split in lower case words, kept in one
+ *	sorted array, so each query word is a binary search. A projection
+ *	matches when every query word starts one of its words. Exact words
+ *	rank above prefixes and an exact code ranks first. The index is built
+ *	on the first search, from the interface thread.
+ */
+class Sch
+{
+	private :
+
+		/*!
+		 *	\struct Word
+		 *	\brief Indexed word
+		 */
+		struct Word
+		{
+			string text;
+
+			int row;
+
+			bool code;
+
+			bool operator<( const Word &other ) const;
+		};
+
+		static vector<Word> words;
+
+		/*!
+		 *	\fn static void Build( void );
+		 *	\brief Indexes the projection table
+		 */
+		static void Build( void );
+
+	public :
+
+		/*!
+		 *	\fn static void Split( string text, vector<string> &tokens );
+		 *	\brief Lower case words of a text
+		 *	\param text : text
+		 *	\param &tokens : words
+		 */
+		static void Split( string text, vector<string> &tokens );
+
+		/*!
+		 *	\fn static vector<int> Find( string query, int limit );
+		 *	\brief Ranked projections matching a query
+		 *	\param query : words, e.g. "UTM 18N" or "32618"
+		 *	\param limit : maximum number of results
+		 *	\returns projection indexes, best first
+		 */
+		static vector<int> Find( string query, int limit );
+};
+
+#endif
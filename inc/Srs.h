@@ -0,0 +1,119 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Srs.h
+ *	\brief Spatial reference and transformation cache
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#ifndef SRS
+#define SRS
+
+#include "ogr_srs_api.h"
+#include "cpl_multiproc.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+using std::string;
+using std::vector;
+using std::map;
+
+/*!
+ *	\class Srs
+ *	\brief Spatial reference and transformation cache
+ *	\author Olivier Pilotte
+ *
+ *	Shared by every conversion of the process. Spatial references are
+ *	imported once per EPSG code and handed out as clones. Transformations
+ *	are keyed by their source and target, EPSG code or WKT hash, and are
+ *	lent to one user at a time since they are not thread safe.
+ */
+class Srs
+{
+	private :
+
+		static CPLMutex *mutex;
+
+		static map<int, OGRSpatialReferenceH> references;
+
+		// idle transformations by key, and the key of every lent one
+		static map<string, vector<OGRCoordinateTransformationH> > idle;
+		static map<OGRCoordinateTransformationH, string> lent;
+
+		static long referenceHits;
+		static long referenceMisses;
+		static long transformHits;
+		static long transformMisses;
+
+		/*!
+		 *	\fn static string Key( OGRSpatialReferenceH srs );
+		 *	\brief Cache key of a spatial reference
+		 *	\param srs : spatial reference
+		 *	\returns EPSG code, or WKT hash
+		 */
+		static string Key( OGRSpatialReferenceH srs );
+
+	public :
+
+		/*!
+		 *	\fn static OGRSpatialReferenceH Reference( int epsg );
+		 *	\brief Spatial reference of an EPSG code
+		 *	\param epsg : EPSG code
+		 *	\returns clone to be released with OSRRelease, NULL if unknown
+		 */
+		static OGRSpatialReferenceH Reference( int epsg );
+
+		/*!
+		 *	\fn static OGRCoordinateTransformationH Acquire( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+		 *	\brief Lends a coordinate transformation
+		 *	\param source : source spatial reference
+		 *	\param target : target spatial reference
+		 *	\returns transformation to be given back with Release, NULL on failure
+		 */
+		static OGRCoordinateTransformationH Acquire( OGRSpatialReferenceH source, OGRSpatialReferenceH target );
+
+		/*!
+		 *	\fn static void Release( OGRCoordinateTransformationH transform );
+		 *	\brief Gives back a transformation
+		 *	\param transform : transformation, may be NULL
+		 */
+		static void Release( OGRCoordinateTransformationH transform );
+
+		/*!
+		 *	\fn static void Clear( void );
+		 *	\brief Destroys cached references and idle transformations
+		 */
+		static void Clear( void );
+
+		/*!
+		 *	\fn static string Counters( void );
+		 *	\brief Cache hits and misses
+		 *	\returns counters text
+		 */
+		static string Counters( void );
+};
+
+#endif
@@ -10,17 +10,39 @@ HEADERS += config.h \
 	   inc/App.h \
            inc/Dta.h \
            inc/Ogr.h \
+           inc/Que.h \
+           inc/Prj.h \
+           inc/Srs.h \
+           inc/Drv.h \
+           inc/Mdl.h \
+           inc/Sch.h \
+           inc/Job.h \
+           inc/Cli.h \
+           inc/Bch.h \
 	   inc/Inf.h \
            src/App.cpp \
            src/Ogr.cpp
 
 SOURCES += src/App.cpp \
 	   src/Ogr.cpp \
+	   src/Que.cpp \
+	   src/Prj.cpp \
+	   src/Srs.cpp \
+	   src/Drv.cpp \
+	   src/Dta.cpp \
+	   src/Mdl.cpp \
+	   src/Sch.cpp \
+	   src/Job.cpp \
+	   src/Cli.cpp \
+	   src/Bch.cpp \
 	   src/Inf.cpp
 
 LIBS += -L/usr/loca/lib -lgdal -lproj
 #LIBS += -L/usr/loca/lib -lgdal -lproj -lpq
 
+# optional drivers registered on first use, when linked into gdal
+#DEFINES += DRV_PG DRV_SQLITE DRV_MYSQL DRV_OCI DRV_ODBC DRV_FME
+
 CONFIG += static
 
 QT += gui
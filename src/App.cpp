@@ -28,6 +28,12 @@
  */
 
 #include "../inc/App.h"
+#include "../inc/Cli.h"
+#include "../inc/Bch.h"
+#include "../inc/Drv.h"
+#include "../inc/Dta.h"
+#include "../inc/Mdl.h"
+#include "../inc/Sch.h"
 
 App::App( QWidget *widget ) : QMainWindow( widget )
 {
@@ -41,42 +47,23 @@ App::App( QWidget *widget ) : QMainWindow( widget )
 
     InitDims();
 
+	InitCounts();
+
+	InitFields();
+
 	UpdateParameters();
 }
 
 App::~App( void )
 {
-	delete [] *formats;
-	delete [] *databases;
-	delete [] *projections;
 }
 
 void App::InitData( void )
 {
 	ogr = new Ogr();
 
-	formats = new QString * [ formatsCount ];
-		
-	for( int i = 0; i < formatsCount; i ++ )
-	{
-		formats[ i ] = new QString[ 2 ];
-	}
-
-	databases = new QString * [ databasesCount ];
-
-	for( int i = 0; i < databasesCount; i ++ )
-	{
-		databases[ i ] = new QString[ 2 ];
-	}
-
-	projections = new QString*[ projectionsCount ];
-	
-	for( int i = 0; i < projectionsCount; i ++ )
-	{
-		projections[ i ] = new QString[ 2 ];
-	}
-
-	#include "../inc/Dta.h"	
+	serialPool = new QThreadPool( this );
+	serialPool->setMaxThreadCount( 1 );
 }
 
 void App::InitDims( void )
@@ -87,21 +74,39 @@ void App::InitDims( void )
 
 }
 
+void App::InitCounts( void )
+{
+	// an exact count by default, the estimate is only a rough progress total
+
+	cmbSourceCount->addItem( tr( "exact" ), QVariant( Ogr::COUNT_EXACT ) );
+	cmbSourceCount->addItem( tr( "estimated" ), QVariant( Ogr::COUNT_ESTIMATE ) );
+	cmbSourceCount->addItem( tr( "fast only" ), QVariant( Ogr::COUNT_FAST ) );
+	cmbSourceCount->addItem( tr( "none" ), QVariant( Ogr::COUNT_NONE ) );
+}
+
+void App::InitFields( void )
+{
+	cmbSourceFields->addItem( tr( "all" ), QVariant( Ogr::FIELDS_ALL ) );
+	cmbSourceFields->addItem( tr( "selected" ), QVariant( Ogr::FIELDS_SELECTED ) );
+	cmbSourceFields->addItem( tr( "geometry only" ), QVariant( Ogr::FIELDS_GEOMETRY ) );
+	cmbSourceFields->addItem( tr( "attributes only" ), QVariant( Ogr::FIELDS_ATTRIBUTES ) );
+
+	txtSourceFields->setEnabled( false );
+}
+
 void App::InitProjections( void )
 {
-	QString prj;
-	
-	cmbTargetProj->addItem( tr( "" ) );
+	// rows are built from the projection table when shown, sizing must not read them all
 
-	for( int i = 1; i < projectionsCount; i ++ )
-	{
-		prj.clear();
-		prj = projections[ i ][ 0 ];
-		prj.append( tr( " : " ) );
-		prj.append( projections[ i ][ 1 ] );
+	QListView *view = new QListView( cmbTargetProj );
 
-		cmbTargetProj->addItem( prj );
-	}
+	view->setUniformItemSizes( true );
+
+	cmbTargetProj->setModel( new Mdl( cmbTargetProj ) );
+	cmbTargetProj->setView( view );
+
+	cmbTargetProj->setSizeAdjustPolicy( QComboBox::AdjustToMinimumContentsLength );
+	cmbTargetProj->setMinimumContentsLength( 24 );
 }
 
 void App::InitInterface( void )
@@ -129,6 +134,10 @@ void App::InitInterface( void )
 
 	this->setCentralWidget( thePanel );
 
+	statusbar = new QStatusBar( this );
+
+	this->setStatusBar( statusbar );
+
 	this->show();
 }
 
@@ -240,6 +249,65 @@ void App::InitLayout( void )
 
 				lytSource->addWidget( lblSourceQuery );
 				lytSource->addWidget( txtSourceQuery );
+
+				lblSourceCount = new QLabel();
+				lblSourceCount->setAlignment( Qt::AlignRight | Qt::AlignVCenter );
+				lblSourceCount->setMinimumWidth( 70 );
+				lblSourceCount->setMaximumWidth( 70 );
+
+				cmbSourceCount = new QComboBox();
+
+				lytSource->addWidget( lblSourceCount, 5, 0 );
+				lytSource->addWidget( cmbSourceCount, 5, 1 );
+
+				lblSourceFields = new QLabel();
+				lblSourceFields->setAlignment( Qt::AlignRight | Qt::AlignVCenter );
+				lblSourceFields->setMinimumWidth( 70 );
+				lblSourceFields->setMaximumWidth( 70 );
+
+				lytSourceFields = new QHBoxLayout();
+				{
+					cmbSourceFields = new QComboBox();
+
+					txtSourceFields = new QLineEdit();
+
+					lytSourceFields->addWidget( cmbSourceFields );
+					lytSourceFields->addWidget( txtSourceFields );
+				}
+
+				lytSource->addWidget( lblSourceFields, 6, 0 );
+				lytSource->addLayout( lytSourceFields, 6, 1 );
+
+				lblSourceExtent = new QLabel();
+				lblSourceExtent->setAlignment( Qt::AlignRight | Qt::AlignVCenter );
+				lblSourceExtent->setMinimumWidth( 70 );
+				lblSourceExtent->setMaximumWidth( 70 );
+
+				lytSourceExtent = new QHBoxLayout();
+				{
+					txtSourceExtent = new QLineEdit();
+
+					chkSourceExtent = new QCheckBox();
+
+					lytSourceExtent->addWidget( txtSourceExtent );
+					lytSourceExtent->addWidget( chkSourceExtent );
+				}
+
+				lytSource->addWidget( lblSourceExtent, 7, 0 );
+				lytSource->addLayout( lytSourceExtent, 7, 1 );
+
+				lblSourceLayers = new QLabel();
+				lblSourceLayers->setAlignment( Qt::AlignRight | Qt::AlignTop );
+				lblSourceLayers->setMinimumWidth( 70 );
+				lblSourceLayers->setMaximumWidth( 70 );
+				lblSourceLayers->hide();
+
+				lstSourceLayers = new QListWidget();
+				lstSourceLayers->setMaximumHeight( 100 );
+				lstSourceLayers->hide();
+
+				lytSource->addWidget( lblSourceLayers, 8, 0 );
+				lytSource->addWidget( lstSourceLayers, 8, 1 );
 			}
 			
 			grpSource->setLayout( lytSource );
@@ -313,10 +381,18 @@ void App::InitLayout( void )
 				lytTargetProj = new QHBoxLayout();
 				{
 					txtTargetProj = new QLineEdit();
-					txtTargetProj->setMaxLength( 5 );
-					txtTargetProj->setMinimumWidth( 50 );
-					txtTargetProj->setMaximumWidth( 50 );
-					
+					txtTargetProj->setMaxLength( 64 );
+					txtTargetProj->setMinimumWidth( 120 );
+					txtTargetProj->setMaximumWidth( 120 );
+
+					// ranked matches of the code or name being typed
+
+					mdlTargetProj = new QStringListModel( this );
+
+					cmpTargetProj = new QCompleter( mdlTargetProj, this );
+					cmpTargetProj->setWidget( txtTargetProj );
+					cmpTargetProj->setCompletionMode( QCompleter::UnfilteredPopupCompletion );
+
 					cmbTargetProj = new QComboBox();
 					cmbTargetProj->setSizePolicy( QSizePolicy::Expanding, QSizePolicy::Fixed );
 
@@ -358,6 +434,28 @@ void App::InitLayout( void )
 
                 lytTarget->addWidget( lblTargetDims, 5, 0 );
                 lytTarget->addLayout( lytTargetDims, 5, 1 );
+
+				lblTargetGroup = new QLabel();
+				lblTargetGroup->setAlignment( Qt::AlignRight | Qt::AlignVCenter );
+				lblTargetGroup->setMinimumWidth( 70 );
+				lblTargetGroup->setMaximumWidth( 70 );
+
+				lytTargetGroup = new QHBoxLayout();
+				{
+					spnTargetGroup = new QSpinBox();
+					spnTargetGroup->setRange( 0, 1000000 );
+					spnTargetGroup->setSingleStep( 1000 );
+					spnTargetGroup->setValue( 20000 );
+					spnTargetGroup->setSizePolicy( QSizePolicy::Expanding, QSizePolicy::Fixed );
+
+					chkTargetResume = new QCheckBox();
+
+					lytTargetGroup->addWidget( spnTargetGroup );
+					lytTargetGroup->addWidget( chkTargetResume );
+				}
+
+				lytTarget->addWidget( lblTargetGroup, 6, 0 );
+				lytTarget->addLayout( lytTargetGroup, 6, 1 );
 			}
 
 			grpTarget->setLayout( lytTarget );
@@ -374,14 +472,26 @@ void App::InitLayout( void )
 			btnExecute->setMinimumWidth( 200 );
 			btnExecute->setEnabled( false );
 			
+			btnCancel = new QPushButton();
+			btnCancel->setMinimumWidth( 200 );
+			btnCancel->setEnabled( false );
+
 			btnQuit = new QPushButton();
 			btnQuit->setMinimumWidth( 200 );
 
 			lytExecute->addWidget( btnExecute );
+			lytExecute->addWidget( btnCancel );
 			lytExecute->addWidget( btnQuit );
 		}
 
+		lstJobs = new QTreeWidget();
+		lstJobs->setColumnCount( 3 );
+		lstJobs->setRootIsDecorated( false );
+		lstJobs->setUniformRowHeights( true );
+		lstJobs->hide();
+
 		theLayout->addWidget( txtOutput );
+		theLayout->addWidget( lstJobs );
 		theLayout->addLayout( lytExecute );
 
 		theProgress = new QProgressBar();
@@ -418,6 +528,16 @@ void App::InitSlots( void )
 
 	QObject::connect( txtSourceQuery, SIGNAL( textChanged( QString ) ), this, SLOT( evtTxtSourceQuery( void ) ) );
 
+	QObject::connect( cmbSourceFields, SIGNAL( currentIndexChanged( int ) ), this, SLOT( evtCmbSourceFields( void ) ) );
+
+	QObject::connect( txtSourceFields, SIGNAL( textChanged( QString ) ), this, SLOT( evtTxtSourceFields( void ) ) );
+
+	QObject::connect( txtSourceExtent, SIGNAL( textChanged( QString ) ), this, SLOT( evtTxtSourceExtent( void ) ) );
+
+	QObject::connect( chkSourceExtent, SIGNAL( toggled( bool ) ), this, SLOT( evtTxtSourceExtent( void ) ) );
+
+	QObject::connect( lstSourceLayers, SIGNAL( itemChanged( QListWidgetItem * ) ), this, SLOT( evtLstSourceLayers( void ) ) );
+
 
 	QObject::connect( radTargetFile, SIGNAL( toggled( bool ) ), this, SLOT( evtRadTargetFile( void ) ) );
 
@@ -433,6 +553,7 @@ void App::InitSlots( void )
 	QObject::connect( btnTargetName, SIGNAL( clicked() ), this, SLOT( evtBtnTargetName( void ) ) );
 
 	QObject::connect( txtTargetProj, SIGNAL( textChanged( QString ) ), this, SLOT( evtTxtTargetProj( void ) ) );
+	QObject::connect( cmpTargetProj, SIGNAL( activated( QString ) ), this, SLOT( evtCmpTargetProj( QString ) ) );
 
 	QObject::connect( cmbTargetProj, SIGNAL( currentIndexChanged( int ) ), this, SLOT( evtCmbTargetProj( void ) ) );
 
@@ -443,9 +564,13 @@ void App::InitSlots( void )
 
 	QObject::connect( radTargetUpdate, SIGNAL( toggled( bool ) ), this, SLOT( evtRadTargetUpdate( void ) ) );
 
+	QObject::connect( spnTargetGroup, SIGNAL( valueChanged( int ) ), this, SLOT( evtSpnTargetGroup( void ) ) );
+
 
 	QObject::connect( btnExecute, SIGNAL( clicked( void ) ), this, SLOT( evtBtnExecute( void ) ) );
 
+	QObject::connect( btnCancel, SIGNAL( clicked( void ) ), this, SLOT( evtBtnCancel( void ) ) );
+
 	QObject::connect( btnQuit, SIGNAL( clicked( void ) ), this, SLOT( evtBtnQuit( void ) ) );
 
 
@@ -484,6 +609,16 @@ void App::TranslateInterface( void )
 		lblSourceProj->setText( tr( "Projection" ) );
 
 		lblSourceQuery->setText( tr( "Query" ) );
+
+		lblSourceCount->setText( tr( "Count" ) );
+
+		lblSourceFields->setText( tr( "Fields" ) );
+
+		lblSourceExtent->setText( tr( "Extent" ) );
+		chkSourceExtent->setText( tr( "target projection" ) );
+
+		lblSourceLayers->setText( tr( "Layers" ) );
+		txtSourceExtent->setToolTip( tr( "minx miny maxx maxy, or polygon WKT" ) );
 	}
 
 	grpTarget->setTitle( tr( "Target" ) );
@@ -502,9 +637,15 @@ void App::TranslateInterface( void )
 		radTargetOverwrite->setText( tr( "overwrite" ) );
 		radTargetAppend->setText( tr( "append" ) );
 		radTargetUpdate->setText( tr( "update" ) );
+
+		lblTargetGroup->setText( tr( "Group" ) );
+		chkTargetResume->setText( tr( "resumable" ) );
 	}
 
+	lstJobs->setHeaderLabels( QStringList() << tr( "File" ) << tr( "Progress" ) << tr( "Status" ) );
+
 	btnExecute->setText( tr( "&Execute" ) );
+	btnCancel->setText( tr( "&Cancel" ) );
 	btnQuit->setText( tr( "&Quit" ) );
 }
 
@@ -532,7 +673,7 @@ void App::UpdateParameters( void )
 
 	if( ! cmbTargetProj->currentText().isEmpty() )
 	{
-		parameters += tr( "-T_SRS EPSG:" ) + projections[ cmbTargetProj->currentIndex() ][ 0 ] + tr( " " );
+		parameters += tr( "-T_SRS EPSG:" ) + QString::number( Dta::ProjectionCode( cmbTargetProj->currentIndex() ) ) + tr( " " );
 	}
 
 	if( ! txtSourceQuery->text().isEmpty() )
@@ -542,9 +683,50 @@ void App::UpdateParameters( void )
 
     if( ! cmbTargetDims->currentText().isEmpty() )
     {
-        parameters += tr( "-dim " ) + cmbTargetDims->currentText();
+        parameters += tr( "-dim " ) + cmbTargetDims->currentText() + tr( " " );
     }
 
+	switch( cmbSourceFields->itemData( cmbSourceFields->currentIndex() ).toInt() )
+	{
+		case Ogr::FIELDS_SELECTED :
+		{
+			parameters += tr( "-select \"" ) + txtSourceFields->text() + tr( "\" " );
+		}
+		break;
+
+		case Ogr::FIELDS_GEOMETRY :
+		{
+			parameters += tr( "-select \"\" " );
+		}
+		break;
+
+		case Ogr::FIELDS_ATTRIBUTES :
+		{
+			parameters += tr( "-nlt NONE " );
+		}
+		break;
+	}
+
+	if( ! txtSourceExtent->text().trimmed().isEmpty() )
+	{
+		// ogr2ogr -spat only takes a rectangle
+
+		if( ! txtSourceExtent->text().contains( tr( "(" ) ) )
+		{
+			parameters += tr( "-spat " ) + txtSourceExtent->text().trimmed().replace( tr( "," ), tr( " " ) ) + tr( " " );
+
+			if( chkSourceExtent->isChecked() && ! cmbTargetProj->currentText().isEmpty() )
+			{
+				parameters += tr( "-spat_srs EPSG:" ) + QString::number( Dta::ProjectionCode( cmbTargetProj->currentIndex() ) ) + tr( " " );
+			}
+		}
+	}
+
+	if( spnTargetGroup->value() > 0 )
+	{
+		parameters += tr( "-gt " ) + QString::number( spnTargetGroup->value() );
+	}
+
 	for( int i = 0; i < ( int ) parameters.size(); i ++ )
 	{
 		if( parameters.at( i ) == '\\' )
@@ -581,9 +763,9 @@ void App::evtRadSourceFile( void )
 
 	cmbSourceFormat->clear();
 
-	for( int i = 0; i < formatsCount; i ++ )
+	for( int i = 0; i < Dta::Formats(); i ++ )
 	{
-		cmbSourceFormat->addItem( formats[ i ][ 0 ] );
+		cmbSourceFormat->addItem( Dta::FormatName( i ) );
 	}
 
 	radTargetFile->setEnabled( true );
@@ -606,9 +788,9 @@ void App::evtRadSourceFolder( void )
 
 	cmbSourceFormat->clear();
 
-	for( int i = 0; i < formatsCount; i ++ )
+	for( int i = 0; i < Dta::Formats(); i ++ )
 	{
-		cmbSourceFormat->addItem( formats[ i ][ 0 ] );
+		cmbSourceFormat->addItem( Dta::FormatName( i ) );
 	}
 
 	radTargetFile->setEnabled( false );
@@ -631,9 +813,9 @@ void App::evtRadSourceDatabase( void )
 
 	cmbSourceFormat->clear();
 
-	for( int i = 0; i < databasesCount; i ++ )
+	for( int i = 0; i < Dta::Databases(); i ++ )
 	{
-		cmbSourceFormat->addItem( databases[ i ][ 0 ] );
+		cmbSourceFormat->addItem( Dta::DatabaseName( i ) );
 	}
 
 	radTargetFile->setEnabled( true );
@@ -675,32 +857,46 @@ void App::evtTxtSourceName( void )
 	string query;
 	string error;
 
-	if( ogr->OpenSource( name, epsg, query, error ) )
+	vector<string> layers;
+
+	// sources already probed or converted aren't opened again
+
+	if( ogr->Probe( name, epsg, query, layers, error ) )
 	{
-		for( int i = 0; i < projectionsCount; i ++ )
-		{
-			if( strcmp( epsg.c_str(), projections[ i ][ 0 ].toStdString().c_str() ) == 0 )
-			{
-				if( i > 1 )
-				{
-					txtSourceProj->setText( projections[ i ][ 0 ] + tr( " : " ) + projections[ i ][ 1 ] );
-				}
+		int row = Dta::ProjectionRow( atoi( epsg.c_str() ) );
 
-				break;
-			}
+		if( row > 1 )
+		{
+			txtSourceProj->setText( QString::number( Dta::ProjectionCode( row ) ) + tr( " : " ) + Dta::ProjectionName( row ) );
 		}
 
-		ogr->CloseSource();
-
 		if( radSourceFile->isChecked() )
 		{
 			txtSourceQuery->setText( query.c_str() );
 		}
+
+		lstSourceLayers->clear();
+
+		for( size_t i = 0; radSourceFile->isChecked() && i < layers.size(); i ++ )
+		{
+			QListWidgetItem *item = new QListWidgetItem( QString( layers[ i ].c_str() ), lstSourceLayers );
+
+			item->setFlags( Qt::ItemIsUserCheckable | Qt::ItemIsEnabled );
+			item->setCheckState( i == 0 ? Qt::Checked : Qt::Unchecked );
+		}
+
+		lblSourceLayers->setVisible( radSourceFile->isChecked() && layers.size() > 1 );
+		lstSourceLayers->setVisible( radSourceFile->isChecked() && layers.size() > 1 );
 	}
 	else
 	{
 		txtSourceProj->clear();
 		txtSourceQuery->clear();
+
+		lstSourceLayers->clear();
+
+		lblSourceLayers->hide();
+		lstSourceLayers->hide();
 	}
 
 	UpdateParameters();
@@ -714,7 +910,7 @@ void App::evtBtnSourceName( void )
 
 	if( radSourceFile->isChecked() )
 	{
-		type = tr( "\"" ) + formats[ idx ][ 0 ] + tr( "\" | *." ) + formats[ idx ][ 1 ];
+		type = tr( "\"" ) + Dta::FormatName( idx ) + tr( "\" | *." ) + Dta::FormatExtension( idx );
 
 		txtSourceName->setText( QFileDialog::getOpenFileName( this, tr( "Source File" ), tr( "" ), type ) );
 
@@ -726,7 +922,7 @@ void App::evtBtnSourceName( void )
 	{
 		QStringList types;
 
-		type = tr( "*." ) + formats[ cmbSourceFormat->currentIndex() ][ 1 ];
+		type = tr( "*." ) + Dta::FormatExtension( cmbSourceFormat->currentIndex() );
 
 		txtSourceName->setText( QFileDialog::getExistingDirectory( this, tr( "Source Folder" ), tr( "" ), QFileDialog::ShowDirsOnly | QFileDialog::DontResolveSymlinks ) );
 
@@ -751,7 +947,7 @@ void App::evtBtnSourceName( void )
 	}
 	else if( radSourceDatabase->isChecked() )
 	{
-		inf->setConnectionType( databases[ idx ][ 1 ] );
+		inf->setConnectionType( Dta::DatabaseDriver( idx ) );
 
 		inf->setDialogStyle( 1 );
 
@@ -794,6 +990,67 @@ void App::evtTxtSourceQuery( void )
 	UpdateParameters();
 }
 
+void App::evtCmbSourceFields( void )
+{
+	txtSourceFields->setEnabled( cmbSourceFields->itemData( cmbSourceFields->currentIndex() ).toInt() == Ogr::FIELDS_SELECTED );
+
+	UpdateParameters();
+}
+
+void App::evtTxtSourceFields( void )
+{
+	UpdateParameters();
+}
+
+void App::evtTxtSourceExtent( void )
+{
+	UpdateParameters();
+}
+
+void App::evtLstSourceLayers( void )
+{
+	if( ! radSourceFile->isChecked() )
+	{
+		return;
+	}
+
+	QStringList layers = CheckedLayers();
+
+	// several layers are written next to each other
+
+	if( layers.size() > 1 )
+	{
+		txtSourceQuery->setEnabled( false );
+
+		radTargetFile->setEnabled( false );
+		radTargetFolder->setEnabled( true );
+
+		if( radTargetFile->isChecked() )
+		{
+			radTargetFolder->setChecked( true );
+		}
+	}
+	else
+	{
+		txtSourceQuery->setEnabled( true );
+
+		radTargetFile->setEnabled( true );
+		radTargetFolder->setEnabled( false );
+
+		if( radTargetFolder->isChecked() )
+		{
+			radTargetFile->setChecked( true );
+		}
+
+		if( layers.size() == 1 )
+		{
+			txtSourceQuery->setText( tr( "SELECT * FROM " ) + layers.at( 0 ) );
+		}
+	}
+
+	UpdateParameters();
+}
+
 
 void App::evtRadTargetFile( void )
 {
@@ -801,9 +1058,9 @@ void App::evtRadTargetFile( void )
 
 	cmbTargetFormat->clear();
 
-	for( int i = 0; i < formatsOutput; i ++ )
+	for( int i = 0; i < Dta::FormatsOutput(); i ++ )
 	{
-		cmbTargetFormat->addItem( formats[ i ][ 0 ] );
+		cmbTargetFormat->addItem( Dta::FormatName( i ) );
 	}
 
 	txtTargetName->clear();
@@ -818,9 +1075,9 @@ void App::evtRadTargetFolder( void )
 
 	cmbTargetFormat->clear();
 
-	for( int i = 0; i < formatsOutput; i ++ )
+	for( int i = 0; i < Dta::FormatsOutput(); i ++ )
 	{
-		cmbTargetFormat->addItem( formats[ i ][ 0 ] );
+		cmbTargetFormat->addItem( Dta::FormatName( i ) );
 	}
 }
 
@@ -830,9 +1087,9 @@ void App::evtRadTargetDatabase( void )
 
 	cmbTargetFormat->clear();
 
-	for( int i = 0; i < databasesOutput; i ++ )
+	for( int i = 0; i < Dta::DatabasesOutput(); i ++ )
 	{
-		cmbTargetFormat->addItem( databases[ i ][ 0 ] );
+		cmbTargetFormat->addItem( Dta::DatabaseName( i ) );
 	}
 }
 
@@ -858,7 +1115,7 @@ void App::evtBtnTargetName( void )
 	{
 		inf->setDialogStyle( 0 );
 
-		inf->setConnectionType( databases[ cmbTargetFormat->currentIndex() ][ 1 ] );
+		inf->setConnectionType( Dta::DatabaseDriver( cmbTargetFormat->currentIndex() ) );
 
 		if( inf->exec() == QDialog::Accepted )
 		{
@@ -869,7 +1126,7 @@ void App::evtBtnTargetName( void )
 	{
 		if( radSourceFile->isChecked() )
 		{
-			type = tr( "\"" ) + formats[ idx ][ 0 ] + tr( " (*." ) + formats[ idx ][ 1 ] + tr( ") | *." ) + formats[ idx ][ 1 ];
+			type = tr( "\"" ) + Dta::FormatName( idx ) + tr( " (*." ) + Dta::FormatExtension( idx ) + tr( ") | *." ) + Dta::FormatExtension( idx );
 
 			txtTargetName->setText( QFileDialog::getSaveFileName( this, tr( "Save File" ), tr( "" ), type ) );
 		}
@@ -880,7 +1137,7 @@ void App::evtBtnTargetName( void )
 	}
 	else
 	{
-		type = tr( "\"" ) + formats[ idx ][ 0 ] + tr( "\" | *." ) + formats[ idx ][ 1 ];
+		type = tr( "\"" ) + Dta::FormatName( idx ) + tr( "\" | *." ) + Dta::FormatExtension( idx );
 
 		txtTargetName->setText( QFileDialog::getSaveFileName( this, tr( "Target File" ), tr( "" ), type ) );
 	}
@@ -890,21 +1147,49 @@ void App::evtBtnTargetName( void )
 
 void App::evtTxtTargetProj( void )
 {
-	QString projection = txtTargetProj->text();
+	QString projection = txtTargetProj->text().trimmed();
 
-	for( int i = 0; i < projectionsCount; i ++ )
+	vector<int> rows = Sch::Find( projection.toStdString(), 20 );
+
+	QStringList matches;
+
+	for( size_t i = 0; i < rows.size(); i ++ )
 	{
-		if( ( projections[ i ][ 0 ] ).startsWith( projection ) )
-		{
-			cmbTargetProj->setCurrentIndex( i );
+		matches << QString::number( Dta::ProjectionCode( rows[ i ] ) ) + tr( " : " ) + Dta::ProjectionName( rows[ i ] );
+	}
 
-			break;
-		}
+	mdlTargetProj->setStringList( matches );
+
+	// the best match is selected, the others are offered while typing
+
+	if( projection.isEmpty() )
+	{
+		cmbTargetProj->setCurrentIndex( 0 );
+	}
+	else if( ! rows.empty() )
+	{
+		cmbTargetProj->setCurrentIndex( rows[ 0 ] );
+	}
+
+	bool exact = ! rows.empty() && QString::number( Dta::ProjectionCode( rows[ 0 ] ) ) == projection;
+
+	if( ! exact && ! matches.isEmpty() && txtTargetProj->hasFocus() )
+	{
+		cmpTargetProj->complete();
+	}
+	else
+	{
+		cmpTargetProj->popup()->hide();
 	}
 
 	UpdateParameters();
 }
 
+void App::evtCmpTargetProj( QString match )
+{
+	txtTargetProj->setText( match.section( tr( " : " ), 0, 0 ) );
+}
+
 void App::evtCmbTargetProj( void )
 {
 	UpdateParameters();
@@ -925,20 +1210,46 @@ void App::evtRadTargetUpdate( void )
 	UpdateParameters();
 }
 
+void App::evtSpnTargetGroup( void )
+{
+	UpdateParameters();
+}
+
 void App::evtBtnExecute( void )
 {
-	QString name;
 	QString sourcename;
 	QString targetname;
 
-	string epsg;
-	string query;
-	string error;
+	txtOutput->clear();
 
-	int featuresCount = 0;
-	int progress = 0;
+	// options are checked on a scratch engine, the probing engine keeps no layer selection
 
-	txtOutput->clear();
+	Ogr options;
+
+	if( ! Configure( &options ) )
+	{
+		txtOutput->append( tr( "\n * " ) + QString( options.GetError().c_str() ) + tr( " !\n" ) );
+
+		return;
+	}
+
+	if( radSourceFolder->isChecked() && fileList.size() > 1 )
+	{
+		ExecuteFolder();
+
+		return;
+	}
+
+	if( radSourceFile->isChecked() && CheckedLayers().size() > 1 )
+	{
+		ExecuteLayers();
+
+		return;
+	}
+
+	// conversions run off the interface thread, one after the other
+
+	ResetJobs( fileList.size() );
 
 	for( int i = 0; i < fileList.size(); i ++ )
 	{
@@ -958,49 +1269,273 @@ void App::evtBtnExecute( void )
 			targetname = txtTargetName->text();
 		}
 
-		txtOutput->append( QString( sourcename + tr( " > " ) + targetname + tr( " ... " ) ) );
+		Job *job = CreateJob( i, sourcename + tr( " > " ) + targetname, sourcename, targetname );
+
+		// a single running job keeps one worker per core
+
+		job->GetOgr()->SetThreads( 0 );
+
+		job->SetQuery( txtSourceQuery->isEnabled() ? txtSourceQuery->text() : QString() );
+
+		serialPool->start( job );
+	}
+}
+
+static bool LargerFile( const QFileInfo &a, const QFileInfo &b )
+{
+	return a.size() > b.size();
+}
+
+bool App::Configure( Ogr *engine )
+{
+	vector<string> fields;
+
+	QStringList names = txtSourceFields->text().split( tr( "," ), QString::SkipEmptyParts );
+
+	for( int i = 0; i < names.size(); i ++ )
+	{
+		fields.push_back( names.at( i ).trimmed().toStdString() );
+	}
+
+	engine->SetFields( cmbSourceFields->itemData( cmbSourceFields->currentIndex() ).toInt(), fields );
+
+	engine->SetCountStrategy( cmbSourceCount->itemData( cmbSourceCount->currentIndex() ).toInt() );
+
+	engine->SetDimension( cmbTargetDims->itemData( cmbTargetDims->currentIndex() ).toInt() );
+
+	engine->SetGroupSize( spnTargetGroup->value() );
+
+	// checkpoints follow commits, or every 20000 features without transactions
+
+	engine->SetCheckpoint( chkTargetResume->isChecked() ? ( spnTargetGroup->value() > 0 ? spnTargetGroup->value() : 20000 ) : 0, chkTargetResume->isChecked() );
 
-		if( ogr->OpenSource( sourcename.toStdString(), epsg, query, error ) )
+	QStringList layers = CheckedLayers();
+
+	engine->SetSourceLayer( layers.size() == 1 ? layers.at( 0 ).toStdString() : "" );
+
+	return engine->SetExtent( txtSourceExtent->text().toStdString(), chkSourceExtent->isChecked() );
+}
+
+void App::ExecuteFolder( void )
+{
+	QDir dir( txtSourceName->text() );
+
+	QFileInfoList files;
+
+	for( int i = 0; i < fileList.size(); i ++ )
+	{
+		files.append( QFileInfo( dir, fileList.at( i ) ) );
+	}
+
+	// largest files first, so the last running jobs are the short ones
+
+	qSort( files.begin(), files.end(), LargerFile );
+
+	int format = cmbTargetFormat->currentIndex();
+
+	ResetJobs( files.size() );
+
+	for( int i = 0; i < files.size(); i ++ )
+	{
+		QString targetname = txtTargetName->text();
+
+		if( ! radTargetDatabase->isChecked() )
 		{
-			if( ogr->OpenDriver( cmbTargetFormat->currentText().toStdString(), error ) )
-			{
-				if( ogr->OpenTarget( targetname.toStdString(), atoi( projections[ cmbTargetProj->currentIndex() ][ 0 ].toStdString().c_str() ) ) )
-				{
-					ogr->Prepare( featuresCount, "" );
+			targetname += tr( "/" ) + files.at( i ).completeBaseName() + tr( "." ) + Dta::FormatExtension( format );
+		}
 
-					theProgress->setMinimum( 0 );
-					theProgress->setMaximum( featuresCount );
-					theProgress->setValue( 0 );	
+		QThreadPool::globalInstance()->start( CreateJob( i, files.at( i ).fileName(), files.at( i ).filePath(), targetname ) );
+	}
+}
 
-					while( ogr->Process() )
-					{
-						progress ++;
+void App::ExecuteLayers( void )
+{
+	QStringList layers = CheckedLayers();
 
-						theProgress->setValue( progress );
-					}
-					
-					ogr->CloseTarget();
-					ogr->CloseSource();
+	int format = cmbTargetFormat->currentIndex();
 
-					theProgress->setValue( 0 );
+	// a single database file can't be written from several connections
 
-					txtOutput->append( tr( "successful.\n" ) );
-				}
-				else
-				{
-					txtOutput->append( tr( "\n * unable to open target !\n" ) );
-				}
-			}
-			else
-			{
-				txtOutput->append( tr( "\n * unable to open driver !\n" ) );
-			}
+	QThreadPool *pool = QThreadPool::globalInstance();
+
+	if( radTargetDatabase->isChecked() && cmbTargetFormat->currentText() == tr( "SQLite" ) )
+	{
+		pool = serialPool;
+	}
+
+	ResetJobs( layers.size() );
+
+	for( int i = 0; i < layers.size(); i ++ )
+	{
+		QString targetname = txtTargetName->text();
+
+		if( ! radTargetDatabase->isChecked() )
+		{
+			targetname += tr( "/" ) + layers.at( i ) + tr( "." ) + Dta::FormatExtension( format );
+		}
+
+		// each job opens its own source handle on its layer
+
+		Job *job = CreateJob( i, layers.at( i ), txtSourceName->text(), targetname );
+
+		job->GetOgr()->SetSourceLayer( layers.at( i ).toStdString() );
+
+		pool->start( job );
+	}
+}
+
+QStringList App::CheckedLayers( void )
+{
+	QStringList layers;
+
+	for( int i = 0; radSourceFile->isChecked() && i < lstSourceLayers->count(); i ++ )
+	{
+		if( lstSourceLayers->item( i )->checkState() == Qt::Checked )
+		{
+			layers.append( lstSourceLayers->item( i )->text() );
+		}
+	}
+
+	return layers;
+}
+
+void App::ResetJobs( int count )
+{
+	lstJobs->clear();
+	lstJobs->show();
+
+	jobsProgress.fill( 0, count );
+	jobsCount.fill( 0, count );
+	jobsDone = 0;
+
+	jobsClock.start();
+
+	theProgress->setMinimum( 0 );
+	theProgress->setMaximum( 100 * count );
+	theProgress->setValue( 0 );
+
+	btnExecute->setEnabled( false );
+	btnCancel->setEnabled( true );
+}
+
+Job *App::CreateJob( int index, QString label, QString source, QString target )
+{
+	int projection = Dta::ProjectionCode( cmbTargetProj->currentIndex() );
+
+	QTreeWidgetItem *item = new QTreeWidgetItem( lstJobs );
+
+	item->setText( 0, label );
+	item->setText( 1, tr( "0 %" ) );
+
+	Job *job = new Job( index, source, target, cmbTargetFormat->currentText(), projection );
+
+	Configure( job->GetOgr() );
+
+	// jobs already run one per core
+
+	job->GetOgr()->SetThreads( 1 );
+
+	QObject::connect( job, SIGNAL( progress( int, int, int ) ), this, SLOT( evtJobProgress( int, int, int ) ) );
+
+	QObject::connect( job, SIGNAL( finished( int, bool, QString ) ), this, SLOT( evtJobFinished( int, bool, QString ) ) );
+
+	jobsActive.append( job );
+
+	return job;
+}
+
+void App::evtJobProgress( int index, int count, int percent )
+{
+	jobsProgress[ index ] = percent;
+
+	jobsCount[ index ] = count;
+
+	if( percent < 0 )
+	{
+		lstJobs->topLevelItem( index )->setText( 1, tr( "%1 features" ).arg( count ) );
+	}
+	else
+	{
+		lstJobs->topLevelItem( index )->setText( 1, QString::number( percent ) + tr( " %" ) );
+	}
+
+	int total = 0;
+	int uncounted = 0;
+
+	for( int i = 0; i < jobsProgress.size(); i ++ )
+	{
+		if( jobsProgress.at( i ) < 0 )
+		{
+			uncounted ++;
 		}
 		else
 		{
-			txtOutput->append( tr( "\n * unable to open source !\n" ) );
+			total += jobsProgress.at( i );
 		}
 	}
+
+	// the bar runs busy while no running job can tell its progress
+
+	theProgress->setMaximum( uncounted > 0 && total == 0 ? 0 : 100 * jobsProgress.size() );
+
+	theProgress->setValue( total );
+
+	int features = 0;
+
+	for( int i = 0; i < jobsCount.size(); i ++ )
+	{
+		features += jobsCount.at( i );
+	}
+
+	double seconds = jobsClock.elapsed() / 1000.0;
+
+	QString status = tr( "%1 features, %2 features/s" ).arg( features ).arg( seconds > 0 ? features / seconds : 0, 0, 'f', 0 );
+
+	// without feature counts the remaining time is unknown
+
+	if( total > 0 && uncounted == 0 )
+	{
+		int remaining = ( int ) ( seconds * ( theProgress->maximum() - total ) / total );
+
+		status += tr( ", ETA %1" ).arg( QTime( 0, 0 ).addSecs( remaining ).toString( tr( "hh:mm:ss" ) ) );
+	}
+
+	statusbar->showMessage( status );
+}
+
+void App::evtJobFinished( int index, bool success, QString message )
+{
+	QTreeWidgetItem *item = lstJobs->topLevelItem( index );
+
+	item->setText( 2, success ? tr( "successful" ) : tr( "failed" ) );
+
+	txtOutput->append( item->text( 0 ) + tr( " : " ) + message );
+
+	jobsActive.removeAll( ( Job * ) sender() );
+
+	sender()->deleteLater();
+
+	if( ++ jobsDone == jobsProgress.size() )
+	{
+		theProgress->setValue( 0 );
+
+		txtOutput->append( tr( "%1 jobs done.\n" ).arg( jobsDone ) );
+
+		statusbar->showMessage( tr( "%1 jobs done in %2 s" ).arg( jobsDone ).arg( jobsClock.elapsed() / 1000.0, 0, 'f', 1 ) );
+
+		btnExecute->setEnabled( true );
+		btnCancel->setEnabled( false );
+	}
+}
+
+void App::evtBtnCancel( void )
+{
+	for( int i = 0; i < jobsActive.size(); i ++ )
+	{
+		jobsActive.at( i )->Cancel();
+	}
+
+	btnCancel->setEnabled( false );
 }
 
 void App::evtBtnQuit( void )
@@ -1008,8 +1543,95 @@ void App::evtBtnQuit( void )
 	this->close();
 }
 
+void App::closeEvent( QCloseEvent *event )
+{
+	// running jobs close their targets before the application goes away
+
+	evtBtnCancel();
+
+	QThreadPool::globalInstance()->waitForDone();
+
+	serialPool->waitForDone();
+
+	event->accept();
+}
+
+/*!
+ *	\fn static int Startup( int argc, char **argv );
+ *	\brief Prints where startup time goes, in milliseconds
+ *	\param argc : argument count
+ *	\param argv : arguments
+ *	\returns exit code
+ */
+static int Startup( int argc, char **argv )
+{
+	QTime timer;
+
+	timer.start();
+
+	QApplication app( argc, argv );
+
+	fprintf( stdout, "startup\tapplication\t%d\n", timer.elapsed() );
+
+	timer.start();
+
+	App *window = new App();
+
+	app.processEvents();
+
+	fprintf( stdout, "startup\tinterface\t%d\n", timer.elapsed() );
+
+	// drivers are registered on first use, each one is timed here
+
+	double total = 0;
+
+	vector<string> names = Drv::Names();
+
+	for( size_t i = 0; i < names.size(); i ++ )
+	{
+		double seconds = Drv::Time( names[ i ] );
+
+		total += seconds;
+
+		fprintf( stdout, "startup\tdriver %s\t%.3f\n", names[ i ].c_str(), seconds * 1000 );
+	}
+
+	fprintf( stdout, "startup\ttable drivers\t%.3f\n", total * 1000 );
+
+	fprintf( stdout, "startup\tother drivers\t%.3f\n", Drv::RegisterAll() * 1000 );
+
+	delete window;
+
+	return 0;
+}
+
 int main( int argc, char **argv )
 {
+	if( argc > 2 && strcmp( argv[ 1 ], "--batch" ) == 0 )
+	{
+		QCoreApplication app( argc, argv );
+
+		Cli cli;
+
+		return cli.Run( QString::fromLocal8Bit( argv[ 2 ] ) );
+	}
+
+	// --benchmark folder [ features [ repeats [ threads ] ] ]
+
+	if( argc > 2 && strcmp( argv[ 1 ], "--benchmark" ) == 0 )
+	{
+		QCoreApplication app( argc, argv );
+
+		Bch bch( QString::fromLocal8Bit( argv[ 2 ] ), argc > 3 ? atoi( argv[ 3 ] ) : 100000, argc > 4 ? atoi( argv[ 4 ] ) : 5, argc > 5 ? atoi( argv[ 5 ] ) : 1 );
+
+		return bch.Run();
+	}
+
+	if( argc > 1 && strcmp( argv[ 1 ], "--startup" ) == 0 )
+	{
+		return Startup( argc, argv );
+	}
+
 	QApplication app( argc, argv );
 
 	new App();
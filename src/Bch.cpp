@@ -0,0 +1,782 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Bch.cpp
+ *	\brief Conversion benchmark
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Bch.h"
+#include "../inc/Srs.h"
+#include "../inc/Drv.h"
+#include "../inc/Dta.h"
+
+#include "gdal_version.h"
+#include "cpl_string.h"
+
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+Bch::Bch( QString f, int n, int r, int t )
+{
+	folder = f;
+
+	features = qMax( 1, n );
+	repeats = qMax( 1, r );
+	threads = t;
+
+	seed = 1;
+
+	// same table as the interface
+
+	for( int i = 0; i < Dta::Formats(); i ++ )
+	{
+		OGRSFDriverH driver = Drv::Driver( Dta::FormatName( i ) );
+
+		if( driver != NULL && OGR_Dr_TestCapability( driver, ODrCCreateDataSource ) )
+		{
+			names << QString( Dta::FormatName( i ) );
+			extensions << QString( Dta::FormatExtension( i ) );
+		}
+	}
+}
+
+double Bch::Random( double min, double max )
+{
+	seed = seed * 1103515245 + 12345;
+
+	return min + ( max - min ) * ( ( seed >> 8 ) & 0xffffff ) / 16777216.0;
+}
+
+OGRGeometryH Bch::Geometry( int kind, int index )
+{
+	if( kind == KIND_MIXED )
+	{
+		kind = index % 3;
+	}
+
+	double x = Random( -78, -72 );
+	double y = Random( 45, 50 );
+
+	OGRGeometryH geom = NULL;
+
+	switch( kind )
+	{
+		case KIND_LINES :
+		{
+			geom = OGR_G_CreateGeometry( wkbLineString );
+
+			for( int i = 0; i < 16; i ++ )
+			{
+				OGR_G_AddPoint_2D( geom, x, y );
+
+				x += Random( -0.001, 0.001 );
+				y += Random( -0.001, 0.001 );
+			}
+		}
+		break;
+
+		case KIND_POLYGONS :
+		{
+			OGRGeometryH ring = OGR_G_CreateGeometry( wkbLinearRing );
+
+			double radius = Random( 0.001, 0.01 );
+
+			for( int i = 0; i < 32; i ++ )
+			{
+				OGR_G_AddPoint_2D( ring, x + radius * cos( i * M_PI / 16 ), y + radius * sin( i * M_PI / 16 ) );
+			}
+
+			OGR_G_AddPoint_2D( ring, x + radius, y );
+
+			geom = OGR_G_CreateGeometry( wkbPolygon );
+
+			OGR_G_AddGeometryDirectly( geom, ring );
+		}
+		break;
+
+		default :
+		{
+			geom = OGR_G_CreateGeometry( wkbPoint );
+
+			OGR_G_AddPoint_2D( geom, x, y );
+		}
+		break;
+	}
+
+	return geom;
+}
+
+bool Bch::Generate( QString filename, QString driver, int kind, QString prefix )
+{
+	OGRSFDriverH handle = Drv::Driver( driver.toStdString() );
+
+	OGR_Dr_DeleteDataSource( handle, filename.toStdString().c_str() );
+
+	OGRDataSourceH data = OGR_Dr_CreateDataSource( handle, filename.toStdString().c_str(), NULL );
+
+	if( data == NULL )
+	{
+		return false;
+	}
+
+	OGRSpatialReferenceH srs = OSRNewSpatialReference( NULL );
+
+	OSRImportFromEPSG( srs, 4326 );
+
+	OGRwkbGeometryType types[ KIND_COUNT ] = { wkbPoint, wkbLineString, wkbPolygon, wkbPoint, wkbUnknown };
+
+	char **options = NULL;
+
+	if( driver == tr( "CSV" ) )
+	{
+		options = CSLAddString( options, "GEOMETRY=AS_WKT" );
+	}
+
+	OGRLayerH layer = OGR_DS_CreateLayer( data, "bench", srs, types[ kind ], options );
+
+	CSLDestroy( options );
+
+	OSRDestroySpatialReference( srs );
+
+	bool success = ( layer != NULL );
+
+	// three fields, or fifty for the wide schema
+
+	int fields = ( kind == KIND_WIDE ) ? 50 : 3;
+
+	OGRFieldType fieldTypes[ 3 ] = { OFTInteger, OFTString, OFTReal };
+
+	for( int i = 0; success && i < fields; i ++ )
+	{
+		OGRFieldDefnH field = OGR_Fld_Create( QString( "%1%2" ).arg( prefix ).arg( i, 2, 10, QChar( '0' ) ).toStdString().c_str(), fieldTypes[ i % 3 ] );
+
+		success = ( OGR_L_CreateField( layer, field, 1 ) == OGRERR_NONE );
+
+		OGR_Fld_Destroy( field );
+	}
+
+	// data only depends on the kind and the size of the layer
+
+	seed = 1 + kind;
+
+	for( int i = 0; success && i < features; i ++ )
+	{
+		OGRFeatureH feature = OGR_F_Create( OGR_L_GetLayerDefn( layer ) );
+
+		for( int j = 0; j < OGR_F_GetFieldCount( feature ); j ++ )
+		{
+			switch( j % 3 )
+			{
+				case 0 : OGR_F_SetFieldInteger( feature, j, i ); break;
+				case 1 : OGR_F_SetFieldString( feature, j, QString( "feature %1" ).arg( i ).toStdString().c_str() ); break;
+				case 2 : OGR_F_SetFieldDouble( feature, j, Random( 0, 1000 ) ); break;
+			}
+		}
+
+		OGR_F_SetGeometryDirectly( feature, Geometry( kind, i ) );
+
+		success = ( OGR_L_CreateFeature( layer, feature ) == OGRERR_NONE );
+
+		OGR_F_Destroy( feature );
+	}
+
+	OGR_DS_Destroy( data );
+
+	return success;
+}
+
+bool Bch::Convert( QString source, QString target, QString driver, int projection, Ogr::Stats &stats )
+{
+	Ogr ogr;
+
+	string epsg;
+	string query;
+	string error;
+
+	int count;
+
+	OGR_Dr_DeleteDataSource( Drv::Driver( driver.toStdString() ), target.toStdString().c_str() );
+
+	ogr.SetThreads( threads );
+
+	ogr.SetCountStrategy( Ogr::COUNT_NONE );
+
+	bool success = ogr.OpenSource( source.toStdString(), epsg, query, error ) && ogr.OpenDriver( driver.toStdString() ) && ogr.OpenTarget( target.toStdString(), projection ) && ogr.Prepare( count, "" ) && ogr.Run();
+
+	ogr.CloseTarget();
+	ogr.CloseSource();
+
+	stats = ogr.GetStats();
+
+	return success;
+}
+
+int Bch::CompareTransforms( void )
+{
+	OGRSpatialReferenceH source = OSRNewSpatialReference( NULL );
+	OGRSpatialReferenceH target = OSRNewSpatialReference( NULL );
+
+	OSRImportFromEPSG( source, 4326 );
+	OSRImportFromEPSG( target, 32618 );
+
+#if GDAL_VERSION_MAJOR >= 3
+	OSRSetAxisMappingStrategy( source, OAMS_TRADITIONAL_GIS_ORDER );
+	OSRSetAxisMappingStrategy( target, OAMS_TRADITIONAL_GIS_ORDER );
+#endif
+
+	vector<OGRGeometryH> geoms;
+	vector<OGRGeometryH> copies;
+
+	seed = 1;
+
+	for( int i = 0; i < features; i ++ )
+	{
+		OGRGeometryH geom = Geometry( KIND_POINTS, i );
+
+		OGR_G_AssignSpatialReference( geom, source );
+
+		geoms.push_back( geom );
+
+		// each method transforms its own copy of the source points
+
+		copies.push_back( OGR_G_Clone( geom ) );
+	}
+
+	// OGR_G_TransformTo builds a transformation for every geometry
+
+	QTime timer;
+
+	timer.start();
+
+	for( int i = 0; i < features; i ++ )
+	{
+		OGR_G_TransformTo( geoms[ i ], target );
+	}
+
+	double single = timer.elapsed() / 1000.0;
+
+	OGRCoordinateTransformationH transform = OCTNewCoordinateTransformation( source, target );
+
+	timer.start();
+
+	for( int i = 0; i < features; i ++ )
+	{
+		OGR_G_Transform( copies[ i ], transform );
+	}
+
+	double shared = timer.elapsed() / 1000.0;
+
+	int mismatches = 0;
+
+	for( int i = 0; i < features; i ++ )
+	{
+		if( fabs( OGR_G_GetX( geoms[ i ], 0 ) - OGR_G_GetX( copies[ i ], 0 ) ) > 1e-6 || fabs( OGR_G_GetY( geoms[ i ], 0 ) - OGR_G_GetY( copies[ i ], 0 ) ) > 1e-6 )
+		{
+			mismatches ++;
+		}
+	}
+
+	Print( tr( "transform\tper geometry\t%1\t%2" ).arg( features ).arg( single, 0, 'f', 3 ) );
+	Print( tr( "transform\tshared\t%1\t%2\t%3x" ).arg( features ).arg( shared, 0, 'f', 3 ).arg( shared > 0 ? single / shared : 0, 0, 'f', 1 ) + ( mismatches > 0 ? tr( "\tmismatch" ) : QString() ) );
+
+	OCTDestroyCoordinateTransformation( transform );
+
+	for( int i = 0; i < features; i ++ )
+	{
+		OGR_G_DestroyGeometry( geoms[ i ] );
+		OGR_G_DestroyGeometry( copies[ i ] );
+	}
+
+	OSRDestroySpatialReference( source );
+	OSRDestroySpatialReference( target );
+
+	return mismatches;
+}
+
+int Bch::CompareProjections( void )
+{
+	// source, target and the longitude, latitude box the points are drawn in
+
+	const int pairs[][ 2 ] = { { 4326, 32618 }, { 32618, 4326 }, { 4326, 3857 }, { 3857, 4326 }, { 4326, 32188 }, { 26918, 32188 }, { 4326, 32760 } };
+
+	const double boxes[][ 4 ] = { { -78, -72, 0, 80 }, { -78, -72, 0, 80 }, { -180, 180, -85, 85 }, { -180, 180, -85, 85 }, { -76, -71, 44, 50 }, { -78, -72, 40, 50 }, { 174, 180, -80, 0 } };
+
+	const int count = sizeof( pairs ) / sizeof( pairs[ 0 ] );
+
+	int failures = 0;
+
+	for( int p = 0; p < count; p ++ )
+	{
+		OGRSpatialReferenceH geographic = OSRNewSpatialReference( NULL );
+		OGRSpatialReferenceH source = OSRNewSpatialReference( NULL );
+		OGRSpatialReferenceH target = OSRNewSpatialReference( NULL );
+
+		OSRImportFromEPSG( geographic, 4326 );
+		OSRImportFromEPSG( source, pairs[ p ][ 0 ] );
+		OSRImportFromEPSG( target, pairs[ p ][ 1 ] );
+
+#if GDAL_VERSION_MAJOR >= 3
+		OSRSetAxisMappingStrategy( geographic, OAMS_TRADITIONAL_GIS_ORDER );
+		OSRSetAxisMappingStrategy( source, OAMS_TRADITIONAL_GIS_ORDER );
+		OSRSetAxisMappingStrategy( target, OAMS_TRADITIONAL_GIS_ORDER );
+#endif
+
+		Prj *fast = Prj::Create( source, target );
+
+		OGRCoordinateTransformationH toSource = OCTNewCoordinateTransformation( geographic, source );
+		OGRCoordinateTransformationH transform = OCTNewCoordinateTransformation( source, target );
+
+		QString name = tr( "%1\t%2" ).arg( pairs[ p ][ 0 ] ).arg( pairs[ p ][ 1 ] );
+
+		if( fast == NULL || toSource == NULL || transform == NULL )
+		{
+			Print( tr( "projection\t%1\tnot supported" ).arg( name ) );
+		}
+		else
+		{
+			vector<double> x( features ), y( features ), z( features, 0 );
+			vector<int> success( features );
+
+			seed = 1;
+
+			for( int i = 0; i < features; i ++ )
+			{
+				x[ i ] = Random( boxes[ p ][ 0 ], boxes[ p ][ 1 ] );
+				y[ i ] = Random( boxes[ p ][ 2 ], boxes[ p ][ 3 ] );
+			}
+
+			OCTTransformEx( toSource, features, &x[ 0 ], &y[ 0 ], &z[ 0 ], &success[ 0 ] );
+
+			vector<double> fx( x ), fy( y );
+			vector<int> fsuccess( features );
+
+			QTime timer;
+
+			timer.start();
+
+			OCTTransformEx( transform, features, &x[ 0 ], &y[ 0 ], &z[ 0 ], &success[ 0 ] );
+
+			double proj = timer.elapsed() / 1000.0;
+
+			timer.start();
+
+			fast->Transform( features, &fx[ 0 ], &fy[ 0 ], &fsuccess[ 0 ] );
+
+			double closed = timer.elapsed() / 1000.0;
+
+			// degrees are compared as metres on the equator
+
+			double unit = OSRIsGeographic( target ) ? 111319.49 : 1.0;
+
+			double worst = 0;
+
+			int mismatches = 0;
+
+			for( int i = 0; i < features; i ++ )
+			{
+				if( success[ i ] != fsuccess[ i ] )
+				{
+					mismatches ++;
+				}
+				else if( success[ i ] )
+				{
+					double dx = fabs( fx[ i ] - x[ i ] ) * unit;
+					double dy = fabs( fy[ i ] - y[ i ] ) * unit;
+
+					worst = std::max( worst, std::max( dx, dy ) );
+				}
+			}
+
+			QString line = tr( "projection\t%1\t%2\t%3\t%4\t%5x\t%6 m" ).arg( name ).arg( features ).arg( proj, 0, 'f', 3 ).arg( closed, 0, 'f', 3 ).arg( closed > 0 ? proj / closed : 0, 0, 'f', 1 ).arg( worst, 0, 'g', 3 );
+
+			if( worst > 0.001 || mismatches > 0 )
+			{
+				line += tr( "\tinaccurate\t%1 mismatches" ).arg( mismatches );
+
+				failures ++;
+			}
+
+			Print( line );
+		}
+
+		delete fast;
+
+		if( toSource != NULL )
+		{
+			OCTDestroyCoordinateTransformation( toSource );
+		}
+
+		if( transform != NULL )
+		{
+			OCTDestroyCoordinateTransformation( transform );
+		}
+
+		OSRDestroySpatialReference( geographic );
+		OSRDestroySpatialReference( source );
+		OSRDestroySpatialReference( target );
+	}
+
+	return failures;
+}
+
+void Bch::CompareLookups( void )
+{
+	vector<int> codes( features );
+
+	seed = 1;
+
+	for( int i = 0; i < features; i ++ )
+	{
+		codes[ i ] = Dta::ProjectionCode( ( int ) Random( 1, Dta::Projections() - 1 ) );
+	}
+
+	// the sums keep the compiler from dropping the loops
+
+	long sum = 0;
+
+	QTime timer;
+
+	timer.start();
+
+	for( int i = 0; i < features; i ++ )
+	{
+		int row = 0;
+
+		while( row < Dta::Projections() && Dta::ProjectionCode( row ) != codes[ i ] )
+		{
+			row ++;
+		}
+
+		sum += row;
+	}
+
+	double linear = timer.elapsed() / 1000.0;
+
+	timer.start();
+
+	for( int i = 0; i < features; i ++ )
+	{
+		sum -= Dta::ProjectionRow( codes[ i ] );
+	}
+
+	double indexed = timer.elapsed() / 1000.0;
+
+	Print( tr( "lookup\tlinear\t%1\t%2" ).arg( features ).arg( linear, 0, 'f', 3 ) );
+	Print( tr( "lookup\tindex\t%1\t%2\t%3x" ).arg( features ).arg( indexed, 0, 'f', 3 ).arg( indexed > 0 ? linear / indexed : 0, 0, 'f', 1 ) + ( sum != 0 ? tr( "\tmismatch" ) : QString() ) );
+}
+
+int Bch::ComparePlans( void )
+{
+	int failures = ComparePlan( tr( "ESRI Shapefile" ), tr( "shp" ), tr( "f" ) );
+
+	// names longer than 10 characters are truncated by the shapefile target
+
+	failures += ComparePlan( tr( "GeoJSON" ), tr( "json" ), tr( "measurement_" ) );
+
+	return failures;
+}
+
+int Bch::ComparePlan( QString driver, QString extension, QString prefix )
+{
+	QString source = folder + tr( "/plan." ) + extension;
+	QString target = folder + tr( "/planned.shp" );
+
+	QString id = prefix + tr( "00" );
+	QString value = prefix + tr( "02" );
+
+	if( ! names.contains( driver ) || ! names.contains( tr( "ESRI Shapefile" ) ) || ! Generate( source, driver, KIND_POINTS, prefix ) )
+	{
+		Print( tr( "plan\t%1\tunable to generate" ).arg( driver ) );
+
+		return 0;
+	}
+
+	// a column list and a where clause run as a filter, with every field mode default
+
+	Ogr ogr;
+
+	string epsg;
+	string query;
+	string error;
+
+	int count;
+
+	OGR_Dr_DeleteDataSource( Drv::Driver( "ESRI Shapefile" ), target.toStdString().c_str() );
+
+	ogr.SetThreads( threads );
+
+	ogr.SetCountStrategy( Ogr::COUNT_NONE );
+
+	bool success = ogr.OpenSource( source.toStdString(), epsg, query, error ) && ogr.OpenDriver( "ESRI Shapefile" ) && ogr.OpenTarget( target.toStdString() );
+
+	// layer names depend on the driver, OpenSource gives SELECT * FROM <layer>
+
+	QString layer = QString( query.c_str() ).section( tr( " " ), 3 );
+
+	QString sql = tr( "SELECT %1, %2 FROM %3 WHERE %2 >= 10" ).arg( value ).arg( id ).arg( layer );
+
+	success = success && ogr.Prepare( count, sql.toStdString() ) && ogr.Run();
+
+	string plan = ogr.GetPlan();
+
+	ogr.CloseTarget();
+	ogr.CloseSource();
+
+	OGRDataSourceH sourceData = success ? Drv::Open( source.toStdString(), 0 ) : NULL;
+	OGRDataSourceH targetData = success ? Drv::Open( target.toStdString(), 0 ) : NULL;
+
+	int failures = 0;
+
+	long checked = 0;
+
+	if( sourceData == NULL || targetData == NULL || plan.compare( 0, 6, "layer " ) != 0 )
+	{
+		failures ++;
+	}
+	else
+	{
+		OGRLayerH sourceLayer = OGR_DS_GetLayer( sourceData, 0 );
+		OGRLayerH targetLayer = OGR_DS_GetLayer( targetData, 0 );
+
+		// generated values by feature number
+
+		QMap<int, double> values;
+
+		OGRFeatureH feature;
+
+		while( ( feature = OGR_L_GetNextFeature( sourceLayer ) ) != NULL )
+		{
+			OGRFeatureDefnH sourceDefn = OGR_F_GetDefnRef( feature );
+
+			values[ OGR_F_GetFieldAsInteger( feature, OGR_FD_GetFieldIndex( sourceDefn, id.toStdString().c_str() ) ) ] = OGR_F_GetFieldAsDouble( feature, OGR_FD_GetFieldIndex( sourceDefn, value.toStdString().c_str() ) );
+
+			OGR_F_Destroy( feature );
+		}
+
+		// target fields keep the source order whatever their names became
+
+		if( OGR_FD_GetFieldCount( OGR_L_GetLayerDefn( targetLayer ) ) != 2 )
+		{
+			failures ++;
+		}
+
+		while( failures == 0 && ( feature = OGR_L_GetNextFeature( targetLayer ) ) != NULL )
+		{
+			int number = OGR_F_GetFieldAsInteger( feature, 0 );
+
+			if( number < 10 || ! values.contains( number ) || fabs( OGR_F_GetFieldAsDouble( feature, 1 ) - values.value( number ) ) > 1e-6 )
+			{
+				failures ++;
+			}
+
+			OGR_F_Destroy( feature );
+
+			checked ++;
+		}
+
+		if( failures == 0 && checked != qMax( features - 10, 0 ) )
+		{
+			failures ++;
+		}
+	}
+
+	if( sourceData != NULL )
+	{
+		OGR_DS_Destroy( sourceData );
+	}
+
+	if( targetData != NULL )
+	{
+		OGR_DS_Destroy( targetData );
+	}
+
+	Print( tr( "plan\t%1\t%2\t%3" ).arg( driver ).arg( QString( plan.c_str() ) ).arg( checked ) + ( failures > 0 ? tr( "\tmismatch" ) : QString() ) );
+
+	return failures > 0 ? 1 : 0;
+}
+
+QMap<QString, double> Bch::Baseline( void )
+{
+	QMap<QString, double> baseline;
+
+	QFile file( folder + tr( "/baseline.tsv" ) );
+
+	if( ! file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+	{
+		return baseline;
+	}
+
+	QTextStream stream( &file );
+
+	while( ! stream.atEnd() )
+	{
+		QStringList columns = stream.readLine().split( tr( "\t" ) );
+
+		if( columns.size() > 7 && columns.at( 0 ) == tr( "bench" ) )
+		{
+			baseline[ QStringList( columns.mid( 1, 4 ) ).join( tr( "\t" ) ) ] = columns.at( 7 ).toDouble();
+		}
+	}
+
+	return baseline;
+}
+
+void Bch::Print( QString text )
+{
+	fprintf( stdout, "%s\n", text.toLocal8Bit().constData() );
+
+	fflush( stdout );
+}
+
+int Bch::Run( void )
+{
+	const char *kinds[ KIND_COUNT ] = { "points", "lines", "polygons", "wide", "mixed" };
+
+	// no reprojection, and a utm zone covering the synthetic data
+
+	int targets[ 2 ] = { 0, 32618 };
+
+	if( ! QDir().mkpath( folder ) )
+	{
+		Print( tr( "error\tunable to create " ) + folder );
+
+		return 2;
+	}
+
+	QFile file( folder + tr( "/results.tsv" ) );
+
+	if( ! file.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+	{
+		Print( tr( "error\tunable to write " ) + file.fileName() );
+
+		return 2;
+	}
+
+	QTextStream results( &file );
+
+	QMap<QString, double> baseline = Baseline();
+
+	// diverging transformation methods or an inaccurate closed form projection count as regressions
+
+	int regressions = CompareTransforms();
+
+	CompareLookups();
+
+	regressions += CompareProjections();
+
+	// columns of a planned query written to the wrong target fields
+
+	regressions += ComparePlans();
+
+	QString header = tr( "#\tkind\tsource\ttarget\tepsg\tfeatures\tseconds\tfeatures/s\tread\ttransform\twrite\tfailed" );
+
+	results << header << tr( "\n" );
+
+	Print( header + tr( "\tbaseline" ) );
+
+	for( int k = 0; k < KIND_COUNT; k ++ )
+	{
+		for( int s = 0; s < names.size(); s ++ )
+		{
+			QString source = folder + tr( "/%1-%2.%3" ).arg( kinds[ k ] ).arg( s ).arg( extensions.at( s ) );
+
+			if( ! Generate( source, names.at( s ), k ) )
+			{
+				Print( tr( "skip\t%1\t%2\tunable to generate" ).arg( kinds[ k ] ).arg( names.at( s ) ) );
+
+				continue;
+			}
+
+			for( int t = 0; t < names.size(); t ++ )
+			{
+				QString target = folder + tr( "/target.%1" ).arg( extensions.at( t ) );
+
+				for( int p = 0; p < 2; p ++ )
+				{
+					Ogr::Stats stats;
+
+					// the first run only warms file and driver caches
+
+					if( ! Convert( source, target, names.at( t ), targets[ p ], stats ) )
+					{
+						Print( tr( "skip\t%1\t%2\t%3\t%4\tconversion failed" ).arg( kinds[ k ] ).arg( names.at( s ) ).arg( names.at( t ) ).arg( targets[ p ] ) );
+
+						continue;
+					}
+
+					vector<double> times;
+
+					for( int r = 0; r < repeats; r ++ )
+					{
+						QTime timer;
+
+						timer.start();
+
+						Convert( source, target, names.at( t ), targets[ p ], stats );
+
+						times.push_back( timer.elapsed() / 1000.0 );
+					}
+
+					sort( times.begin(), times.end() );
+
+					double median = times[ times.size() / 2 ];
+
+					double rate = ( median > 0 ) ? stats.read / median : 0;
+
+					QString key = tr( "%1\t%2\t%3\t%4" ).arg( kinds[ k ] ).arg( names.at( s ) ).arg( names.at( t ) ).arg( targets[ p ] );
+
+					QString line = tr( "bench\t%1\t%2\t%3\t%4\t%5\t%6\t%7\t%8\t%9" ).arg( key ).arg( stats.read ).arg( median, 0, 'f', 3 ).arg( rate, 0, 'f', 0 ).arg( stats.wall[ Ogr::STAGE_READ ], 0, 'f', 3 ).arg( stats.wall[ Ogr::STAGE_TRANSFORM ], 0, 'f', 3 ).arg( stats.wall[ Ogr::STAGE_WRITE ], 0, 'f', 3 ).arg( stats.failed );
+
+					results << line << tr( "\n" );
+
+					// a case more than 10 % slower than its baseline is a regression
+
+					if( baseline.contains( key ) && baseline[ key ] > 0 )
+					{
+						double ratio = rate / baseline[ key ];
+
+						line += tr( "\t%1" ).arg( ratio, 0, 'f', 2 );
+
+						if( ratio < 0.9 )
+						{
+							line += tr( "\tregression" );
+
+							regressions ++;
+						}
+					}
+
+					Print( line );
+				}
+			}
+		}
+	}
+
+	Print( tr( "cache\t" ) + QString( Srs::Counters().c_str() ) );
+
+	Print( tr( "summary\t%1 regressions" ).arg( regressions ) );
+
+	return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,799 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Cli.cpp
+ *	\brief Command line batch mode
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Cli.h"
+#include "../inc/Srs.h"
+
+#include <cstdio>
+
+Cli::Cli( void )
+{
+	succeeded = 0;
+	failed = 0;
+
+	concurrency = QThread::idealThreadCount();
+
+	retries = 0;
+}
+
+Cli::~Cli( void )
+{
+	qDeleteAll( jobs );
+}
+
+QStringList Cli::Split( QString line, bool &ok )
+{
+	QStringList tokens;
+
+	QString token;
+
+	bool quoted = false;
+	bool started = false;
+
+	for( int i = 0; i < line.size(); i ++ )
+	{
+		QChar c = line.at( i );
+
+		if( c == '"' )
+		{
+			quoted = ! quoted;
+
+			started = true;
+		}
+		else if( c.isSpace() && ! quoted )
+		{
+			if( started )
+			{
+				tokens << token;
+
+				token.clear();
+
+				started = false;
+			}
+		}
+		else
+		{
+			token += c;
+
+			started = true;
+		}
+	}
+
+	if( started )
+	{
+		tokens << token;
+	}
+
+	ok = ! quoted;
+
+	return tokens;
+}
+
+Job *Cli::Parse( QString line, QString &error )
+{
+	bool ok;
+
+	QStringList tokens = Split( line, ok );
+
+	if( ! ok )
+	{
+		error = tr( "unclosed quote" );
+
+		return NULL;
+	}
+
+	if( ! tokens.isEmpty() && tokens.first() == tr( "ogr2ogr" ) )
+	{
+		tokens.removeFirst();
+	}
+
+	return Create( tokens, error );
+}
+
+Job *Cli::Create( QStringList tokens, QString &error )
+{
+	bool ok;
+
+	QString driver = tr( "ESRI Shapefile" );
+	QString query;
+	QString extent;
+	QString json;
+
+	QStringList names;
+
+	int projection = 0;
+	int extentProjection = 0;
+	int dimension = 0;
+	int group = -1;
+	int checkpoint = 0;
+	int count = Ogr::COUNT_ESTIMATE;
+	int fields = Ogr::FIELDS_ALL;
+
+	bool update = false;
+	bool resumed = false;
+
+	vector<string> selected;
+
+	QStringList valued;
+
+	valued << tr( "-f" ) << tr( "-t_srs" ) << tr( "-sql" ) << tr( "-dim" ) << tr( "-select" ) << tr( "-nlt" ) << tr( "-spat_srs" ) << tr( "-gt" ) << tr( "-count" ) << tr( "-checkpoint" ) << tr( "-json" );
+
+	for( int i = 0; i < tokens.size(); i ++ )
+	{
+		QString option = tokens.at( i ).toLower();
+
+		if( valued.contains( option ) && i + 1 >= tokens.size() )
+		{
+			error = tr( "missing value for " ) + option;
+
+			return NULL;
+		}
+
+		if( option == tr( "-f" ) )
+		{
+			driver = tokens.at( ++ i );
+		}
+		else if( option == tr( "-overwrite" ) )
+		{
+			update = false;
+		}
+		else if( option == tr( "-append" ) || option == tr( "-update" ) )
+		{
+			update = true;
+		}
+		else if( option == tr( "-t_srs" ) || option == tr( "-spat_srs" ) )
+		{
+			QString srs = tokens.at( ++ i );
+
+			if( ! srs.startsWith( tr( "EPSG:" ), Qt::CaseInsensitive ) )
+			{
+				error = option + tr( " only takes EPSG:<code>" );
+
+				return NULL;
+			}
+
+			int code = srs.mid( 5 ).toInt( &ok );
+
+			if( ! ok || code <= 0 )
+			{
+				error = tr( "invalid projection " ) + srs;
+
+				return NULL;
+			}
+
+			if( option == tr( "-t_srs" ) )
+			{
+				projection = code;
+			}
+			else
+			{
+				extentProjection = code;
+			}
+		}
+		else if( option == tr( "-sql" ) )
+		{
+			query = tokens.at( ++ i );
+		}
+		else if( option == tr( "-dim" ) )
+		{
+			dimension = tokens.at( ++ i ).toInt( &ok );
+
+			if( ! ok || ( dimension != 2 && dimension != 3 ) )
+			{
+				error = tr( "-dim only takes 2 or 3" );
+
+				return NULL;
+			}
+		}
+		else if( option == tr( "-select" ) )
+		{
+			QStringList list = tokens.at( ++ i ).split( tr( "," ), QString::SkipEmptyParts );
+
+			for( int j = 0; j < list.size(); j ++ )
+			{
+				selected.push_back( list.at( j ).trimmed().toStdString() );
+			}
+
+			fields = selected.empty() ? Ogr::FIELDS_GEOMETRY : Ogr::FIELDS_SELECTED;
+		}
+		else if( option == tr( "-nlt" ) )
+		{
+			if( tokens.at( ++ i ).toLower() != tr( "none" ) )
+			{
+				error = tr( "-nlt only takes NONE" );
+
+				return NULL;
+			}
+
+			fields = Ogr::FIELDS_ATTRIBUTES;
+		}
+		else if( option == tr( "-spat" ) )
+		{
+			if( i + 4 >= tokens.size() )
+			{
+				error = tr( "-spat takes xmin ymin xmax ymax" );
+
+				return NULL;
+			}
+
+			extent = tokens.mid( i + 1, 4 ).join( tr( " " ) );
+
+			i += 4;
+		}
+		else if( option == tr( "-gt" ) )
+		{
+			group = tokens.at( ++ i ).toInt( &ok );
+
+			if( ! ok || group < 0 )
+			{
+				error = tr( "invalid group size " ) + tokens.at( i );
+
+				return NULL;
+			}
+		}
+		else if( option == tr( "-checkpoint" ) )
+		{
+			checkpoint = tokens.at( ++ i ).toInt( &ok );
+
+			if( ! ok || checkpoint < 0 )
+			{
+				error = tr( "invalid checkpoint size " ) + tokens.at( i );
+
+				return NULL;
+			}
+		}
+		else if( option == tr( "-json" ) )
+		{
+			json = tokens.at( ++ i );
+		}
+		else if( option == tr( "-resume" ) )
+		{
+			resumed = true;
+		}
+		else if( option == tr( "-count" ) )
+		{
+			QString strategy = tokens.at( ++ i ).toLower();
+
+			if( strategy == tr( "exact" ) )
+			{
+				count = Ogr::COUNT_EXACT;
+			}
+			else if( strategy == tr( "fast" ) )
+			{
+				count = Ogr::COUNT_FAST;
+			}
+			else if( strategy == tr( "estimate" ) )
+			{
+				count = Ogr::COUNT_ESTIMATE;
+			}
+			else if( strategy == tr( "none" ) )
+			{
+				count = Ogr::COUNT_NONE;
+			}
+			else
+			{
+				error = tr( "-count takes exact, fast, estimate or none" );
+
+				return NULL;
+			}
+		}
+		else if( option.startsWith( tr( "-" ) ) )
+		{
+			error = tr( "unsupported option " ) + tokens.at( i );
+
+			return NULL;
+		}
+		else
+		{
+			names << tokens.at( i );
+		}
+	}
+
+	// target, source and an optional layer name, as ogr2ogr
+
+	if( names.size() < 2 || names.size() > 3 )
+	{
+		error = tr( "expected target, source and an optional layer" );
+
+		return NULL;
+	}
+
+	// the interface only writes extents given in the target projection
+
+	if( extentProjection > 0 && extentProjection != projection )
+	{
+		error = tr( "-spat_srs must match -t_srs" );
+
+		return NULL;
+	}
+
+	Job *job = new Job( jobs.size(), names.at( 1 ), names.at( 0 ), driver, projection );
+
+	Ogr *engine = job->GetOgr();
+
+	engine->SetFields( fields, selected );
+
+	engine->SetCountStrategy( count );
+
+	engine->SetDimension( dimension );
+
+	if( group >= 0 )
+	{
+		engine->SetGroupSize( group );
+	}
+
+	engine->SetCheckpoint( checkpoint, resumed );
+
+	if( names.size() == 3 )
+	{
+		engine->SetSourceLayer( names.at( 2 ).toStdString() );
+	}
+
+	if( ! engine->SetExtent( extent.toStdString(), extentProjection > 0 ) )
+	{
+		error = QString( engine->GetError().c_str() );
+
+		delete job;
+
+		return NULL;
+	}
+
+	job->SetQuery( query );
+
+	job->SetUpdate( update );
+
+	appends << update;
+
+	checkpoints << checkpoint;
+
+	reports << json;
+
+	return job;
+}
+
+bool Cli::Load( QString filename )
+{
+	QSettings manifest( filename, QSettings::IniFormat );
+
+	if( ! QFile::exists( filename ) || manifest.status() != QSettings::NoError )
+	{
+		Print( tr( "error\t0\tunable to read " ) + filename );
+
+		return false;
+	}
+
+	manifest.beginGroup( tr( "general" ) );
+
+	concurrency = qMax( 1, manifest.value( tr( "concurrency" ), concurrency ).toInt() );
+
+	retries = qMax( 0, manifest.value( tr( "retries" ), retries ).toInt() );
+
+	report = manifest.value( tr( "report" ) ).toString();
+
+	manifest.endGroup();
+
+	QStringList groups = manifest.childGroups();
+
+	bool valid = true;
+
+	for( int i = 0; i < groups.size(); i ++ )
+	{
+		if( groups.at( i ) == tr( "general" ) )
+		{
+			continue;
+		}
+
+		manifest.beginGroup( groups.at( i ) );
+
+		// a section is the option set of one ogr2ogr command
+
+		QStringList tokens;
+
+		tokens << tr( "-f" ) << manifest.value( tr( "format" ), tr( "ESRI Shapefile" ) ).toString();
+
+		QString mode = manifest.value( tr( "mode" ), tr( "overwrite" ) ).toString();
+
+		tokens << tr( "-" ) + mode;
+
+		// srs is a bare code, or EPSG:<code> as in command files
+
+		QString srs = manifest.value( tr( "srs" ) ).toString().trimmed();
+
+		if( ! srs.isEmpty() && ! srs.startsWith( tr( "EPSG:" ), Qt::CaseInsensitive ) )
+		{
+			srs.prepend( tr( "EPSG:" ) );
+		}
+
+		if( manifest.contains( tr( "srs" ) ) )
+		{
+			tokens << tr( "-t_srs" ) << srs;
+		}
+
+		// unquoted commas split ini values into lists, sql and connection strings have some
+
+		QString query = manifest.value( tr( "query" ) ).toStringList().join( tr( "," ) ).trimmed();
+		QString source = manifest.value( tr( "source" ) ).toStringList().join( tr( "," ) ).trimmed();
+		QString target = manifest.value( tr( "target" ) ).toStringList().join( tr( "," ) ).trimmed();
+
+		QString missing;
+
+		if( manifest.contains( tr( "query" ) ) && query.isEmpty() )
+		{
+			missing = tr( "empty query" );
+		}
+		else if( source.isEmpty() )
+		{
+			missing = tr( "no source" );
+		}
+		else if( target.isEmpty() )
+		{
+			missing = tr( "no target" );
+		}
+
+		if( ! missing.isEmpty() )
+		{
+			manifest.endGroup();
+
+			Print( tr( "error\t%1\t%2" ).arg( groups.at( i ) ).arg( missing ) );
+
+			valid = false;
+
+			continue;
+		}
+
+		if( manifest.contains( tr( "query" ) ) )
+		{
+			tokens << tr( "-sql" ) << query;
+		}
+
+		if( manifest.contains( tr( "dim" ) ) )
+		{
+			tokens << tr( "-dim" ) << manifest.value( tr( "dim" ) ).toString();
+		}
+
+		if( manifest.contains( tr( "select" ) ) )
+		{
+			tokens << tr( "-select" ) << manifest.value( tr( "select" ) ).toStringList().join( tr( "," ) );
+		}
+
+		if( manifest.value( tr( "attributes" ), false ).toBool() )
+		{
+			tokens << tr( "-nlt" ) << tr( "NONE" );
+		}
+
+		if( manifest.contains( tr( "extent" ) ) )
+		{
+			tokens << tr( "-spat" ) << manifest.value( tr( "extent" ) ).toStringList().join( tr( " " ) ).split( tr( " " ), QString::SkipEmptyParts );
+		}
+
+		if( manifest.value( tr( "extent_target" ), false ).toBool() && manifest.contains( tr( "srs" ) ) )
+		{
+			tokens << tr( "-spat_srs" ) << srs;
+		}
+
+		if( manifest.contains( tr( "group" ) ) )
+		{
+			tokens << tr( "-gt" ) << manifest.value( tr( "group" ) ).toString();
+		}
+
+		if( manifest.contains( tr( "json" ) ) )
+		{
+			tokens << tr( "-json" ) << manifest.value( tr( "json" ) ).toString();
+		}
+
+		if( manifest.contains( tr( "checkpoint" ) ) )
+		{
+			tokens << tr( "-checkpoint" ) << manifest.value( tr( "checkpoint" ) ).toString();
+		}
+
+		if( manifest.value( tr( "resume" ), false ).toBool() )
+		{
+			tokens << tr( "-resume" );
+		}
+
+		if( manifest.contains( tr( "count" ) ) )
+		{
+			tokens << tr( "-count" ) << manifest.value( tr( "count" ) ).toString();
+		}
+
+		tokens << target << source;
+
+		if( manifest.contains( tr( "layer" ) ) )
+		{
+			tokens << manifest.value( tr( "layer" ) ).toString();
+		}
+
+		int attempts = qMax( 0, manifest.value( tr( "retries" ), retries ).toInt() ) + 1;
+
+		manifest.endGroup();
+
+		QString error;
+
+		Job *job = Create( tokens, error );
+
+		if( job == NULL )
+		{
+			Print( tr( "error\t%1\t%2" ).arg( groups.at( i ) ).arg( error ) );
+
+			valid = false;
+
+			continue;
+		}
+
+		Print( tr( "job\t%1\t%2" ).arg( jobs.size() ).arg( groups.at( i ) ) );
+
+		jobs << job;
+
+		labels << groups.at( i );
+
+		remaining << attempts;
+	}
+
+	return valid;
+}
+
+bool Cli::Read( QString filename )
+{
+	QFile file( filename );
+
+	if( ! file.open( QIODevice::ReadOnly | QIODevice::Text ) )
+	{
+		Print( tr( "error\t0\tunable to open " ) + filename );
+
+		return false;
+	}
+
+	QTextStream stream( &file );
+
+	int number = 0;
+
+	bool valid = true;
+
+	while( ! stream.atEnd() )
+	{
+		QString line = stream.readLine().trimmed();
+
+		number ++;
+
+		if( line.isEmpty() || line.startsWith( tr( "#" ) ) )
+		{
+			continue;
+		}
+
+		QString error;
+
+		Job *job = Parse( line, error );
+
+		if( job == NULL )
+		{
+			Print( tr( "error\t%1\t%2" ).arg( number ).arg( error ) );
+
+			valid = false;
+
+			continue;
+		}
+
+		Print( tr( "job\t%1\t%2" ).arg( jobs.size() ).arg( line ) );
+
+		jobs << job;
+
+		labels << line;
+
+		remaining << retries + 1;
+	}
+
+	return valid;
+}
+
+void Cli::Print( QString text )
+{
+	QMutexLocker locker( &mutex );
+
+	fprintf( stdout, "%s\n", text.toLocal8Bit().constData() );
+
+	fflush( stdout );
+}
+
+int Cli::Run( QString filename )
+{
+	bool valid;
+
+	if( filename.endsWith( tr( ".ini" ) ) )
+	{
+		valid = Load( filename );
+	}
+	else
+	{
+		valid = Read( filename );
+	}
+
+	if( ! valid )
+	{
+		return 2;
+	}
+
+	results.fill( false, jobs.size() );
+
+	messages.clear();
+
+	for( int i = 0; i < jobs.size(); i ++ )
+	{
+		messages << QString();
+	}
+
+	attempts.fill( 0, jobs.size() );
+
+	// every running job gets a share of the cores for its reprojection pipeline
+
+	int running = qMax( 1, qMin( concurrency, jobs.size() ) );
+
+	int threads = qMax( 1, QThread::idealThreadCount() / running );
+
+	QThreadPool pool;
+
+	pool.setMaxThreadCount( running );
+
+	QTime timer;
+
+	timer.start();
+
+	for( int i = 0; i < jobs.size(); i ++ )
+	{
+		Job *job = jobs.at( i );
+
+		job->GetOgr()->SetThreads( threads );
+
+		// no event loop runs, results are printed from the job threads
+
+		QObject::connect( job, SIGNAL( progress( int, int, int ) ), this, SLOT( evtJobProgress( int, int, int ) ), Qt::DirectConnection );
+
+		QObject::connect( job, SIGNAL( finished( int, bool, QString ) ), this, SLOT( evtJobFinished( int, bool, QString ) ), Qt::DirectConnection );
+	}
+
+	QList<int> queue;
+
+	for( int i = 0; i < jobs.size(); i ++ )
+	{
+		queue << i;
+	}
+
+	// failed jobs are retried in rounds, once every other job had its turn
+
+	while( ! queue.isEmpty() )
+	{
+		for( int i = 0; i < queue.size(); i ++ )
+		{
+			attempts[ queue.at( i ) ] ++;
+
+			pool.start( jobs.at( queue.at( i ) ) );
+		}
+
+		pool.waitForDone();
+
+		QList<int> failures;
+
+		for( int i = 0; i < queue.size(); i ++ )
+		{
+			int index = queue.at( i );
+
+			// a partial append can't be undone, only a checkpoint lets it go on
+
+			if( ! results.at( index ) && ( ! appends.at( index ) || checkpoints.at( index ) > 0 ) && attempts.at( index ) < remaining.at( index ) )
+			{
+				jobs.at( index )->GetOgr()->SetCheckpoint( checkpoints.at( index ), true );
+
+				Print( tr( "retry\t%1\t%2" ).arg( index ).arg( attempts.at( index ) + 1 ) );
+
+				failures << index;
+			}
+		}
+
+		queue = failures;
+	}
+
+	for( int i = 0; i < jobs.size(); i ++ )
+	{
+		if( results.at( i ) )
+		{
+			succeeded ++;
+		}
+		else
+		{
+			failed ++;
+		}
+	}
+
+	double seconds = timer.elapsed() / 1000.0;
+
+	Print( tr( "summary\t%1\t%2\t%3\t%4" ).arg( jobs.size() ).arg( succeeded ).arg( failed ).arg( seconds, 0, 'f', 3 ) );
+
+	Print( tr( "cache\t" ) + QString( Srs::Counters().c_str() ) );
+
+	if( ! report.isEmpty() && ! Report( report, seconds ) )
+	{
+		Print( tr( "error\t0\tunable to write " ) + report );
+	}
+
+	return failed > 0 ? 1 : 0;
+}
+
+bool Cli::Report( QString filename, double seconds )
+{
+	QFile file( filename );
+
+	if( ! file.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+	{
+		return false;
+	}
+
+	QTextStream stream( &file );
+
+	stream << tr( "job\tstatus\tattempts\tseconds\tname\tmessage\n" );
+
+	for( int i = 0; i < jobs.size(); i ++ )
+	{
+		stream << tr( "%1\t%2\t%3\t%4\t%5\t%6\n" ).arg( i ).arg( results.at( i ) ? tr( "ok" ) : tr( "failed" ) ).arg( attempts.at( i ) ).arg( jobs.at( i )->GetElapsed(), 0, 'f', 3 ).arg( labels.at( i ) ).arg( messages.at( i ) );
+	}
+
+	stream << tr( "total\t%1/%2\t\t%3\t\t\n" ).arg( succeeded ).arg( jobs.size() ).arg( seconds, 0, 'f', 3 );
+
+	return true;
+}
+
+void Cli::evtJobProgress( int index, int count, int percent )
+{
+	Print( tr( "progress\t%1\t%2\t%3" ).arg( index ).arg( percent ).arg( count ) );
+}
+
+void Cli::evtJobFinished( int index, bool success, QString message )
+{
+	mutex.lock();
+
+	results[ index ] = success;
+
+	messages[ index ] = QString( message ).replace( tr( "\n" ), tr( "; " ) );
+
+	mutex.unlock();
+
+	if( ! reports.at( index ).isEmpty() )
+	{
+		QFile file( reports.at( index ) );
+
+		if( file.open( QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text ) )
+		{
+			file.write( QByteArray( jobs.at( index )->GetOgr()->GetReport().c_str() ) + "\n" );
+		}
+		else
+		{
+			Print( tr( "error\t%1\tunable to write " ).arg( index ) + reports.at( index ) );
+		}
+	}
+
+	Print( tr( "done\t%1\t%2\t%3\t%4" ).arg( index ).arg( success ? tr( "ok" ) : tr( "failed" ) ).arg( jobs.at( index )->GetElapsed(), 0, 'f', 3 ).arg( messages.at( index ) ) );
+}
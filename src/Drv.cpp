@@ -0,0 +1,245 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Drv.cpp
+ *	\brief Driver registry
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Drv.h"
+
+#include "ogrsf_frmts.h"
+#include "gdal_version.h"
+#include "cpl_port.h"
+
+#include "sys/time.h"
+
+#include <cctype>
+#include <cstring>
+
+/*!
+ *	Formats of the interface tables. Drivers that are optional in a GDAL
+ *	build are only called when the matching DRV_ flag is defined, else
+ *	they come with the OGRRegisterAll fallback.
+ */
+const Drv::Entry Drv::entries[] =
+{
+	{ "ESRI Shapefile",		"shp dbf",		NULL,		RegisterOGRShape },
+	{ "MapInfo File",		"tab mif",		NULL,		RegisterOGRTAB },
+#if GDAL_VERSION_MAJOR < 3
+	{ "BNA",				"bna",			NULL,		RegisterOGRBNA },
+	{ "XPlane",				"dat",			NULL,		RegisterOGRXPlane },
+#endif
+	{ "CSV",				"csv",			NULL,		RegisterOGRCSV },
+	{ "GML",				"gml",			NULL,		RegisterOGRGML },
+	{ "KML",				"kml",			NULL,		RegisterOGRKML },
+	{ "GMT",				"gmt",			NULL,		RegisterOGRGMT },
+	{ "GPX",				"gpx",			NULL,		RegisterOGRGPX },
+	{ "Geoconcept",			"gxt",			NULL,		RegisterOGRGeoconcept },
+	{ "GeoJSON",			"geojson json txt",	NULL,	RegisterOGRGeoJSON },
+	{ "UK. NTF",			"ntf",			NULL,		RegisterOGRNTF },
+#ifdef DRV_FME
+	{ "FMEObjects Gateway",	"fdd",			NULL,		RegisterOGRFME },
+#endif
+#ifdef DRV_PG
+	{ "PostgreSQL",			"",				"PG:",		RegisterOGRPG },
+#endif
+#ifdef DRV_SQLITE
+	{ "SQLite",				"sqlite db",	NULL,		RegisterOGRSQLite },
+#endif
+#ifdef DRV_OCI
+	{ "OCI",				"",				"OCI:",		RegisterOGROCI },
+#endif
+#ifdef DRV_MYSQL
+	{ "MySQL",				"",				"MYSQL:",	RegisterOGRMySQL },
+#endif
+#ifdef DRV_ODBC
+	{ "ODBC",				"",				"ODBC:",	RegisterOGRODBC },
+#endif
+	{ NULL,					NULL,			NULL,		NULL }
+};
+
+CPLMutex *Drv::mutex = NULL;
+
+vector<bool> Drv::registered;
+
+bool Drv::all = false;
+
+static double Clock( void )
+{
+	struct timeval now;
+
+	gettimeofday( &now, NULL );
+
+	return now.tv_sec + now.tv_usec / 1000000.0;
+}
+
+int Drv::Find( string name )
+{
+	for( int i = 0; entries[ i ].name != NULL; i ++ )
+	{
+		if( EQUAL( entries[ i ].name, name.c_str() ) )
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+int Drv::Guess( string filename )
+{
+	for( int i = 0; entries[ i ].name != NULL; i ++ )
+	{
+		if( entries[ i ].prefix != NULL && EQUALN( filename.c_str(), entries[ i ].prefix, strlen( entries[ i ].prefix ) ) )
+		{
+			return i;
+		}
+	}
+
+	size_t dot = filename.find_last_of( "./\\" );
+
+	if( dot == string::npos || filename[ dot ] != '.' )
+	{
+		return -1;
+	}
+
+	string extension = " ";
+
+	for( size_t i = dot + 1; i < filename.size(); i ++ )
+	{
+		extension += tolower( filename[ i ] );
+	}
+
+	extension += " ";
+
+	for( int i = 0; entries[ i ].name != NULL; i ++ )
+	{
+		if( ( string( " " ) + entries[ i ].extensions + " " ).find( extension ) != string::npos )
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+double Drv::Register( int index )
+{
+	CPLMutexHolderD( &mutex );
+
+	if( registered.empty() )
+	{
+		registered.resize( sizeof( entries ) / sizeof( entries[ 0 ] ), false );
+	}
+
+	if( all || registered[ index ] )
+	{
+		return 0;
+	}
+
+	double start = Clock();
+
+	entries[ index ].registration();
+
+	registered[ index ] = true;
+
+	return Clock() - start;
+}
+
+double Drv::RegisterAll( void )
+{
+	CPLMutexHolderD( &mutex );
+
+	if( all )
+	{
+		return 0;
+	}
+
+	double start = Clock();
+
+	OGRRegisterAll();
+
+	all = true;
+
+	return Clock() - start;
+}
+
+OGRSFDriverH Drv::Driver( string name )
+{
+	int index = Find( name );
+
+	if( index >= 0 )
+	{
+		Register( index );
+	}
+	else
+	{
+		RegisterAll();
+	}
+
+	return OGRGetDriverByName( name.c_str() );
+}
+
+OGRDataSourceH Drv::Open( string filename, int update )
+{
+	int index = Guess( filename );
+
+	if( index >= 0 )
+	{
+		Register( index );
+
+		OGRDataSourceH data = OGROpen( filename.c_str(), update, NULL );
+
+		if( data != NULL )
+		{
+			return data;
+		}
+	}
+
+	// unknown or misnamed, every driver gets a chance
+
+	RegisterAll();
+
+	return OGROpen( filename.c_str(), update, NULL );
+}
+
+vector<string> Drv::Names( void )
+{
+	vector<string> names;
+
+	for( int i = 0; entries[ i ].name != NULL; i ++ )
+	{
+		names.push_back( entries[ i ].name );
+	}
+
+	return names;
+}
+
+double Drv::Time( string name )
+{
+	int index = Find( name );
+
+	return index >= 0 ? Register( index ) : 0;
+}
@@ -0,0 +1,252 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Job.cpp
+ *	\brief Conversion job
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Job.h"
+
+Job::Job( int i, QString s, QString t, QString d, int p )
+{
+	ogr = new Ogr();
+
+	index = i;
+
+	source = s;
+	target = t;
+	driver = d;
+
+	projection = p;
+
+	update = false;
+
+	canceled = 0;
+
+	elapsed = 0;
+
+	total = 0;
+	percent = -1;
+
+	count = 0;
+	reported = 0;
+	reportedTime = 0;
+
+	setAutoDelete( false );
+}
+
+Job::~Job( void )
+{
+	delete ogr;
+}
+
+void Job::run( void )
+{
+	string epsg;
+	string layerQuery;
+	string error;
+
+	bool success = false;
+
+	QString message;
+
+	clock.start();
+
+	percent = -1;
+
+	count = 0;
+	reported = 0;
+	reportedTime = 0;
+
+	// jobs canceled while waiting in the pool never touch their target
+
+	if( canceled )
+	{
+		emit finished( index, false, tr( "canceled" ) );
+
+		return;
+	}
+
+	if( ogr->OpenSource( source.toStdString(), epsg, layerQuery, error ) )
+	{
+		if( ogr->OpenDriver( driver.toStdString(), error ) )
+		{
+			if( ogr->OpenTarget( target.toStdString(), projection, update ) )
+			{
+				ogr->SetProgress( Progress, this );
+
+				if( ogr->Prepare( total, query.toStdString() ) )
+				{
+					success = ogr->Run();
+
+					QStringList lines;
+
+					if( ! ogr->GetPlan().empty() )
+					{
+						lines << tr( "query plan : " ) + QString( ogr->GetPlan().c_str() );
+					}
+
+					if( ogr->GetResumed() > 0 )
+					{
+						lines << tr( "resumed after %1 features" ).arg( ogr->GetResumed() );
+					}
+
+					if( canceled )
+					{
+						lines << tr( "canceled" );
+					}
+					else if( ! success )
+					{
+						lines << QString( ogr->GetError().c_str() );
+					}
+
+					lines << tr( "process time : %1 s, transform time : %2 s" ).arg( ogr->GetProcessTime(), 0, 'f', 3 ).arg( ogr->GetTransformTime(), 0, 'f', 3 );
+
+					if( ogr->GetCommitCount() > 0 )
+					{
+						lines << tr( "commits : %1, commit time : %2 s, average : %3 ms" ).arg( ogr->GetCommitCount() ).arg( ogr->GetCommitTime(), 0, 'f', 3 ).arg( 1000 * ogr->GetCommitTime() / ogr->GetCommitCount(), 0, 'f', 1 );
+					}
+
+					lines << Stages();
+
+					message = lines.join( tr( "\n" ) );
+				}
+				else
+				{
+					message = QString( ogr->GetError().c_str() );
+				}
+
+				// the last transaction is committed on close
+
+				if( ! ogr->CloseTarget() && success )
+				{
+					success = false;
+
+					message = QString( ogr->GetError().c_str() ) + tr( "\n" ) + message;
+				}
+			}
+			else
+			{
+				message = tr( "unable to open target !" );
+			}
+		}
+		else
+		{
+			message = tr( "unable to open driver !" );
+		}
+
+		ogr->CloseSource();
+	}
+	else
+	{
+		message = tr( "unable to open source !" );
+	}
+
+	elapsed = clock.elapsed() / 1000.0;
+
+	emit progress( index, count, success ? 100 : qMax( percent, 0 ) );
+
+	emit finished( index, success, message );
+}
+
+Ogr *Job::GetOgr( void )
+{
+	return ogr;
+}
+
+void Job::SetQuery( QString sql )
+{
+	query = sql;
+}
+
+void Job::SetUpdate( bool mode )
+{
+	update = mode;
+}
+
+double Job::GetElapsed( void )
+{
+	return elapsed;
+}
+
+void Job::Cancel( void )
+{
+	canceled = 1;
+}
+
+QStringList Job::Stages( void )
+{
+	Ogr::Stats stats = ogr->GetStats();
+
+	QStringList names;
+
+	names << tr( "open" ) << tr( "prepare" ) << tr( "read" ) << tr( "transform" ) << tr( "write" );
+
+	QStringList wall;
+	QStringList cpu;
+
+	for( int i = 0; i < Ogr::STAGE_COUNT; i ++ )
+	{
+		wall << tr( "%1 %2 s" ).arg( names.at( i ) ).arg( stats.wall[ i ], 0, 'f', 3 );
+		cpu << tr( "%1 %2 s" ).arg( names.at( i ) ).arg( stats.cpu[ i ], 0, 'f', 3 );
+	}
+
+	QStringList lines;
+
+	lines << tr( "wall : " ) + wall.join( tr( ", " ) );
+	lines << tr( "cpu : " ) + cpu.join( tr( ", " ) );
+	lines << tr( "features : %1 read, %2 written, %3 failed, %4 MB" ).arg( stats.read ).arg( stats.written ).arg( stats.failed ).arg( stats.bytes / ( 1024 * 1024 ), 0, 'f', 1 );
+
+	return lines;
+}
+
+bool Job::Progress( int count, void *data )
+{
+	Job *job = ( Job * ) data;
+
+	job->count = count;
+
+	int now = job->clock.elapsed();
+
+	// repainting for every feature would cost more than converting it
+
+	if( now - job->reportedTime >= 50 || count - job->reported >= 50000 )
+	{
+		job->reported = count;
+		job->reportedTime = now;
+
+		// -1 tells the interface the job has no count to measure against
+
+		int p = ( job->total > 0 ) ? ( int ) ( 100.0 * count / job->total ) : -1;
+
+		job->percent = qMin( p, 100 );
+
+		emit job->progress( job->index, count, job->percent );
+	}
+
+	// the engine stops reading and the target is closed as usual
+
+	return ! job->canceled;
+}
@@ -0,0 +1,72 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Mdl.cpp
+ *	\brief Projection list model
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Mdl.h"
+#include "../inc/Dta.h"
+
+Mdl::Mdl( QObject *parent ) : QAbstractListModel( parent )
+{
+}
+
+int Mdl::rowCount( const QModelIndex &parent ) const
+{
+	if( parent.isValid() )
+	{
+		return 0;
+	}
+
+	return Dta::Projections();
+}
+
+QVariant Mdl::data( const QModelIndex &index, int role ) const
+{
+	if( ! index.isValid() || index.row() < 0 || index.row() >= Dta::Projections() )
+	{
+		return QVariant();
+	}
+
+	int row = index.row();
+
+	if( role == Qt::DisplayRole || role == Qt::EditRole )
+	{
+		if( row == 0 )
+		{
+			return QString();
+		}
+
+		return QString::number( Dta::ProjectionCode( row ) ) + tr( " : " ) + Dta::ProjectionName( row );
+	}
+
+	if( role == Qt::UserRole )
+	{
+		return Dta::ProjectionCode( row );
+	}
+
+	return QVariant();
+}
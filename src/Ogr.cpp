@@ -28,28 +28,122 @@
  */
 
 #include "../inc/Ogr.h"
+#include "../inc/Srs.h"
+#include "../inc/Drv.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <ctime>
+
+CPLMutex *Ogr::sourceMutex = NULL;
+
+map<string, Ogr::Source> Ogr::sources;
 
 Ogr::Ogr( void )
 {
-	OGRRegisterAll();
+	sourceData = NULL;
+	targetData = NULL;
+
+	targetUpdate = false;
+
+	squeryLayer = NULL;
+
+	sourceSRS = NULL;
+	targetSRS = NULL;
+
+	transform = NULL;
+	fastTransform = NULL;
+	layerSRS = NULL;
+
+	processTime = 0;
+	transformTime = 0;
+
+	groupSize = 20000;
+	groupCount = 0;
+	transaction = false;
+	aborted = false;
+
+	commitCount = 0;
+	commitTime = 0;
+
+	memset( &stats, 0, sizeof( stats ) );
+
+	checkpointSize = 0;
+	checkpointCount = 0;
+	checkpointFid = OGRNullFID;
+	resume = false;
+	resumeCount = 0;
+	writtenCount = 0;
+	complete = false;
+
+	dimension = 0;
+
+	countStrategy = COUNT_EXACT;
+
+	queryFiltered = false;
+
+	fieldMode = FIELDS_ALL;
+
+	extentGeom = NULL;
+	extentTarget = false;
+
+	threads = 0;
+	memoryBudget = 64 * 1024 * 1024;
+
+	readQueue = NULL;
+	writeQueue = NULL;
+
+	progress = NULL;
+	progressData = NULL;
 }
 
 Ogr::~Ogr( void )
 {
+	if( extentGeom != NULL )
+	{
+		OGR_G_DestroyGeometry( extentGeom );
+	}
 
+	Srs::Release( transform );
+
+	delete fastTransform;
+
+	if( targetSRS != NULL )
+	{
+		OSRRelease( targetSRS );
+	}
 }
 
 bool Ogr::OpenSource( string filename, string &epsg, string &query, string &error )
 {
+	double start = Clock();
+	double cpu = CpuClock();
+
+	// a conversion starts with its source
+
+	memset( &stats, 0, sizeof( stats ) );
+
 	sourceSRS = NULL;
 
+	squeryLayer = NULL;
+
 	sourceName = filename;
 
-	sourceData = OGROpen( sourceName.c_str(), 0, NULL );
+	sourceKey = Key( filename );
+
+	sourceData = Drv::Open( sourceName, 0 );
 
 	if( sourceData != NULL )
 	{
-		sourceLayer = OGR_DS_GetLayer( sourceData, 0 );
+		if( sourceLayerRequest.empty() )
+		{
+			sourceLayer = OGR_DS_GetLayer( sourceData, 0 );
+		}
+		else
+		{
+			sourceLayer = OGR_DS_GetLayerByName( sourceData, sourceLayerRequest.c_str() );
+		}
 
 		if( sourceLayer != NULL )
 		{
@@ -63,9 +157,13 @@ bool Ogr::OpenSource( string filename, string &epsg, string &query, string &erro
 
 			sourceSRS = OGR_L_GetSpatialRef( sourceLayer );
 
+			string code;
+
 			if( sourceSRS != NULL && ! Error( OSRAutoIdentifyEPSG( sourceSRS ), error ) )
 			{
-				epsg = OSRGetAttrValue( sourceSRS, "AUTHORITY", 1 );
+				code = OSRGetAttrValue( sourceSRS, "AUTHORITY", 1 );
+
+				epsg = code;
 			}
 			else
 			{
@@ -73,6 +171,10 @@ bool Ogr::OpenSource( string filename, string &epsg, string &query, string &erro
 			}
 
 			query = "SELECT * FROM " + sourceLayerName;
+
+			Describe( sourceLayer, code );
+
+			Measure( STAGE_OPEN, start, cpu );
 		}
 		else
 		{
@@ -91,11 +193,82 @@ bool Ogr::OpenSource( string filename, string &epsg, string &query, string &erro
 	return true;
 }
 
+bool Ogr::Probe( string filename, string &epsg, string &query, vector<string> &layers, string &error )
+{
+	{
+		CPLMutexHolderD( &sourceMutex );
+
+		map<string, Source>::iterator source = sources.find( Key( filename ) );
+
+		if( source != sources.end() )
+		{
+			string name = sourceLayerRequest.empty() ? source->second.layers[ 0 ] : sourceLayerRequest;
+
+			map<string, Layer>::iterator layer = source->second.described.find( name );
+
+			if( layer != source->second.described.end() )
+			{
+				epsg = layer->second.epsg;
+
+				if( epsg.empty() )
+				{
+					error = "unable to open source spatial reference";
+				}
+
+				query = "SELECT * FROM " + name;
+
+				layers = source->second.layers;
+
+				return true;
+			}
+		}
+	}
+
+	// opening the source describes it
+
+	if( ! OpenSource( filename, epsg, query, error ) )
+	{
+		return false;
+	}
+
+	layers = GetLayers();
+
+	CloseSource();
+
+	return true;
+}
+
+void Ogr::SetSourceLayer( string name )
+{
+	sourceLayerRequest = name;
+}
+
+vector<string> Ogr::GetLayers( void )
+{
+	vector<string> layers;
+
+	for( int i = 0; sourceData != NULL && i < OGR_DS_GetLayerCount( sourceData ); i ++ )
+	{
+		layers.push_back( OGR_L_GetName( OGR_DS_GetLayer( sourceData, i ) ) );
+	}
+
+	return layers;
+}
+
 bool Ogr::CloseSource( void )
 {
 	if( sourceData != NULL )
 	{
+		if( squeryLayer != NULL )
+		{
+			OGR_DS_ReleaseResultSet( sourceData, squeryLayer );
+
+			squeryLayer = NULL;
+		}
+
 		OGR_DS_Destroy( sourceData );
+
+		sourceData = NULL;
 	}
 	else
 	{
@@ -107,7 +280,7 @@ bool Ogr::CloseSource( void )
 
 bool Ogr::OpenDriver( string drivername, string error )
 {
-	formatDriver = OGRGetDriverByName( drivername.c_str() );
+	formatDriver = Drv::Driver( drivername );
 
 	if( formatDriver == NULL )
 	{
@@ -121,19 +294,47 @@ bool Ogr::OpenDriver( string drivername, string error )
 
 bool Ogr::OpenTarget( string filename, int projection, bool update )
 {
+	double start = Clock();
+	double cpu = CpuClock();
+
 	struct stat fileInfo;
 
-	targetSRS = NULL;
-	
+	if( targetSRS != NULL )
+	{
+		OSRRelease( targetSRS );
+
+		targetSRS = NULL;
+	}
+
 	targetName = filename;
 
+	resumeCount = 0;
+
+	complete = false;
+
+	if( checkpointSize > 0 )
+	{
+		checkpointName = targetName + ".checkpoint";
+
+		// an interrupted conversion goes on in its existing target
+
+		if( resume && LoadCheckpoint() )
+		{
+			update = true;
+		}
+		else
+		{
+			remove( checkpointName.c_str() );
+		}
+	}
+
 	if( projection > 0 )
 	{
-		targetSRS = OSRNewSpatialReference( NULL );
+		targetSRS = Srs::Reference( projection );
 
-		if( Error( OSRImportFromEPSG( targetSRS, projection ), error ) )
+		if( targetSRS == NULL )
 		{
-			error.insert( 0, "unable to create spatial reference : " );
+			error = "unable to create spatial reference";
 		}
 	}
 
@@ -163,11 +364,31 @@ bool Ogr::OpenTarget( string filename, int projection, bool update )
 		targetData = OGR_Dr_CreateDataSource( formatDriver, targetName.c_str(), 0 );		
 	}
 
+	if( fieldMode == FIELDS_ATTRIBUTES )
+	{
+		sourceLayerGeom = wkbNone;
+	}
+	else if( dimension == 2 )
+	{
+		sourceLayerGeom = wkbFlatten( sourceLayerGeom );
+	}
+	else if( dimension == 3 && sourceLayerGeom != wkbNone )
+	{
+		sourceLayerGeom = ( OGRwkbGeometryType ) ( sourceLayerGeom | wkb25DBit );
+	}
+
+	targetUpdate = update;
+
 	if( targetData != NULL )
 	{
 		if( update )
 		{
-			targetLayer = OGR_DS_GetLayer( targetData, 0 );
+			targetLayer = OGR_DS_GetLayerByName( targetData, sourceLayerName.c_str() );
+
+			if( targetLayer == NULL )
+			{
+				targetLayer = OGR_DS_GetLayer( targetData, 0 );
+			}
 		}
 		else
 		{
@@ -188,21 +409,62 @@ bool Ogr::OpenTarget( string filename, int projection, bool update )
 		return false;
 	}
 
+	Measure( STAGE_OPEN, start, cpu );
+
 	return true;
 }
 
 bool Ogr::CloseTarget( void )
 {
+	bool success = true;
+
+	if( transaction && ! Commit( false ) )
+	{
+		complete = false;
+
+		success = false;
+	}
+	else if( ! transaction && ! aborted && ! complete && checkpointSize > 0 && checkpointCount > 0 && targetData != NULL )
+	{
+		// features written since the last checkpoint are on disk once synced
+
+		OGR_L_SyncToDisk( targetLayer );
+
+		Checkpoint();
+	}
+
+	Srs::Release( transform );
+
+	transform = NULL;
+
+	delete fastTransform;
+
+	fastTransform = NULL;
+
+	if( targetSRS != NULL )
+	{
+		OSRRelease( targetSRS );
+
+		targetSRS = NULL;
+	}
+
 	if( targetData != NULL )
 	{
 		OGR_DS_Destroy( targetData );
+
+		targetData = NULL;
 	}
 	else
 	{
 		return false;
 	}
 
-	return true;
+	if( checkpointSize > 0 && complete )
+	{
+		remove( checkpointName.c_str() );
+	}
+
+	return success;
 }
 
 bool Ogr::Execute( string query )
@@ -211,7 +473,7 @@ bool Ogr::Execute( string query )
 
 	if( Prepare( featuresCount, query ) )
 	{
-		while( Process() ) ;
+		Run();
 
 		CloseTarget();
 		
@@ -227,56 +489,1600 @@ bool Ogr::Execute( string query )
 
 bool Ogr::Prepare( int &featuresCount, string query )
 {
-	OGRFeatureDefnH featDefn = OGR_L_GetLayerDefn( sourceLayer );
+	double start = Clock();
+	double cpu = CpuClock();
+
+	queryFields.clear();
+	queryFiltered = false;
 
-	for( int i = 0; i < OGR_FD_GetFieldCount( sourceLayerDefn ); i ++ )
+	plan.clear();
+
+	if( query.size() > 0 && ! Plan( query ) )
 	{
-		OGRFieldDefnH field = OGR_FD_GetFieldDefn( featDefn, i );
+		// databases run their own sql, files the ogr sql engine
+
+		squeryLayer = OGR_DS_ExecuteSQL( sourceData, query.c_str(), NULL, NULL );
+
+		if( squeryLayer != NULL )
+		{
+			sourceLayer = squeryLayer;
 
-		if( Error( OGR_L_CreateField( targetLayer, field, 0 ), error ) )
+			plan = Database() ? "native sql" : "ogr sql";
+		}
+		else
 		{
+			error = "unable to execute query";
+
 			return false;
 		}
 	}
 
-	if( query.size() > 0 )
+	OGRFeatureDefnH featDefn = OGR_L_GetLayerDefn( sourceLayer );
+
+	vector<const char *> ignored;
+
+	fieldMap.clear();
+
+	for( int i = 0; i < OGR_FD_GetFieldCount( featDefn ); i ++ )
 	{
-		OGRLayerH squeryLayer = OGR_DS_ExecuteSQL( sourceData, query.c_str(), NULL, "" );
+		OGRFieldDefnH field = OGR_FD_GetFieldDefn( featDefn, i );
 
-		if( squeryLayer != NULL )
+		const char *name = OGR_Fld_GetNameRef( field );
+
+		if( ! Selected( name ) )
 		{
-			sourceLayer = squeryLayer;
+			ignored.push_back( name );
+
+			fieldMap.push_back( -1 );
+
+			continue;
+		}
+
+		// appended and resumed targets already have their fields
+
+		int index;
+
+		if( targetUpdate )
+		{
+			index = OGR_FD_GetFieldIndex( OGR_L_GetLayerDefn( targetLayer ), name );
+
+			if( index < 0 )
+			{
+				error = string( "target has no field " ) + name;
+
+				return false;
+			}
+		}
+		else
+		{
+			if( Error( OGR_L_CreateField( targetLayer, field, 0 ), error ) )
+			{
+				return false;
+			}
+
+			// drivers may truncate or fold the name, the new field is the last one
+
+			index = OGR_FD_GetFieldCount( OGR_L_GetLayerDefn( targetLayer ) ) - 1;
 		}
+
+		fieldMap.push_back( index );
 	}
 
-	OGR_L_ResetReading( sourceLayer );
+	if( fieldMode == FIELDS_ATTRIBUTES )
+	{
+		ignored.push_back( "OGR_GEOMETRY" );
+	}
 
-	featuresCount = OGR_L_GetFeatureCount( sourceLayer, 1 );
+	// skipped columns are never parsed by drivers supporting it
 
-	return true;
-}
+	if( ! ignored.empty() )
+	{
+		ignored.push_back( NULL );
 
-bool Ogr::Process( void )
-{
-	OGRFeatureH feature;
+		OGR_L_SetIgnoredFields( sourceLayer, &ignored[ 0 ] );
+	}
+
+	// features are written as read only when every field keeps its position
+
+	bool identity = ( fieldMode == FIELDS_ALL && queryFields.empty() );
+
+	for( size_t i = 0; identity && i < fieldMap.size(); i ++ )
+	{
+		identity = ( fieldMap[ i ] == ( int ) i );
+	}
+
+	if( identity )
+	{
+		fieldMap.clear();
+	}
+
+	Srs::Release( transform );
+
+	transform = NULL;
+
+	delete fastTransform;
 
-	if( ( ( feature = OGR_L_GetNextFeature( sourceLayer ) ) != NULL ) )
+	fastTransform = NULL;
+
+	layerSRS = NULL;
+
+	if( targetSRS != NULL )
 	{
-		if( targetSRS )
+		layerSRS = OGR_L_GetSpatialRef( sourceLayer );
+
+		if( layerSRS == NULL )
 		{
-			Error( OGR_G_TransformTo( OGR_F_GetGeometryRef( feature ), targetSRS ), error );
+			layerSRS = sourceSRS;
 		}
 
-		Error( OGR_L_CreateFeature( targetLayer, feature ), error );
+		if( layerSRS != NULL && ! OSRIsSame( layerSRS, targetSRS ) )
+		{
+			transform = Srs::Acquire( layerSRS, targetSRS );
+
+			if( transform == NULL )
+			{
+				error = "unable to create coordinate transformation";
 
-		OGR_F_Destroy( feature );
+				return false;
+			}
+
+			fastTransform = Prj::Create( layerSRS, targetSRS );
+		}
 	}
-	else
+
+	if( ! Filter() )
 	{
 		return false;
 	}
 
-	return true;
+	processTime = 0;
+	transformTime = 0;
+
+	groupCount = 0;
+	transaction = false;
+	aborted = false;
+
+	commitCount = 0;
+	commitTime = 0;
+
+	checkpointCount = 0;
+	writtenCount = resumeCount;
+	complete = false;
+
+	if( groupSize > 0 && OGR_L_TestCapability( targetLayer, OLCTransactions ) )
+	{
+		transaction = ! Error( OGR_L_StartTransaction( targetLayer ), error );
+	}
+
+	OGR_L_ResetReading( sourceLayer );
+
+	// unfiltered layers reuse the count of an earlier probe or conversion
+
+	bool plain = squeryLayer == NULL && ! queryFiltered && extentGeom == NULL;
+
+	int known = ( plain && countStrategy != COUNT_NONE ) ? Known() : -1;
+
+	if( known >= 0 )
+	{
+		featuresCount = known;
+	}
+	else
+	{
+		switch( countStrategy )
+		{
+			case COUNT_EXACT :
+			{
+				featuresCount = OGR_L_GetFeatureCount( sourceLayer, 1 );
+
+				if( plain )
+				{
+					Remember( featuresCount );
+				}
+			}
+			break;
+
+			case COUNT_FAST :
+			{
+				featuresCount = OGR_L_GetFeatureCount( sourceLayer, 0 );
+
+				if( plain )
+				{
+					Remember( featuresCount );
+				}
+			}
+			break;
+
+			case COUNT_ESTIMATE :
+			{
+				featuresCount = OGR_L_GetFeatureCount( sourceLayer, 0 );
+
+				if( featuresCount < 0 )
+				{
+					featuresCount = Estimate();
+				}
+				else if( plain )
+				{
+					Remember( featuresCount );
+				}
+			}
+			break;
+
+			default :
+			{
+				featuresCount = -1;
+			}
+			break;
+		}
+	}
+
+	bool success = Skip();
+
+	Measure( STAGE_PREPARE, start, cpu );
+
+	return success;
+}
+
+string Ogr::Key( string filename )
+{
+	struct stat fileInfo;
+
+	if( stat( filename.c_str(), &fileInfo ) != 0 )
+	{
+		return filename;
+	}
+
+	// a rewritten file gets a new key, its old entry is never hit again
+
+	char buffer[ 64 ];
+
+	snprintf( buffer, sizeof( buffer ), "|%ld|%.0f", ( long ) fileInfo.st_mtime, ( double ) fileInfo.st_size );
+
+	return filename + buffer;
+}
+
+void Ogr::Describe( OGRLayerH layer, string epsg )
+{
+	bool cached;
+
+	{
+		CPLMutexHolderD( &sourceMutex );
+
+		cached = sources.find( sourceKey ) != sources.end();
+	}
+
+	// layers are listed outside the lock, remote sources may be slow
+
+	vector<string> layers;
+
+	if( ! cached )
+	{
+		layers = GetLayers();
+	}
+
+	Layer entry;
+
+	OGRFeatureDefnH layerDefn = OGR_L_GetLayerDefn( layer );
+
+	entry.geometry = OGR_FD_GetGeomType( layerDefn );
+
+	entry.epsg = epsg;
+
+	for( int i = 0; i < OGR_FD_GetFieldCount( layerDefn ); i ++ )
+	{
+		OGRFieldDefnH field = OGR_FD_GetFieldDefn( layerDefn, i );
+
+		entry.fieldNames.push_back( OGR_Fld_GetNameRef( field ) );
+		entry.fieldTypes.push_back( OGR_Fld_GetType( field ) );
+	}
+
+	// database tables change without touching any file, their counts aren't kept
+
+	entry.count = Database() ? -1 : OGR_L_GetFeatureCount( layer, 0 );
+
+	CPLMutexHolderD( &sourceMutex );
+
+	if( sources.find( sourceKey ) == sources.end() )
+	{
+		if( layers.empty() )
+		{
+			return;
+		}
+
+		if( sources.size() >= 64 )
+		{
+			sources.clear();
+		}
+
+		sources[ sourceKey ].layers = layers;
+	}
+
+	Source &source = sources[ sourceKey ];
+
+	string name = OGR_L_GetName( layer );
+
+	if( source.described.find( name ) == source.described.end() )
+	{
+		source.described[ name ] = entry;
+	}
+}
+
+int Ogr::Known( void )
+{
+	CPLMutexHolderD( &sourceMutex );
+
+	map<string, Source>::iterator source = sources.find( sourceKey );
+
+	if( source == sources.end() )
+	{
+		return -1;
+	}
+
+	map<string, Layer>::iterator layer = source->second.described.find( OGR_L_GetName( sourceLayer ) );
+
+	return layer != source->second.described.end() ? layer->second.count : -1;
+}
+
+void Ogr::Remember( int count )
+{
+	if( count < 0 || Database() )
+	{
+		return;
+	}
+
+	CPLMutexHolderD( &sourceMutex );
+
+	map<string, Source>::iterator source = sources.find( sourceKey );
+
+	if( source == sources.end() )
+	{
+		return;
+	}
+
+	map<string, Layer>::iterator layer = source->second.described.find( OGR_L_GetName( sourceLayer ) );
+
+	if( layer != source->second.described.end() )
+	{
+		layer->second.count = count;
+	}
+}
+
+int Ogr::Estimate( void )
+{
+	struct stat fileInfo;
+
+	if( stat( sourceName.c_str(), &fileInfo ) != 0 || fileInfo.st_size <= 0 )
+	{
+		return -1;
+	}
+
+	// sizes are in memory bytes, not source bytes : good enough for progress
+
+	OGRFeatureH feature;
+
+	double sampleBytes = 0;
+
+	int sampleCount = 0;
+
+	while( sampleCount < 1000 && ( feature = OGR_L_GetNextFeature( sourceLayer ) ) != NULL )
+	{
+		sampleBytes += Que::Size( feature );
+
+		sampleCount ++;
+
+		OGR_F_Destroy( feature );
+	}
+
+	OGR_L_ResetReading( sourceLayer );
+
+	if( sampleCount < 1000 )
+	{
+		return sampleCount;
+	}
+
+	return ( int ) ( sampleCount * ( fileInfo.st_size / sampleBytes ) );
+}
+
+bool Ogr::Process( void )
+{
+	vector<OGRFeatureH> features;
+
+	OGRFeatureH feature;
+
+	double start = Clock();
+
+	features.reserve( batchSize );
+
+	while( ( int ) features.size() < batchSize && ( feature = OGR_L_GetNextFeature( sourceLayer ) ) != NULL )
+	{
+		features.push_back( feature );
+
+		stats.read ++;
+		stats.bytes += Que::Size( feature );
+	}
+
+	double read = Clock();
+
+	stats.wall[ STAGE_READ ] += read - start;
+
+	if( features.empty() )
+	{
+		return false;
+	}
+
+	long failed = Transform( features, transform, batch, transformTime );
+
+	if( failed > 0 )
+	{
+		Error( OGRERR_FAILURE, error );
+
+		stats.failed += failed;
+	}
+
+	stats.wall[ STAGE_TRANSFORM ] += Clock() - read;
+
+	for( size_t i = 0; i < features.size(); i ++ )
+	{
+		if( aborted )
+		{
+			OGR_F_Destroy( features[ i ] );
+		}
+		else if( ! Write( features[ i ] ) && ! batch.failed[ i ] )
+		{
+			stats.failed ++;
+		}
+	}
+
+	processTime += Clock() - start;
+
+	return ! aborted;
+}
+
+bool Ogr::Run( void )
+{
+	int workers = threads;
+
+	if( workers == 0 )
+	{
+		workers = CPLGetNumCPUs() - 2;
+	}
+
+	// dimension coercion alone is too cheap to be worth the pipeline
+
+	if( workers < 1 || threads == 1 || transform == NULL )
+	{
+		long read = stats.read;
+
+		double wall[ STAGE_COUNT ];
+
+		memcpy( wall, stats.wall, sizeof( wall ) );
+
+		double cpu = CpuClock();
+
+		complete = true;
+
+		while( Process() )
+		{
+			long count = resumeCount + stats.read - read;
+
+			if( progress != NULL && ! progress( count, progressData ) )
+			{
+				complete = false;
+
+				break;
+			}
+		}
+
+		if( aborted )
+		{
+			complete = false;
+		}
+
+		// one thread ran every stage, its cpu time is shared by wall time
+
+		cpu = CpuClock() - cpu;
+
+		double total = 0;
+
+		for( int i = STAGE_READ; i <= STAGE_WRITE; i ++ )
+		{
+			wall[ i ] = stats.wall[ i ] - wall[ i ];
+
+			total += wall[ i ];
+		}
+
+		for( int i = STAGE_READ; i <= STAGE_WRITE && total > 0; i ++ )
+		{
+			stats.cpu[ i ] += cpu * wall[ i ] / total;
+		}
+
+		return complete;
+	}
+
+	complete = Pipeline( workers );
+
+	return complete;
+}
+
+void Ogr::Collect( OGRGeometryH geom, int owner, Batch &batch )
+{
+	int count = OGR_G_GetGeometryCount( geom );
+
+	if( count > 0 )
+	{
+		for( int i = 0; i < count; i ++ )
+		{
+			Collect( OGR_G_GetGeometryRef( geom, i ), owner, batch );
+		}
+	}
+	else if( ( count = OGR_G_GetPointCount( geom ) ) > 0 )
+	{
+		batch.parts.push_back( geom );
+		batch.owners.push_back( owner );
+		batch.offsets.push_back( batch.offsets.back() + count );
+	}
+}
+
+long Ogr::Transform( vector<OGRFeatureH> &features, OGRCoordinateTransformationH t, Batch &batch, double &time )
+{
+	int count = features.size();
+
+	long failed = 0;
+
+	batch.failed.assign( count, false );
+
+	// dimension coercion alone goes through the same arrays, without projection
+
+	if( t != NULL || dimension != 0 )
+	{
+		batch.parts.clear();
+		batch.owners.clear();
+		batch.offsets.assign( 1, 0 );
+
+		for( int i = 0; i < count; i ++ )
+		{
+			OGRGeometryH geom = OGR_F_GetGeometryRef( features[ i ] );
+
+			if( geom != NULL )
+			{
+				Collect( geom, i, batch );
+			}
+		}
+
+		int points = batch.offsets.back();
+
+		if( points > 0 )
+		{
+			int parts = batch.parts.size();
+
+			batch.x.resize( points );
+			batch.y.resize( points );
+			batch.z.resize( points );
+			batch.success.resize( points );
+
+			// flat arrays for the whole batch, z reads as 0 for 2d parts
+
+			for( int p = 0; p < parts; p ++ )
+			{
+				int o = batch.offsets[ p ];
+
+				if( t == NULL && OGR_G_GetCoordinateDimension( batch.parts[ p ] ) == dimension )
+				{
+					continue;
+				}
+
+				OGR_G_GetPoints( batch.parts[ p ], &batch.x[ o ], sizeof( double ), &batch.y[ o ], sizeof( double ), &batch.z[ o ], sizeof( double ) );
+			}
+
+			// a single projection call, z is left out when it is dropped
+
+			double start = Clock();
+
+			if( t == NULL )
+			{
+				batch.success.assign( points, 1 );
+			}
+			else if( fastTransform != NULL )
+			{
+				fastTransform->Transform( points, &batch.x[ 0 ], &batch.y[ 0 ], &batch.success[ 0 ] );
+			}
+			else
+			{
+				OCTTransformEx( t, points, &batch.x[ 0 ], &batch.y[ 0 ], dimension == 2 ? NULL : &batch.z[ 0 ], &batch.success[ 0 ] );
+			}
+
+			time += Clock() - start;
+
+			for( int p = 0; p < parts && t != NULL; p ++ )
+			{
+				int ok = 1;
+
+				for( int j = batch.offsets[ p ]; j < batch.offsets[ p + 1 ]; j ++ )
+				{
+					ok &= batch.success[ j ] != 0;
+				}
+
+				if( ! ok )
+				{
+					batch.failed[ batch.owners[ p ] ] = true;
+				}
+			}
+
+			// features with a failed point keep their source coordinates
+
+			for( int p = 0; p < parts; p ++ )
+			{
+				if( batch.failed[ batch.owners[ p ] ] )
+				{
+					continue;
+				}
+
+				OGRGeometryH part = batch.parts[ p ];
+
+				int o = batch.offsets[ p ];
+
+				// parts already in the target dimension are left alone
+
+				if( t == NULL && OGR_G_GetCoordinateDimension( part ) == dimension )
+				{
+					continue;
+				}
+
+				bool z = dimension == 3 || ( dimension == 0 && OGR_G_GetCoordinateDimension( part ) == 3 );
+
+				// a null z with a zero stride is what makes curves 2d
+
+				OGR_G_SetPoints( part, batch.offsets[ p + 1 ] - o, &batch.x[ o ], sizeof( double ), &batch.y[ o ], sizeof( double ), z ? &batch.z[ o ] : NULL, z ? sizeof( double ) : 0 );
+
+				// points keep their z whatever SetPoints gets
+
+				if( ! z && OGR_G_GetCoordinateDimension( part ) == 3 )
+				{
+					OGR_G_FlattenTo2D( part );
+				}
+			}
+		}
+	}
+
+	// parts already have the target dimension, containers only carry their own flag
+
+	for( int i = 0; i < count; i ++ )
+	{
+		OGRGeometryH geom = OGR_F_GetGeometryRef( features[ i ] );
+
+		if( batch.failed[ i ] )
+		{
+			failed ++;
+		}
+
+		if( geom == NULL || dimension == 0 || ( OGR_G_GetGeometryCount( geom ) == 0 && ! batch.failed[ i ] ) || OGR_G_GetCoordinateDimension( geom ) == dimension )
+		{
+			continue;
+		}
+
+		OGR_G_SetCoordinateDimension( geom, dimension );
+	}
+
+	return failed;
+}
+
+bool Ogr::Write( OGRFeatureH feature )
+{
+	double start = Clock();
+
+	long fid = OGR_F_GetFID( feature );
+
+	if( ! fieldMap.empty() )
+	{
+		OGRFeatureH selected = OGR_F_Create( OGR_L_GetLayerDefn( targetLayer ) );
+
+		OGRGeometryH geom = OGR_F_StealGeometry( feature );
+
+		OGR_F_SetFromWithMap( selected, feature, 1, &fieldMap[ 0 ] );
+
+		if( geom != NULL )
+		{
+			OGR_F_SetGeometryDirectly( selected, geom );
+		}
+
+		OGR_F_Destroy( feature );
+
+		feature = selected;
+	}
+
+	bool success = ! Error( OGR_L_CreateFeature( targetLayer, feature ), error );
+
+	OGR_F_Destroy( feature );
+
+	checkpointFid = fid;
+
+	writtenCount ++;
+	checkpointCount ++;
+
+	if( transaction && ++ groupCount >= groupSize && ! Commit( true ) )
+	{
+		// rows would silently go on without a transaction
+
+		aborted = true;
+	}
+	else if( ! transaction && checkpointSize > 0 && checkpointCount >= checkpointSize )
+	{
+		// without transactions the checkpoint only holds once features are on disk
+
+		OGR_L_SyncToDisk( targetLayer );
+
+		Checkpoint();
+	}
+
+	// failed features are counted by the caller, they may already have failed to transform
+
+	if( success )
+	{
+		stats.written ++;
+	}
+
+	stats.wall[ STAGE_WRITE ] += Clock() - start;
+
+	return success;
+}
+
+bool Ogr::Pipeline( int workers )
+{
+	double start = Clock();
+
+	bool success = true;
+
+	vector<Worker> pool( workers );
+
+	// coordinate transformations are not thread safe, each worker owns one
+
+	for( int i = 0; i < workers; i ++ )
+	{
+		pool[ i ].ogr = this;
+		pool[ i ].transform = NULL;
+		pool[ i ].transformTime = 0;
+		pool[ i ].wall = 0;
+		pool[ i ].cpu = 0;
+		pool[ i ].failed = 0;
+		pool[ i ].failures.clear();
+
+		if( transform != NULL )
+		{
+			pool[ i ].transform = ( i == 0 ) ? transform : Srs::Acquire( layerSRS, targetSRS );
+		}
+
+		// a worker without transformation would write source coordinates, fewer workers run instead
+
+		if( transform != NULL && pool[ i ].transform == NULL )
+		{
+			workers = i;
+
+			pool.resize( workers );
+		}
+	}
+
+	// the queues and the features waiting to be written in order share the budget
+
+	readQueue = new Que( 1024, memoryBudget / 3, 1 );
+	writeQueue = new Que( 1024, memoryBudget / 3, workers );
+
+	size_t pendingBudget = memoryBudget / 3;
+
+	// features read but not written yet, whichever stage holds them
+
+	long window = 2 * 1024 + workers * batchSize;
+
+	readQueue->Limit( window - 1 );
+
+	CPLJoinableThread *reader = CPLCreateJoinableThread( ReadThread, this );
+
+	for( int i = 0; i < workers; i ++ )
+	{
+		pool[ i ].thread = CPLCreateJoinableThread( TransformThread, &pool[ i ] );
+	}
+
+	// workers finish out of order, features are written back in read order
+
+	map<long, pair<OGRFeatureH, size_t> > pending;
+
+	size_t pendingBytes = 0;
+
+	// sequence numbers of features the target refused
+	vector<long> refused;
+
+	long next = 0;
+	long index;
+
+	OGRFeatureH feature;
+
+	size_t size;
+
+	double cpu = CpuClock();
+
+	while( success && writeQueue->Pop( index, feature, size ) )
+	{
+		pending[ index ] = pair<OGRFeatureH, size_t>( feature, size );
+
+		pendingBytes += size;
+
+		while( success && ! pending.empty() && pending.begin()->first == next )
+		{
+			if( ! Write( pending.begin()->second.first ) )
+			{
+				refused.push_back( next );
+			}
+
+			pendingBytes -= pending.begin()->second.second;
+
+			pending.erase( pending.begin() );
+
+			next ++;
+
+			if( aborted )
+			{
+				success = false;
+			}
+
+			if( progress != NULL && ! progress( resumeCount + next, progressData ) )
+			{
+				success = false;
+			}
+		}
+
+		// a stalled batch holds the reader back until it is written
+
+		readQueue->Limit( pendingBytes > pendingBudget ? next : next + window - 1 );
+	}
+
+	if( ! success )
+	{
+		readQueue->Abort();
+		writeQueue->Abort();
+	}
+
+	stats.cpu[ STAGE_WRITE ] += CpuClock() - cpu;
+
+	CPLJoinThread( reader );
+
+	set<long> mistransformed;
+
+	for( int i = 0; i < workers; i ++ )
+	{
+		CPLJoinThread( pool[ i ].thread );
+
+		transformTime += pool[ i ].transformTime;
+
+		stats.wall[ STAGE_TRANSFORM ] += pool[ i ].wall;
+		stats.cpu[ STAGE_TRANSFORM ] += pool[ i ].cpu;
+
+		stats.failed += pool[ i ].failed;
+
+		mistransformed.insert( pool[ i ].failures.begin(), pool[ i ].failures.end() );
+
+		if( i > 0 )
+		{
+			Srs::Release( pool[ i ].transform );
+		}
+	}
+
+	// a feature failing both to transform and to write is counted once
+
+	for( size_t i = 0; i < refused.size(); i ++ )
+	{
+		if( mistransformed.find( refused[ i ] ) == mistransformed.end() )
+		{
+			stats.failed ++;
+		}
+	}
+
+	for( map<long, pair<OGRFeatureH, size_t> >::iterator it = pending.begin(); it != pending.end(); it ++ )
+	{
+		OGR_F_Destroy( it->second.first );
+	}
+
+	delete readQueue;
+	delete writeQueue;
+
+	readQueue = NULL;
+	writeQueue = NULL;
+
+	processTime += Clock() - start;
+
+	return success;
+}
+
+void Ogr::ReadThread( void *data )
+{
+	Ogr *ogr = ( Ogr * ) data;
+
+	OGRFeatureH feature;
+
+	long index = 0;
+
+	double cpu = CpuClock();
+	double start = Clock();
+
+	// the writer only reads these counters once this thread is joined
+
+	while( ( feature = OGR_L_GetNextFeature( ogr->sourceLayer ) ) != NULL )
+	{
+		size_t size = Que::Size( feature );
+
+		ogr->stats.wall[ STAGE_READ ] += Clock() - start;
+
+		ogr->stats.read ++;
+		ogr->stats.bytes += size;
+
+		if( ! ogr->readQueue->Push( index ++, feature, size ) )
+		{
+			OGR_F_Destroy( feature );
+
+			break;
+		}
+
+		start = Clock();
+	}
+
+	ogr->stats.cpu[ STAGE_READ ] += CpuClock() - cpu;
+
+	ogr->readQueue->Close();
+}
+
+void Ogr::TransformThread( void *data )
+{
+	Worker *worker = ( Worker * ) data;
+
+	Ogr *ogr = worker->ogr;
+
+	vector<OGRFeatureH> features;
+	vector<long> indexes;
+
+	double cpu = CpuClock();
+
+	bool open = true;
+
+	while( open && ogr->readQueue->Pop( indexes, features, batchSize ) )
+	{
+		double start = Clock();
+
+		worker->failed += ogr->Transform( features, worker->transform, worker->batch, worker->transformTime );
+
+		for( size_t i = 0; i < features.size(); i ++ )
+		{
+			if( worker->batch.failed[ i ] )
+			{
+				worker->failures.push_back( indexes[ i ] );
+			}
+		}
+
+		worker->wall += Clock() - start;
+
+		for( size_t i = 0; i < features.size(); i ++ )
+		{
+			if( open && ! ogr->writeQueue->Push( indexes[ i ], features[ i ], Que::Size( features[ i ] ) ) )
+			{
+				open = false;
+			}
+
+			if( ! open )
+			{
+				OGR_F_Destroy( features[ i ] );
+			}
+		}
+	}
+
+	worker->cpu = CpuClock() - cpu;
+
+	ogr->writeQueue->Close();
+}
+
+void Ogr::SetDimension( int dim )
+{
+	dimension = dim;
+}
+
+void Ogr::SetCountStrategy( int strategy )
+{
+	countStrategy = strategy;
+}
+
+void Ogr::SetFields( int mode, vector<string> fields )
+{
+	fieldMode = mode;
+
+	selectedFields = fields;
+}
+
+bool Ogr::Selected( string name )
+{
+	if( fieldMode == FIELDS_GEOMETRY )
+	{
+		return false;
+	}
+
+	if( fieldMode == FIELDS_SELECTED && ! Listed( selectedFields, name ) )
+	{
+		return false;
+	}
+
+	if( ! queryFields.empty() && ! Listed( queryFields, name ) )
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool Ogr::Listed( vector<string> &list, string name )
+{
+	for( size_t i = 0; i < list.size(); i ++ )
+	{
+		if( EQUAL( list[ i ].c_str(), name.c_str() ) )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool Ogr::Plan( string query )
+{
+	string upper = query;
+
+	for( size_t i = 0; i < upper.size(); i ++ )
+	{
+		upper[ i ] = toupper( upper[ i ] );
+	}
+
+	size_t end = upper.find_last_not_of( " \t\r\n;" );
+
+	size_t from = upper.find( " FROM " );
+
+	if( end == string::npos || upper.compare( 0, 7, "SELECT " ) != 0 || from == string::npos )
+	{
+		return false;
+	}
+
+	// anything but plain columns, one layer and a where clause goes to sql
+
+	const char *keywords[] = { "SELECT ", " JOIN ", " UNION ", " GROUP ", " ORDER ", " LIMIT ", " OFFSET ", " HAVING ", "DISTINCT", "(", NULL };
+
+	for( int i = 0; keywords[ i ] != NULL; i ++ )
+	{
+		if( upper.find( keywords[ i ], i == 0 ? 1 : 0 ) != string::npos )
+		{
+			return false;
+		}
+	}
+
+	string columns = query.substr( 7, from - 7 );
+
+	size_t start = query.find_first_not_of( " ", from + 6 );
+
+	size_t stop = query.find( ' ', start );
+
+	string layerName = query.substr( start, ( stop == string::npos || stop > end ) ? end + 1 - start : stop - start );
+
+	string expression;
+
+	if( stop != string::npos && stop < end )
+	{
+		size_t where = upper.find_first_not_of( " ", stop );
+
+		if( upper.compare( where, 6, "WHERE " ) != 0 )
+		{
+			return false;
+		}
+
+		expression = query.substr( where + 6, end + 1 - where - 6 );
+	}
+
+	if( layerName.size() > 1 && layerName[ 0 ] == '"' && layerName[ layerName.size() - 1 ] == '"' )
+	{
+		layerName = layerName.substr( 1, layerName.size() - 2 );
+	}
+
+	OGRLayerH layer = OGR_DS_GetLayerByName( sourceData, layerName.c_str() );
+
+	if( layer == NULL )
+	{
+		return false;
+	}
+
+	vector<string> fields;
+
+	if( columns.find_first_not_of( " " ) == string::npos )
+	{
+		return false;
+	}
+
+	if( columns.substr( columns.find_first_not_of( " " ), 1 ) != "*" )
+	{
+		size_t begin = 0;
+
+		while( begin <= columns.size() )
+		{
+			size_t comma = columns.find( ',', begin );
+
+			if( comma == string::npos )
+			{
+				comma = columns.size();
+			}
+
+			string column = columns.substr( begin, comma - begin );
+
+			size_t first = column.find_first_not_of( " \"" );
+			size_t last = column.find_last_not_of( " \"" );
+
+			if( first == string::npos || column.substr( first, last + 1 - first ).find_first_of( " *" ) != string::npos )
+			{
+				return false;
+			}
+
+			fields.push_back( column.substr( first, last + 1 - first ) );
+
+			begin = comma + 1;
+		}
+	}
+
+	if( expression.size() > 0 && Error( OGR_L_SetAttributeFilter( layer, expression.c_str() ), error ) )
+	{
+		OGR_L_SetAttributeFilter( layer, NULL );
+
+		// the sql engine gets the query, the rejected filter isn't an error
+
+		error.clear();
+
+		return false;
+	}
+
+	sourceLayer = layer;
+
+	queryFields = fields;
+
+	queryFiltered = expression.size() > 0;
+
+	plan = "layer " + layerName;
+
+	plan += expression.size() > 0 ? ", attribute filter : " + expression : ", no filter";
+
+	plan += fields.size() > 0 ? ", " + columns.substr( columns.find_first_not_of( " " ) ) + " only" : "";
+
+	return true;
+}
+
+bool Ogr::Database( void )
+{
+	const char *databases[] = { "PostgreSQL", "MySQL", "OCI", "ODBC", "SQLite", "MSSQLSpatial", "PGeo", NULL };
+
+	OGRSFDriverH driver = OGR_DS_GetDriver( sourceData );
+
+	for( int i = 0; driver != NULL && databases[ i ] != NULL; i ++ )
+	{
+		if( EQUAL( OGR_Dr_GetName( driver ), databases[ i ] ) )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool Ogr::SetExtent( string extent, bool target )
+{
+	if( extentGeom != NULL )
+	{
+		OGR_G_DestroyGeometry( extentGeom );
+
+		extentGeom = NULL;
+	}
+
+	extentTarget = target;
+
+	if( extent.find_first_not_of( " \t" ) == string::npos )
+	{
+		return true;
+	}
+
+	if( extent.find( '(' ) != string::npos )
+	{
+		char *wkt = ( char * ) extent.c_str();
+
+		if( Error( OGR_G_CreateFromWkt( &wkt, NULL, &extentGeom ), error ) )
+		{
+			error.insert( 0, "invalid extent : " );
+
+			return false;
+		}
+
+		return true;
+	}
+
+	double minx, miny, maxx, maxy;
+
+	for( size_t i = 0; i < extent.size(); i ++ )
+	{
+		if( extent[ i ] == ',' )
+		{
+			extent[ i ] = ' ';
+		}
+	}
+
+	if( sscanf( extent.c_str(), "%lf %lf %lf %lf", &minx, &miny, &maxx, &maxy ) != 4 || minx >= maxx || miny >= maxy )
+	{
+		error = "invalid extent : minx miny maxx maxy expected";
+
+		return false;
+	}
+
+	OGRGeometryH ring = OGR_G_CreateGeometry( wkbLinearRing );
+
+	OGR_G_AddPoint_2D( ring, minx, miny );
+	OGR_G_AddPoint_2D( ring, maxx, miny );
+	OGR_G_AddPoint_2D( ring, maxx, maxy );
+	OGR_G_AddPoint_2D( ring, minx, maxy );
+	OGR_G_AddPoint_2D( ring, minx, miny );
+
+	extentGeom = OGR_G_CreateGeometry( wkbPolygon );
+
+	OGR_G_AddGeometryDirectly( extentGeom, ring );
+
+	return true;
+}
+
+bool Ogr::Filter( void )
+{
+	if( extentGeom == NULL )
+	{
+		return true;
+	}
+
+	OGRGeometryH filter = OGR_G_Clone( extentGeom );
+
+	OGRSpatialReferenceH readSRS = OGR_L_GetSpatialRef( sourceLayer );
+
+	if( readSRS == NULL )
+	{
+		readSRS = sourceSRS;
+	}
+
+	if( extentTarget && targetSRS != NULL && readSRS != NULL && ! OSRIsSame( readSRS, targetSRS ) )
+	{
+		OGRCoordinateTransformationH inverse = Srs::Acquire( targetSRS, readSRS );
+
+		if( inverse == NULL )
+		{
+			OGR_G_DestroyGeometry( filter );
+
+			error = "unable to transform extent to source projection";
+
+			return false;
+		}
+
+		// densify edges, they are not straight in the source projection
+
+		OGREnvelope envelope;
+
+		OGR_G_GetEnvelope( filter, &envelope );
+
+		OGR_G_Segmentize( filter, ( envelope.MaxX - envelope.MinX ) / 64 );
+
+		bool failed = Error( OGR_G_Transform( filter, inverse ), error );
+
+		Srs::Release( inverse );
+
+		// the extent left in target coordinates would select the wrong area
+
+		if( failed )
+		{
+			OGR_G_DestroyGeometry( filter );
+
+			error.insert( 0, "unable to transform extent : " );
+
+			return false;
+		}
+	}
+
+	// drivers with a spatial index only read matching features
+
+	OGR_L_SetSpatialFilter( sourceLayer, filter );
+
+	OGR_G_DestroyGeometry( filter );
+
+	sourceGeom = OGR_L_GetSpatialFilter( sourceLayer );
+
+	return true;
+}
+
+void Ogr::SetThreads( int count )
+{
+	threads = count;
+}
+
+void Ogr::SetMemoryBudget( size_t bytes )
+{
+	memoryBudget = bytes;
+}
+
+void Ogr::SetProgress( OgrProgress callback, void *data )
+{
+	progress = callback;
+	progressData = data;
+}
+
+string Ogr::GetError( void )
+{
+	return error;
+}
+
+string Ogr::GetPlan( void )
+{
+	return plan;
+}
+
+double Ogr::GetProcessTime( void )
+{
+	return processTime;
+}
+
+double Ogr::GetTransformTime( void )
+{
+	return transformTime;
+}
+
+bool Ogr::Commit( bool restart )
+{
+	double start = Clock();
+
+	transaction = false;
+
+	if( Error( OGR_L_CommitTransaction( targetLayer ), error ) )
+	{
+		error.insert( 0, "unable to commit transaction : " );
+
+		return false;
+	}
+
+	commitTime += Clock() - start;
+
+	commitCount ++;
+
+	groupCount = 0;
+
+	// the last commit of a stopped run must be covered by the checkpoint too
+
+	if( checkpointSize > 0 && ( checkpointCount >= checkpointSize || ( ! restart && checkpointCount > 0 ) ) )
+	{
+		Checkpoint();
+	}
+
+	if( restart )
+	{
+		transaction = ! Error( OGR_L_StartTransaction( targetLayer ), error );
+	}
+
+	return true;
+}
+
+void Ogr::SetGroupSize( int size )
+{
+	groupSize = size;
+}
+
+void Ogr::SetCheckpoint( int size, bool restart )
+{
+	checkpointSize = size;
+
+	resume = restart;
+}
+
+long Ogr::GetResumed( void )
+{
+	return resumeCount;
+}
+
+bool Ogr::Checkpoint( void )
+{
+	checkpointCount = 0;
+
+	string temporary = checkpointName + ".tmp";
+
+	FILE *file = fopen( temporary.c_str(), "w" );
+
+	if( file == NULL )
+	{
+		error = "unable to write checkpoint";
+
+		return false;
+	}
+
+	fprintf( file, "layer=%s\nfid=%ld\ncount=%ld\n", sourceLayerName.c_str(), checkpointFid, writtenCount );
+
+	if( fclose( file ) != 0 )
+	{
+		error = "unable to write checkpoint";
+
+		return false;
+	}
+
+	// the previous checkpoint stays valid until the new one replaces it
+
+	if( rename( temporary.c_str(), checkpointName.c_str() ) != 0 )
+	{
+		remove( checkpointName.c_str() );
+
+		if( rename( temporary.c_str(), checkpointName.c_str() ) != 0 )
+		{
+			error = "unable to write checkpoint";
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool Ogr::LoadCheckpoint( void )
+{
+	FILE *file = fopen( checkpointName.c_str(), "r" );
+
+	if( file == NULL )
+	{
+		return false;
+	}
+
+	char layer[ 1024 ] = "";
+
+	long fid;
+	long count;
+
+	int fields = fscanf( file, "layer=%1023[^\n]\nfid=%ld\ncount=%ld", layer, &fid, &count );
+
+	fclose( file );
+
+	if( fields != 3 || sourceLayerName != layer || count < 0 )
+	{
+		return false;
+	}
+
+	checkpointFid = fid;
+
+	resumeCount = count;
+
+	return true;
+}
+
+bool Ogr::Skip( void )
+{
+	if( resumeCount <= 0 )
+	{
+		return true;
+	}
+
+	// the last checkpointed feature must be found at its position again
+
+	if( Error( OGR_L_SetNextByIndex( sourceLayer, resumeCount - 1 ), error ) )
+	{
+		error.insert( 0, "unable to resume : " );
+
+		return false;
+	}
+
+	OGRFeatureH feature = OGR_L_GetNextFeature( sourceLayer );
+
+	long fid = OGRNullFID;
+
+	if( feature != NULL )
+	{
+		fid = OGR_F_GetFID( feature );
+
+		OGR_F_Destroy( feature );
+	}
+
+	if( fid != checkpointFid )
+	{
+		error = "unable to resume : source doesn't match checkpoint";
+
+		return false;
+	}
+
+	return true;
+}
+
+int Ogr::GetCommitCount( void )
+{
+	return commitCount;
+}
+
+double Ogr::GetCommitTime( void )
+{
+	return commitTime;
+}
+
+double Ogr::Clock( void )
+{
+	struct timeval now;
+
+	gettimeofday( &now, NULL );
+
+	return now.tv_sec + now.tv_usec / 1000000.0;
+}
+
+double Ogr::CpuClock( void )
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	struct timespec now;
+
+	if( clock_gettime( CLOCK_THREAD_CPUTIME_ID, &now ) == 0 )
+	{
+		return now.tv_sec + now.tv_nsec / 1000000000.0;
+	}
+#endif
+
+	// process time, only meaningful for serial runs
+
+	return ( double ) clock() / CLOCKS_PER_SEC;
+}
+
+void Ogr::Measure( int stage, double wall, double cpu )
+{
+	stats.wall[ stage ] += Clock() - wall;
+	stats.cpu[ stage ] += CpuClock() - cpu;
+}
+
+Ogr::Stats Ogr::GetStats( void )
+{
+	return stats;
+}
+
+string Ogr::Json( string text )
+{
+	string quoted = "\"";
+
+	for( size_t i = 0; i < text.size(); i ++ )
+	{
+		unsigned char c = text[ i ];
+
+		if( c == '"' || c == '\\' )
+		{
+			quoted += '\\';
+			quoted += c;
+		}
+		else if( c < 0x20 )
+		{
+			char escaped[ 8 ];
+
+			sprintf( escaped, "\\u%04x", c );
+
+			quoted += escaped;
+		}
+		else
+		{
+			quoted += c;
+		}
+	}
+
+	return quoted + "\"";
+}
+
+string Ogr::GetReport( void )
+{
+	static const char *names[ STAGE_COUNT ] = { "open", "prepare", "read", "transform", "write" };
+
+	char buffer[ 256 ];
+
+	string report = "{\"source\":" + Json( sourceName ) + ",\"layer\":" + Json( sourceLayerName ) + ",\"target\":" + Json( targetName ) + ",\"plan\":" + Json( plan ) + ",\"stages\":{";
+
+	for( int i = 0; i < STAGE_COUNT; i ++ )
+	{
+		sprintf( buffer, "%s\"%s\":{\"wall\":%.6f,\"cpu\":%.6f}", i > 0 ? "," : "", names[ i ], stats.wall[ i ], stats.cpu[ i ] );
+
+		report += buffer;
+	}
+
+	sprintf( buffer, "},\"features\":{\"read\":%ld,\"written\":%ld,\"failed\":%ld},\"bytes\":%.0f,\"commits\":%d,\"error\":", stats.read, stats.written, stats.failed, stats.bytes, commitCount );
+
+	return report + buffer + Json( error ) + "}";
 }
 
 bool Ogr::Error( OGRErr code, string &type )
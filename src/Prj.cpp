@@ -0,0 +1,420 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Prj.cpp
+ *	\brief Closed form projections
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Prj.h"
+
+#include "cpl_string.h"
+#include "gdal_version.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+static const double PI = 3.14159265358979323846;
+static const double DEG = PI / 180.0;
+
+/*!
+ *	\fn static void Series( const double *c, double xi, double eta, double &dxi, double &deta );
+ *	\brief Sums c[ j ] sin( 2 ( j + 1 ) ( xi + i eta ) ) for j < 6 by clenshaw recurrence
+ *	\param *c : kruger coefficients
+ *	\param xi : real part
+ *	\param eta : imaginary part
+ *	\param &dxi : real part of the sum
+ *	\param &deta : imaginary part of the sum
+ */
+static inline void Series( const double *c, double xi, double eta, double &dxi, double &deta )
+{
+	double s = sin( 2 * xi );
+	double co = cos( 2 * xi );
+	double sh = sinh( 2 * eta );
+	double ch = cosh( 2 * eta );
+
+	// 2 cos( 2 zeta )
+
+	double ar = 2 * co * ch;
+	double ai = -2 * s * sh;
+
+	double b1r = 0, b1i = 0;
+	double b2r = 0, b2i = 0;
+
+	for( int j = 5; j >= 0; j -- )
+	{
+		double b0r = ar * b1r - ai * b1i - b2r + c[ j ];
+		double b0i = ar * b1i + ai * b1r - b2i;
+
+		b2r = b1r;
+		b2i = b1i;
+
+		b1r = b0r;
+		b1i = b0i;
+	}
+
+	// times sin( 2 zeta )
+
+	double sr = s * ch;
+	double si = co * sh;
+
+	dxi = b1r * sr - b1i * si;
+	deta = b1r * si + b1i * sr;
+}
+
+/*!
+ *	\fn static double Wrap( double lon );
+ *	\brief Brings a longitude back in [ -pi, pi ]
+ *	\param lon : radians
+ *	\returns radians
+ */
+static inline double Wrap( double lon )
+{
+	return lon - 2 * PI * floor( ( lon + PI ) / ( 2 * PI ) );
+}
+
+Prj::Prj( void )
+{
+	memset( &source, 0, sizeof( source ) );
+	memset( &target, 0, sizeof( target ) );
+}
+
+Prj *Prj::Create( OGRSpatialReferenceH sourceSRS, OGRSpatialReferenceH targetSRS )
+{
+	if( sourceSRS == NULL || targetSRS == NULL )
+	{
+		return NULL;
+	}
+
+	if( ! CSLTestBoolean( CPLGetConfigOption( "OGR2GUI_FAST_PROJ", "YES" ) ) )
+	{
+		return NULL;
+	}
+
+	Prj *prj = new Prj();
+
+	if( ! Identify( sourceSRS, prj->source ) || ! Identify( targetSRS, prj->target ) || ! Coincident( sourceSRS, targetSRS ) )
+	{
+		delete prj;
+
+		return NULL;
+	}
+
+	return prj;
+}
+
+bool Prj::Identify( OGRSpatialReferenceH srs, Frame &frame )
+{
+#if GDAL_VERSION_MAJOR >= 3
+	// authority axis order is left to PROJ
+
+	if( OSRGetAxisMappingStrategy( srs ) != OAMS_TRADITIONAL_GIS_ORDER && ( OSREPSGTreatsAsLatLong( srs ) || OSREPSGTreatsAsNorthingEasting( srs ) ) )
+	{
+		return false;
+	}
+#endif
+
+	if( OSRGetPrimeMeridian( srs, NULL ) != 0.0 || fabs( OSRGetAngularUnits( srs, NULL ) - DEG ) > 1e-12 )
+	{
+		return false;
+	}
+
+	OGRErr err = OGRERR_NONE;
+
+	double invf = OSRGetInvFlattening( srs, &err );
+	double f = ( invf > 0 ) ? 1.0 / invf : 0.0;
+
+	frame.a = OSRGetSemiMajor( srs, &err );
+	frame.n = f / ( 2 - f );
+	frame.e = sqrt( f * ( 2 - f ) );
+
+	if( err != OGRERR_NONE )
+	{
+		return false;
+	}
+
+	if( OSRIsGeographic( srs ) )
+	{
+		frame.kind = GEOGRAPHIC;
+
+		return true;
+	}
+
+	if( ! OSRIsProjected( srs ) || OSRGetLinearUnits( srs, NULL ) != 1.0 )
+	{
+		return false;
+	}
+
+	frame.k0 = OSRGetProjParm( srs, SRS_PP_SCALE_FACTOR, 1.0, NULL );
+	frame.lon0 = OSRGetProjParm( srs, SRS_PP_CENTRAL_MERIDIAN, 0.0, NULL ) * DEG;
+	frame.x0 = OSRGetProjParm( srs, SRS_PP_FALSE_EASTING, 0.0, NULL );
+	frame.y0 = OSRGetProjParm( srs, SRS_PP_FALSE_NORTHING, 0.0, NULL );
+
+	// web mercator projects the ellipsoid coordinates on a sphere
+
+	const char *code = OSRGetAuthorityCode( srs, "PROJCS" );
+
+	if( code != NULL && ( strcmp( code, "3857" ) == 0 || strcmp( code, "3785" ) == 0 || strcmp( code, "900913" ) == 0 ) )
+	{
+		frame.kind = MERCATOR;
+		frame.a = 6378137.0;
+
+		return true;
+	}
+
+	const char *name = OSRGetAttrValue( srs, "PROJECTION", 0 );
+
+	if( name == NULL || ! EQUAL( name, SRS_PT_TRANSVERSE_MERCATOR ) )
+	{
+		return false;
+	}
+
+	frame.kind = TRANSVERSE;
+
+	double n = frame.n;
+	double n2 = n * n;
+	double n3 = n2 * n;
+	double n4 = n3 * n;
+	double n5 = n4 * n;
+	double n6 = n5 * n;
+
+	frame.scale = frame.k0 * frame.a / ( 1 + n ) * ( 1 + n2 / 4 + n4 / 64 + n6 / 256 );
+
+	frame.alpha[ 0 ] = n / 2 - 2 * n2 / 3 + 5 * n3 / 16 + 41 * n4 / 180 - 127 * n5 / 288 + 7891 * n6 / 37800;
+	frame.alpha[ 1 ] = 13 * n2 / 48 - 3 * n3 / 5 + 557 * n4 / 1440 + 281 * n5 / 630 - 1983433 * n6 / 1935360;
+	frame.alpha[ 2 ] = 61 * n3 / 240 - 103 * n4 / 140 + 15061 * n5 / 26880 + 167603 * n6 / 181440;
+	frame.alpha[ 3 ] = 49561 * n4 / 161280 - 179 * n5 / 168 + 6601661 * n6 / 7257600;
+	frame.alpha[ 4 ] = 34729 * n5 / 80640 - 3418889 * n6 / 1995840;
+	frame.alpha[ 5 ] = 212378941 * n6 / 319334400;
+
+	frame.beta[ 0 ] = n / 2 - 2 * n2 / 3 + 37 * n3 / 96 - n4 / 360 - 81 * n5 / 512 + 96199 * n6 / 604800;
+	frame.beta[ 1 ] = n2 / 48 + n3 / 15 - 437 * n4 / 1440 + 46 * n5 / 105 - 1118711 * n6 / 3870720;
+	frame.beta[ 2 ] = 17 * n3 / 480 - 37 * n4 / 840 - 209 * n5 / 4480 + 5569 * n6 / 90720;
+	frame.beta[ 3 ] = 4397 * n4 / 161280 - 11 * n5 / 504 - 830251 * n6 / 7257600;
+	frame.beta[ 4 ] = 4583 * n5 / 161280 - 108847 * n6 / 3991680;
+	frame.beta[ 5 ] = 20648693 * n6 / 638668800;
+
+	// northing of the latitude of origin on the central meridian
+
+	double lat0 = OSRGetProjParm( srs, SRS_PP_LATITUDE_OF_ORIGIN, 0.0, NULL ) * DEG;
+
+	if( lat0 != 0 )
+	{
+		double x = frame.lon0;
+		double y = lat0;
+
+		double y0 = frame.y0;
+
+		frame.x0 = 0;
+		frame.y0 = 0;
+
+		Forward( frame, 1, &x, &y );
+
+		frame.x0 = OSRGetProjParm( srs, SRS_PP_FALSE_EASTING, 0.0, NULL );
+		frame.y0 = y0 - y;
+	}
+
+	return true;
+}
+
+bool Prj::Coincident( OGRSpatialReferenceH sourceSRS, OGRSpatialReferenceH targetSRS )
+{
+	if( OSRIsSameGeogCS( sourceSRS, targetSRS ) )
+	{
+		return true;
+	}
+
+	// datums whose shift to WGS84 is null within a metre
+
+	static const char *datums[] = { SRS_DN_WGS84, SRS_DN_NAD83, "NAD83_Canadian_Spatial_Reference_System", NULL };
+
+	const char *names[ 2 ];
+
+	names[ 0 ] = OSRGetAttrValue( sourceSRS, "DATUM", 0 );
+	names[ 1 ] = OSRGetAttrValue( targetSRS, "DATUM", 0 );
+
+	for( int i = 0; i < 2; i ++ )
+	{
+		int j = 0;
+
+		while( names[ i ] != NULL && datums[ j ] != NULL && ! EQUAL( names[ i ], datums[ j ] ) )
+		{
+			j ++;
+		}
+
+		if( names[ i ] == NULL || datums[ j ] == NULL )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void Prj::Inverse( const Frame &frame, int count, double *x, double *y )
+{
+	switch( frame.kind )
+	{
+		case GEOGRAPHIC :
+		{
+			for( int i = 0; i < count; i ++ )
+			{
+				x[ i ] *= DEG;
+				y[ i ] *= DEG;
+			}
+		}
+		break;
+
+		case MERCATOR :
+		{
+			for( int i = 0; i < count; i ++ )
+			{
+				x[ i ] = frame.lon0 + ( x[ i ] - frame.x0 ) / frame.a;
+				y[ i ] = atan( sinh( ( y[ i ] - frame.y0 ) / frame.a ) );
+			}
+		}
+		break;
+
+		case TRANSVERSE :
+		{
+			double e2 = frame.e * frame.e;
+
+			for( int i = 0; i < count; i ++ )
+			{
+				double xi = ( y[ i ] - frame.y0 ) / frame.scale;
+				double eta = ( x[ i ] - frame.x0 ) / frame.scale;
+
+				double dxi, deta;
+
+				Series( frame.beta, xi, eta, dxi, deta );
+
+				xi -= dxi;
+				eta -= deta;
+
+				double sh = sinh( eta );
+				double c = cos( xi );
+
+				// tangent of the conformal latitude, then of the latitude by newton steps
+
+				double taup = sin( xi ) / sqrt( sh * sh + c * c );
+				double tau = taup / ( 1 - e2 );
+
+				for( int k = 0; k < 3; k ++ )
+				{
+					double root = sqrt( 1 + tau * tau );
+					double sigma = sinh( frame.e * atanh( frame.e * tau / root ) );
+					double taui = tau * sqrt( 1 + sigma * sigma ) - sigma * root;
+
+					tau += ( taup - taui ) / ( ( 1 - e2 ) * sqrt( 1 + taui * taui ) * root / ( 1 + ( 1 - e2 ) * tau * tau ) );
+				}
+
+				x[ i ] = frame.lon0 + atan2( sh, c );
+				y[ i ] = atan( tau );
+			}
+		}
+		break;
+	}
+}
+
+void Prj::Forward( const Frame &frame, int count, double *x, double *y )
+{
+	switch( frame.kind )
+	{
+		case GEOGRAPHIC :
+		{
+			for( int i = 0; i < count; i ++ )
+			{
+				x[ i ] = Wrap( x[ i ] ) / DEG;
+				y[ i ] /= DEG;
+			}
+		}
+		break;
+
+		case MERCATOR :
+		{
+			for( int i = 0; i < count; i ++ )
+			{
+				// poles have no image, they end up infinite and fail
+
+				double t = ( fabs( y[ i ] ) < PI / 2 - 1e-10 ) ? tan( y[ i ] ) : HUGE_VAL;
+
+				x[ i ] = frame.x0 + frame.a * Wrap( x[ i ] - frame.lon0 );
+				y[ i ] = frame.y0 + frame.a * asinh( t );
+			}
+		}
+		break;
+
+		case TRANSVERSE :
+		{
+			for( int i = 0; i < count; i ++ )
+			{
+				double lambda = Wrap( x[ i ] - frame.lon0 );
+
+				double s = sin( y[ i ] );
+				double c = cos( lambda );
+
+				// tangent of the conformal latitude
+
+				double t = sinh( atanh( s ) - frame.e * atanh( frame.e * s ) );
+
+				double xi = atan2( t, c );
+				double eta = asinh( sin( lambda ) / sqrt( t * t + c * c ) );
+
+				double dxi, deta;
+
+				Series( frame.alpha, xi, eta, dxi, deta );
+
+				x[ i ] = frame.x0 + frame.scale * ( eta + deta );
+				y[ i ] = frame.y0 + frame.scale * ( xi + dxi );
+			}
+		}
+		break;
+	}
+}
+
+int Prj::Transform( int count, double *x, double *y, int *success ) const
+{
+	int failed = 0;
+
+	Inverse( source, count, x, y );
+
+	for( int i = 0; i < count; i ++ )
+	{
+		success[ i ] = fabs( y[ i ] ) <= PI / 2 + 1e-12;
+	}
+
+	Forward( target, count, x, y );
+
+	// infinite or undefined results fail
+
+	for( int i = 0; i < count; i ++ )
+	{
+		success[ i ] = success[ i ] && x[ i ] - x[ i ] == 0 && y[ i ] - y[ i ] == 0;
+
+		failed += ! success[ i ];
+	}
+
+	return failed;
+}
@@ -0,0 +1,222 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Que.cpp
+ *	\brief Bounded feature queue
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Que.h"
+
+Que::Que( int c, size_t b, int p )
+{
+	capacity = c;
+	budget = b;
+	producers = p;
+
+	bytes = 0;
+
+	limit = -1;
+
+	aborted = false;
+
+	mutex = CPLCreateMutex();
+
+	CPLReleaseMutex( mutex );
+
+	pushCond = CPLCreateCond();
+	popCond = CPLCreateCond();
+}
+
+Que::~Que( void )
+{
+	for( size_t i = 0; i < items.size(); i ++ )
+	{
+		OGR_F_Destroy( items[ i ].feature );
+	}
+
+	CPLDestroyCond( pushCond );
+	CPLDestroyCond( popCond );
+
+	CPLDestroyMutex( mutex );
+}
+
+bool Que::Push( long index, OGRFeatureH feature, size_t size )
+{
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	while( ! aborted && ( ( limit >= 0 && index > limit ) || ( ! items.empty() && ( ( int ) items.size() >= capacity || bytes + size > budget ) ) ) )
+	{
+		CPLCondWait( pushCond, mutex );
+	}
+
+	if( aborted )
+	{
+		CPLReleaseMutex( mutex );
+
+		return false;
+	}
+
+	Item item;
+
+	item.index = index;
+	item.feature = feature;
+	item.size = size;
+
+	items.push_back( item );
+
+	bytes += size;
+
+	CPLCondSignal( popCond );
+
+	CPLReleaseMutex( mutex );
+
+	return true;
+}
+
+bool Que::Pop( long &index, OGRFeatureH &feature, size_t &size )
+{
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	while( ! aborted && items.empty() && producers > 0 )
+	{
+		CPLCondWait( popCond, mutex );
+	}
+
+	if( aborted || items.empty() )
+	{
+		CPLReleaseMutex( mutex );
+
+		return false;
+	}
+
+	index = items.front().index;
+	feature = items.front().feature;
+	size = items.front().size;
+
+	bytes -= items.front().size;
+
+	items.pop_front();
+
+	CPLCondBroadcast( pushCond );
+
+	CPLReleaseMutex( mutex );
+
+	return true;
+}
+
+bool Que::Pop( vector<long> &indexes, vector<OGRFeatureH> &features, int count )
+{
+	indexes.clear();
+	features.clear();
+
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	while( ! aborted && items.empty() && producers > 0 )
+	{
+		CPLCondWait( popCond, mutex );
+	}
+
+	if( aborted || items.empty() )
+	{
+		CPLReleaseMutex( mutex );
+
+		return false;
+	}
+
+	// whatever is already queued, without waiting for a full batch
+
+	while( ! items.empty() && ( int ) features.size() < count )
+	{
+		indexes.push_back( items.front().index );
+		features.push_back( items.front().feature );
+
+		bytes -= items.front().size;
+
+		items.pop_front();
+	}
+
+	CPLCondBroadcast( pushCond );
+
+	CPLReleaseMutex( mutex );
+
+	return true;
+}
+
+void Que::Limit( long index )
+{
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	if( index != limit )
+	{
+		limit = index;
+
+		CPLCondBroadcast( pushCond );
+	}
+
+	CPLReleaseMutex( mutex );
+}
+
+void Que::Close( void )
+{
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	if( producers > 0 )
+	{
+		producers --;
+	}
+
+	if( producers == 0 )
+	{
+		CPLCondBroadcast( popCond );
+	}
+
+	CPLReleaseMutex( mutex );
+}
+
+void Que::Abort( void )
+{
+	CPLAcquireMutex( mutex, 1000.0 );
+
+	aborted = true;
+
+	CPLCondBroadcast( pushCond );
+	CPLCondBroadcast( popCond );
+
+	CPLReleaseMutex( mutex );
+}
+
+size_t Que::Size( OGRFeatureH feature )
+{
+	OGRGeometryH geom = OGR_F_GetGeometryRef( feature );
+
+	size_t size = 64 + 32 * OGR_FD_GetFieldCount( OGR_F_GetDefnRef( feature ) );
+
+	if( geom != NULL )
+	{
+		size += OGR_G_WkbSize( geom );
+	}
+
+	return size;
+}
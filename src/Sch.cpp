@@ -0,0 +1,211 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Sch.cpp
+ *	\brief Projection search
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Sch.h"
+#include "../inc/Dta.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+vector<Sch::Word> Sch::words;
+
+bool Sch::Word::operator<( const Word &other ) const
+{
+	return text < other.text;
+}
+
+/*!
+ *	\struct Rank
+ *	\brief Orders matches by score, then shorter name, then table order
+ */
+struct Rank
+{
+	const vector<int> *scores;
+
+	bool operator()( int a, int b ) const
+	{
+		if( ( *scores )[ a ] != ( *scores )[ b ] )
+		{
+			return ( *scores )[ a ] > ( *scores )[ b ];
+		}
+
+		size_t la = strlen( Dta::ProjectionName( a ) );
+		size_t lb = strlen( Dta::ProjectionName( b ) );
+
+		return la != lb ? la < lb : a < b;
+	}
+};
+
+void Sch::Split( string text, vector<string> &tokens )
+{
+	string token;
+
+	tokens.clear();
+
+	for( size_t i = 0; i <= text.size(); i ++ )
+	{
+		if( i < text.size() && isalnum( ( unsigned char ) text[ i ] ) )
+		{
+			token += tolower( ( unsigned char ) text[ i ] );
+		}
+		else if( ! token.empty() )
+		{
+			tokens.push_back( token );
+
+			token.clear();
+		}
+	}
+}
+
+void Sch::Build( void )
+{
+	vector<string> tokens;
+
+	char code[ 16 ];
+
+	for( int i = 1; i < Dta::Projections(); i ++ )
+	{
+		Word word;
+
+		word.row = i;
+		word.code = true;
+
+		snprintf( code, sizeof( code ), "%d", Dta::ProjectionCode( i ) );
+
+		word.text = code;
+
+		words.push_back( word );
+
+		word.code = false;
+
+		Split( Dta::ProjectionName( i ), tokens );
+
+		for( size_t j = 0; j < tokens.size(); j ++ )
+		{
+			word.text = tokens[ j ];
+
+			words.push_back( word );
+		}
+	}
+
+	sort( words.begin(), words.end() );
+}
+
+vector<int> Sch::Find( string query, int limit )
+{
+	vector<int> results;
+
+	vector<string> tokens;
+
+	Split( query, tokens );
+
+	if( tokens.empty() )
+	{
+		return results;
+	}
+
+	if( words.empty() )
+	{
+		Build();
+	}
+
+	int rows = Dta::Projections();
+
+	// per query word best score of each row, and number of query words a row matched
+
+	vector<int> best( rows, 0 );
+	vector<int> scores( rows, 0 );
+	vector<int> matched( rows, 0 );
+
+	vector<int> touched;
+
+	for( size_t t = 0; t < tokens.size(); t ++ )
+	{
+		Word key;
+
+		key.text = tokens[ t ];
+
+		touched.clear();
+
+		for( vector<Word>::iterator it = lower_bound( words.begin(), words.end(), key ); it != words.end() && it->text.compare( 0, key.text.size(), key.text ) == 0; it ++ )
+		{
+			int score = ( it->text.size() == key.text.size() ) ? ( it->code ? 5 : 3 ) : 2;
+
+			if( best[ it->row ] == 0 )
+			{
+				touched.push_back( it->row );
+			}
+
+			best[ it->row ] = std::max( best[ it->row ], score );
+		}
+
+		for( size_t i = 0; i < touched.size(); i ++ )
+		{
+			int row = touched[ i ];
+
+			// a row matches a query word once, however many of its words start with it
+
+			if( matched[ row ] == ( int ) t )
+			{
+				matched[ row ] ++;
+
+				scores[ row ] += best[ row ];
+			}
+
+			best[ row ] = 0;
+		}
+	}
+
+	for( int i = 1; i < rows; i ++ )
+	{
+		if( matched[ i ] == ( int ) tokens.size() )
+		{
+			results.push_back( i );
+		}
+	}
+
+	Rank rank;
+
+	rank.scores = &scores;
+
+	if( ( int ) results.size() > limit )
+	{
+		partial_sort( results.begin(), results.begin() + limit, results.end(), rank );
+
+		results.resize( limit );
+	}
+	else
+	{
+		sort( results.begin(), results.end(), rank );
+	}
+
+	return results;
+}
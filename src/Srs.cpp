@@ -0,0 +1,227 @@
+/*****************************************************************************
+ *	ogr2gui is an application used to convert and manipulate geospatial
+ *	data. It is based on the "OGR Simple Feature Library" from the 
+ *	"Geospatial Data Abstraction Library" <http://gdal.org>.
+ *
+ *	Copyright (c) 2009 Inventis <mailto:developpement@inventis.ca>
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *****************************************************************************/
+
+/*!
+ *	\file Srs.cpp
+ *	\brief Spatial reference and transformation cache
+ *	\author Olivier Pilotte [ Inventis ]
+ *	\version 0.6
+ *	\date 27/10/09
+ */
+
+#include "../inc/Srs.h"
+
+#include "cpl_conv.h"
+#include "gdal_version.h"
+
+#include <cstdio>
+
+CPLMutex *Srs::mutex = NULL;
+
+map<int, OGRSpatialReferenceH> Srs::references;
+
+map<string, vector<OGRCoordinateTransformationH> > Srs::idle;
+map<OGRCoordinateTransformationH, string> Srs::lent;
+
+long Srs::referenceHits = 0;
+long Srs::referenceMisses = 0;
+long Srs::transformHits = 0;
+long Srs::transformMisses = 0;
+
+string Srs::Key( OGRSpatialReferenceH srs )
+{
+	char buffer[ 64 ];
+
+	const char *authority = OSRGetAuthorityName( srs, NULL );
+	const char *code = OSRGetAuthorityCode( srs, NULL );
+
+	if( authority != NULL && code != NULL && EQUAL( authority, "EPSG" ) )
+	{
+		snprintf( buffer, sizeof( buffer ), "EPSG:%s", code );
+	}
+	else
+	{
+		char *wkt = NULL;
+
+		OSRExportToWkt( srs, &wkt );
+
+		// fnv-1a
+
+		unsigned int hash = 2166136261u;
+
+		for( const char *c = wkt; c != NULL && *c != '\0'; c ++ )
+		{
+			hash = ( hash ^ ( unsigned char ) *c ) * 16777619u;
+		}
+
+		CPLFree( wkt );
+
+		snprintf( buffer, sizeof( buffer ), "WKT:%08x", hash );
+	}
+
+	string key = buffer;
+
+#if GDAL_VERSION_MAJOR >= 3
+	// the same code gives different transformations in authority and gis axis order
+
+	snprintf( buffer, sizeof( buffer ), ":%d", ( int ) OSRGetAxisMappingStrategy( srs ) );
+
+	key += buffer;
+#endif
+
+	return key;
+}
+
+OGRSpatialReferenceH Srs::Reference( int epsg )
+{
+	OGRSpatialReferenceH srs = NULL;
+
+	{
+		CPLMutexHolderD( &mutex );
+
+		map<int, OGRSpatialReferenceH>::iterator it = references.find( epsg );
+
+		if( it != references.end() )
+		{
+			referenceHits ++;
+
+			return OSRClone( it->second );
+		}
+
+		referenceMisses ++;
+	}
+
+	// imports read the EPSG tables, they are done out of the lock
+
+	srs = OSRNewSpatialReference( NULL );
+
+	if( OSRImportFromEPSG( srs, epsg ) != OGRERR_NONE )
+	{
+		OSRDestroySpatialReference( srs );
+
+		return NULL;
+	}
+
+	CPLMutexHolderD( &mutex );
+
+	if( references.find( epsg ) == references.end() )
+	{
+		references[ epsg ] = srs;
+	}
+	else
+	{
+		OSRDestroySpatialReference( srs );
+	}
+
+	return OSRClone( references[ epsg ] );
+}
+
+OGRCoordinateTransformationH Srs::Acquire( OGRSpatialReferenceH source, OGRSpatialReferenceH target )
+{
+	string key = Key( source ) + " " + Key( target );
+
+	{
+		CPLMutexHolderD( &mutex );
+
+		vector<OGRCoordinateTransformationH> &free = idle[ key ];
+
+		if( ! free.empty() )
+		{
+			OGRCoordinateTransformationH transform = free.back();
+
+			free.pop_back();
+
+			lent[ transform ] = key;
+
+			transformHits ++;
+
+			return transform;
+		}
+
+		transformMisses ++;
+	}
+
+	OGRCoordinateTransformationH transform = OCTNewCoordinateTransformation( source, target );
+
+	if( transform != NULL )
+	{
+		CPLMutexHolderD( &mutex );
+
+		lent[ transform ] = key;
+	}
+
+	return transform;
+}
+
+void Srs::Release( OGRCoordinateTransformationH transform )
+{
+	if( transform == NULL )
+	{
+		return;
+	}
+
+	CPLMutexHolderD( &mutex );
+
+	map<OGRCoordinateTransformationH, string>::iterator it = lent.find( transform );
+
+	if( it == lent.end() )
+	{
+		OCTDestroyCoordinateTransformation( transform );
+
+		return;
+	}
+
+	idle[ it->second ].push_back( transform );
+
+	lent.erase( it );
+}
+
+void Srs::Clear( void )
+{
+	CPLMutexHolderD( &mutex );
+
+	for( map<int, OGRSpatialReferenceH>::iterator it = references.begin(); it != references.end(); it ++ )
+	{
+		OSRDestroySpatialReference( it->second );
+	}
+
+	for( map<string, vector<OGRCoordinateTransformationH> >::iterator it = idle.begin(); it != idle.end(); it ++ )
+	{
+		for( size_t i = 0; i < it->second.size(); i ++ )
+		{
+			OCTDestroyCoordinateTransformation( it->second[ i ] );
+		}
+	}
+
+	references.clear();
+	idle.clear();
+}
+
+string Srs::Counters( void )
+{
+	char buffer[ 128 ];
+
+	CPLMutexHolderD( &mutex );
+
+	snprintf( buffer, sizeof( buffer ), "references %ld hits %ld misses, transformations %ld hits %ld misses", referenceHits, referenceMisses, transformHits, transformMisses );
+
+	return buffer;
+}